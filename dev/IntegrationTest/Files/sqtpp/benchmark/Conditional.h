@@ -0,0 +1,326 @@
+/*
+** @file
+** @brief Benchmark input: Header with many conditional directives.
+**
+** The header has no include guard. It is included several times by
+** Conditional.csql.
+*/
+#if FEATURE_LEVEL >= 1 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_1 ) )
+SELECT 1 AS Feature1
+#elif defined USE_LEGACY_1 || FEATURE_LEVEL * 2 == 1
+SELECT -1 AS Feature1
+#else
+SELECT 0 AS Feature1
+#endif
+
+#if FEATURE_LEVEL >= 2 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_2 ) )
+SELECT 2 AS Feature2
+#elif defined USE_LEGACY_2 || FEATURE_LEVEL * 2 == 2
+SELECT -2 AS Feature2
+#else
+SELECT 0 AS Feature2
+#endif
+
+#if FEATURE_LEVEL >= 3 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_3 ) )
+SELECT 3 AS Feature3
+#elif defined USE_LEGACY_3 || FEATURE_LEVEL * 2 == 3
+SELECT -3 AS Feature3
+#else
+SELECT 0 AS Feature3
+#endif
+
+#if FEATURE_LEVEL >= 4 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_4 ) )
+SELECT 4 AS Feature4
+#elif defined USE_LEGACY_4 || FEATURE_LEVEL * 2 == 4
+SELECT -4 AS Feature4
+#else
+SELECT 0 AS Feature4
+#endif
+
+#if FEATURE_LEVEL >= 0 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_5 ) )
+SELECT 5 AS Feature5
+#elif defined USE_LEGACY_5 || FEATURE_LEVEL * 2 == 5
+SELECT -5 AS Feature5
+#else
+SELECT 0 AS Feature5
+#endif
+
+#if FEATURE_LEVEL >= 1 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_6 ) )
+SELECT 6 AS Feature6
+#elif defined USE_LEGACY_6 || FEATURE_LEVEL * 2 == 6
+SELECT -6 AS Feature6
+#else
+SELECT 0 AS Feature6
+#endif
+
+#if FEATURE_LEVEL >= 2 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_7 ) )
+SELECT 7 AS Feature7
+#elif defined USE_LEGACY_7 || FEATURE_LEVEL * 2 == 0
+SELECT -7 AS Feature7
+#else
+SELECT 0 AS Feature7
+#endif
+
+#if FEATURE_LEVEL >= 3 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_8 ) )
+SELECT 8 AS Feature8
+#elif defined USE_LEGACY_8 || FEATURE_LEVEL * 2 == 1
+SELECT -8 AS Feature8
+#else
+SELECT 0 AS Feature8
+#endif
+
+#if FEATURE_LEVEL >= 4 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_9 ) )
+SELECT 9 AS Feature9
+#elif defined USE_LEGACY_9 || FEATURE_LEVEL * 2 == 2
+SELECT -9 AS Feature9
+#else
+SELECT 0 AS Feature9
+#endif
+
+#if FEATURE_LEVEL >= 0 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_10 ) )
+SELECT 10 AS Feature10
+#elif defined USE_LEGACY_10 || FEATURE_LEVEL * 2 == 3
+SELECT -10 AS Feature10
+#else
+SELECT 0 AS Feature10
+#endif
+
+#if FEATURE_LEVEL >= 1 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_11 ) )
+SELECT 11 AS Feature11
+#elif defined USE_LEGACY_11 || FEATURE_LEVEL * 2 == 4
+SELECT -11 AS Feature11
+#else
+SELECT 0 AS Feature11
+#endif
+
+#if FEATURE_LEVEL >= 2 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_12 ) )
+SELECT 12 AS Feature12
+#elif defined USE_LEGACY_12 || FEATURE_LEVEL * 2 == 5
+SELECT -12 AS Feature12
+#else
+SELECT 0 AS Feature12
+#endif
+
+#if FEATURE_LEVEL >= 3 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_13 ) )
+SELECT 13 AS Feature13
+#elif defined USE_LEGACY_13 || FEATURE_LEVEL * 2 == 6
+SELECT -13 AS Feature13
+#else
+SELECT 0 AS Feature13
+#endif
+
+#if FEATURE_LEVEL >= 4 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_14 ) )
+SELECT 14 AS Feature14
+#elif defined USE_LEGACY_14 || FEATURE_LEVEL * 2 == 0
+SELECT -14 AS Feature14
+#else
+SELECT 0 AS Feature14
+#endif
+
+#if FEATURE_LEVEL >= 0 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_15 ) )
+SELECT 15 AS Feature15
+#elif defined USE_LEGACY_15 || FEATURE_LEVEL * 2 == 1
+SELECT -15 AS Feature15
+#else
+SELECT 0 AS Feature15
+#endif
+
+#if FEATURE_LEVEL >= 1 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_16 ) )
+SELECT 16 AS Feature16
+#elif defined USE_LEGACY_16 || FEATURE_LEVEL * 2 == 2
+SELECT -16 AS Feature16
+#else
+SELECT 0 AS Feature16
+#endif
+
+#if FEATURE_LEVEL >= 2 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_17 ) )
+SELECT 17 AS Feature17
+#elif defined USE_LEGACY_17 || FEATURE_LEVEL * 2 == 3
+SELECT -17 AS Feature17
+#else
+SELECT 0 AS Feature17
+#endif
+
+#if FEATURE_LEVEL >= 3 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_18 ) )
+SELECT 18 AS Feature18
+#elif defined USE_LEGACY_18 || FEATURE_LEVEL * 2 == 4
+SELECT -18 AS Feature18
+#else
+SELECT 0 AS Feature18
+#endif
+
+#if FEATURE_LEVEL >= 4 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_19 ) )
+SELECT 19 AS Feature19
+#elif defined USE_LEGACY_19 || FEATURE_LEVEL * 2 == 5
+SELECT -19 AS Feature19
+#else
+SELECT 0 AS Feature19
+#endif
+
+#if FEATURE_LEVEL >= 0 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_20 ) )
+SELECT 20 AS Feature20
+#elif defined USE_LEGACY_20 || FEATURE_LEVEL * 2 == 6
+SELECT -20 AS Feature20
+#else
+SELECT 0 AS Feature20
+#endif
+
+#if FEATURE_LEVEL >= 1 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_21 ) )
+SELECT 21 AS Feature21
+#elif defined USE_LEGACY_21 || FEATURE_LEVEL * 2 == 0
+SELECT -21 AS Feature21
+#else
+SELECT 0 AS Feature21
+#endif
+
+#if FEATURE_LEVEL >= 2 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_22 ) )
+SELECT 22 AS Feature22
+#elif defined USE_LEGACY_22 || FEATURE_LEVEL * 2 == 1
+SELECT -22 AS Feature22
+#else
+SELECT 0 AS Feature22
+#endif
+
+#if FEATURE_LEVEL >= 3 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_23 ) )
+SELECT 23 AS Feature23
+#elif defined USE_LEGACY_23 || FEATURE_LEVEL * 2 == 2
+SELECT -23 AS Feature23
+#else
+SELECT 0 AS Feature23
+#endif
+
+#if FEATURE_LEVEL >= 4 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_24 ) )
+SELECT 24 AS Feature24
+#elif defined USE_LEGACY_24 || FEATURE_LEVEL * 2 == 3
+SELECT -24 AS Feature24
+#else
+SELECT 0 AS Feature24
+#endif
+
+#if FEATURE_LEVEL >= 0 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_25 ) )
+SELECT 25 AS Feature25
+#elif defined USE_LEGACY_25 || FEATURE_LEVEL * 2 == 4
+SELECT -25 AS Feature25
+#else
+SELECT 0 AS Feature25
+#endif
+
+#if FEATURE_LEVEL >= 1 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_26 ) )
+SELECT 26 AS Feature26
+#elif defined USE_LEGACY_26 || FEATURE_LEVEL * 2 == 5
+SELECT -26 AS Feature26
+#else
+SELECT 0 AS Feature26
+#endif
+
+#if FEATURE_LEVEL >= 2 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_27 ) )
+SELECT 27 AS Feature27
+#elif defined USE_LEGACY_27 || FEATURE_LEVEL * 2 == 6
+SELECT -27 AS Feature27
+#else
+SELECT 0 AS Feature27
+#endif
+
+#if FEATURE_LEVEL >= 3 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_28 ) )
+SELECT 28 AS Feature28
+#elif defined USE_LEGACY_28 || FEATURE_LEVEL * 2 == 0
+SELECT -28 AS Feature28
+#else
+SELECT 0 AS Feature28
+#endif
+
+#if FEATURE_LEVEL >= 4 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_29 ) )
+SELECT 29 AS Feature29
+#elif defined USE_LEGACY_29 || FEATURE_LEVEL * 2 == 1
+SELECT -29 AS Feature29
+#else
+SELECT 0 AS Feature29
+#endif
+
+#if FEATURE_LEVEL >= 0 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_30 ) )
+SELECT 30 AS Feature30
+#elif defined USE_LEGACY_30 || FEATURE_LEVEL * 2 == 2
+SELECT -30 AS Feature30
+#else
+SELECT 0 AS Feature30
+#endif
+
+#if FEATURE_LEVEL >= 1 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_31 ) )
+SELECT 31 AS Feature31
+#elif defined USE_LEGACY_31 || FEATURE_LEVEL * 2 == 3
+SELECT -31 AS Feature31
+#else
+SELECT 0 AS Feature31
+#endif
+
+#if FEATURE_LEVEL >= 2 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_32 ) )
+SELECT 32 AS Feature32
+#elif defined USE_LEGACY_32 || FEATURE_LEVEL * 2 == 4
+SELECT -32 AS Feature32
+#else
+SELECT 0 AS Feature32
+#endif
+
+#if FEATURE_LEVEL >= 3 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_33 ) )
+SELECT 33 AS Feature33
+#elif defined USE_LEGACY_33 || FEATURE_LEVEL * 2 == 5
+SELECT -33 AS Feature33
+#else
+SELECT 0 AS Feature33
+#endif
+
+#if FEATURE_LEVEL >= 4 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_34 ) )
+SELECT 34 AS Feature34
+#elif defined USE_LEGACY_34 || FEATURE_LEVEL * 2 == 6
+SELECT -34 AS Feature34
+#else
+SELECT 0 AS Feature34
+#endif
+
+#if FEATURE_LEVEL >= 0 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_35 ) )
+SELECT 35 AS Feature35
+#elif defined USE_LEGACY_35 || FEATURE_LEVEL * 2 == 0
+SELECT -35 AS Feature35
+#else
+SELECT 0 AS Feature35
+#endif
+
+#if FEATURE_LEVEL >= 1 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_36 ) )
+SELECT 36 AS Feature36
+#elif defined USE_LEGACY_36 || FEATURE_LEVEL * 2 == 1
+SELECT -36 AS Feature36
+#else
+SELECT 0 AS Feature36
+#endif
+
+#if FEATURE_LEVEL >= 2 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_37 ) )
+SELECT 37 AS Feature37
+#elif defined USE_LEGACY_37 || FEATURE_LEVEL * 2 == 2
+SELECT -37 AS Feature37
+#else
+SELECT 0 AS Feature37
+#endif
+
+#if FEATURE_LEVEL >= 3 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_38 ) )
+SELECT 38 AS Feature38
+#elif defined USE_LEGACY_38 || FEATURE_LEVEL * 2 == 3
+SELECT -38 AS Feature38
+#else
+SELECT 0 AS Feature38
+#endif
+
+#if FEATURE_LEVEL >= 4 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_39 ) )
+SELECT 39 AS Feature39
+#elif defined USE_LEGACY_39 || FEATURE_LEVEL * 2 == 4
+SELECT -39 AS Feature39
+#else
+SELECT 0 AS Feature39
+#endif
+
+#if FEATURE_LEVEL >= 0 && ( VERSION_MAJOR > 1 || defined( USE_LEGACY_40 ) )
+SELECT 40 AS Feature40
+#elif defined USE_LEGACY_40 || FEATURE_LEVEL * 2 == 5
+SELECT -40 AS Feature40
+#else
+SELECT 0 AS Feature40
+#endif
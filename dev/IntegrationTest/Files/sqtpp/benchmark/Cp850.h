@@ -0,0 +1,204 @@
+/*
+** @file
+** @brief Benchmark input: mixed German text in code page 850.
+*/
+insert into kunde( id, name, ort, bemerkung ) values ( 0, 'Mller-Ldenscheidt 0', 'Strae 0, Kln', 'Grere nderung fr Kunde 0: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 1, 'Mller-Ldenscheidt 1', 'Strae 1, Kln', 'Grere nderung fr Kunde 1: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 2, 'Mller-Ldenscheidt 2', 'Strae 2, Kln', 'Grere nderung fr Kunde 2: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 3, 'Mller-Ldenscheidt 3', 'Strae 3, Kln', 'Grere nderung fr Kunde 3: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 4, 'Mller-Ldenscheidt 4', 'Strae 4, Kln', 'Grere nderung fr Kunde 4: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 5, 'Mller-Ldenscheidt 5', 'Strae 5, Kln', 'Grere nderung fr Kunde 5: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 6, 'Mller-Ldenscheidt 6', 'Strae 6, Kln', 'Grere nderung fr Kunde 6: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 7, 'Mller-Ldenscheidt 7', 'Strae 7, Kln', 'Grere nderung fr Kunde 7: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 8, 'Mller-Ldenscheidt 8', 'Strae 8, Kln', 'Grere nderung fr Kunde 8: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 9, 'Mller-Ldenscheidt 9', 'Strae 9, Kln', 'Grere nderung fr Kunde 9: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 10, 'Mller-Ldenscheidt 10', 'Strae 10, Kln', 'Grere nderung fr Kunde 10: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 11, 'Mller-Ldenscheidt 11', 'Strae 11, Kln', 'Grere nderung fr Kunde 11: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 12, 'Mller-Ldenscheidt 12', 'Strae 12, Kln', 'Grere nderung fr Kunde 12: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 13, 'Mller-Ldenscheidt 13', 'Strae 13, Kln', 'Grere nderung fr Kunde 13: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 14, 'Mller-Ldenscheidt 14', 'Strae 14, Kln', 'Grere nderung fr Kunde 14: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 15, 'Mller-Ldenscheidt 15', 'Strae 15, Kln', 'Grere nderung fr Kunde 15: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 16, 'Mller-Ldenscheidt 16', 'Strae 16, Kln', 'Grere nderung fr Kunde 16: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 17, 'Mller-Ldenscheidt 17', 'Strae 17, Kln', 'Grere nderung fr Kunde 17: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 18, 'Mller-Ldenscheidt 18', 'Strae 18, Kln', 'Grere nderung fr Kunde 18: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 19, 'Mller-Ldenscheidt 19', 'Strae 19, Kln', 'Grere nderung fr Kunde 19: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 20, 'Mller-Ldenscheidt 20', 'Strae 20, Kln', 'Grere nderung fr Kunde 20: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 21, 'Mller-Ldenscheidt 21', 'Strae 21, Kln', 'Grere nderung fr Kunde 21: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 22, 'Mller-Ldenscheidt 22', 'Strae 22, Kln', 'Grere nderung fr Kunde 22: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 23, 'Mller-Ldenscheidt 23', 'Strae 23, Kln', 'Grere nderung fr Kunde 23: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 24, 'Mller-Ldenscheidt 24', 'Strae 24, Kln', 'Grere nderung fr Kunde 24: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 25, 'Mller-Ldenscheidt 25', 'Strae 25, Kln', 'Grere nderung fr Kunde 25: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 26, 'Mller-Ldenscheidt 26', 'Strae 26, Kln', 'Grere nderung fr Kunde 26: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 27, 'Mller-Ldenscheidt 27', 'Strae 27, Kln', 'Grere nderung fr Kunde 27: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 28, 'Mller-Ldenscheidt 28', 'Strae 28, Kln', 'Grere nderung fr Kunde 28: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 29, 'Mller-Ldenscheidt 29', 'Strae 29, Kln', 'Grere nderung fr Kunde 29: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 30, 'Mller-Ldenscheidt 30', 'Strae 30, Kln', 'Grere nderung fr Kunde 30: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 31, 'Mller-Ldenscheidt 31', 'Strae 31, Kln', 'Grere nderung fr Kunde 31: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 32, 'Mller-Ldenscheidt 32', 'Strae 32, Kln', 'Grere nderung fr Kunde 32: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 33, 'Mller-Ldenscheidt 33', 'Strae 33, Kln', 'Grere nderung fr Kunde 33: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 34, 'Mller-Ldenscheidt 34', 'Strae 34, Kln', 'Grere nderung fr Kunde 34: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 35, 'Mller-Ldenscheidt 35', 'Strae 35, Kln', 'Grere nderung fr Kunde 35: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 36, 'Mller-Ldenscheidt 36', 'Strae 36, Kln', 'Grere nderung fr Kunde 36: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 37, 'Mller-Ldenscheidt 37', 'Strae 37, Kln', 'Grere nderung fr Kunde 37: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 38, 'Mller-Ldenscheidt 38', 'Strae 38, Kln', 'Grere nderung fr Kunde 38: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 39, 'Mller-Ldenscheidt 39', 'Strae 39, Kln', 'Grere nderung fr Kunde 39: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 40, 'Mller-Ldenscheidt 40', 'Strae 40, Kln', 'Grere nderung fr Kunde 40: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 41, 'Mller-Ldenscheidt 41', 'Strae 41, Kln', 'Grere nderung fr Kunde 41: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 42, 'Mller-Ldenscheidt 42', 'Strae 42, Kln', 'Grere nderung fr Kunde 42: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 43, 'Mller-Ldenscheidt 43', 'Strae 43, Kln', 'Grere nderung fr Kunde 43: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 44, 'Mller-Ldenscheidt 44', 'Strae 44, Kln', 'Grere nderung fr Kunde 44: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 45, 'Mller-Ldenscheidt 45', 'Strae 45, Kln', 'Grere nderung fr Kunde 45: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 46, 'Mller-Ldenscheidt 46', 'Strae 46, Kln', 'Grere nderung fr Kunde 46: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 47, 'Mller-Ldenscheidt 47', 'Strae 47, Kln', 'Grere nderung fr Kunde 47: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 48, 'Mller-Ldenscheidt 48', 'Strae 48, Kln', 'Grere nderung fr Kunde 48: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 49, 'Mller-Ldenscheidt 49', 'Strae 49, Kln', 'Grere nderung fr Kunde 49: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 50, 'Mller-Ldenscheidt 50', 'Strae 50, Kln', 'Grere nderung fr Kunde 50: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 51, 'Mller-Ldenscheidt 51', 'Strae 51, Kln', 'Grere nderung fr Kunde 51: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 52, 'Mller-Ldenscheidt 52', 'Strae 52, Kln', 'Grere nderung fr Kunde 52: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 53, 'Mller-Ldenscheidt 53', 'Strae 53, Kln', 'Grere nderung fr Kunde 53: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 54, 'Mller-Ldenscheidt 54', 'Strae 54, Kln', 'Grere nderung fr Kunde 54: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 55, 'Mller-Ldenscheidt 55', 'Strae 55, Kln', 'Grere nderung fr Kunde 55: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 56, 'Mller-Ldenscheidt 56', 'Strae 56, Kln', 'Grere nderung fr Kunde 56: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 57, 'Mller-Ldenscheidt 57', 'Strae 57, Kln', 'Grere nderung fr Kunde 57: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 58, 'Mller-Ldenscheidt 58', 'Strae 58, Kln', 'Grere nderung fr Kunde 58: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 59, 'Mller-Ldenscheidt 59', 'Strae 59, Kln', 'Grere nderung fr Kunde 59: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 60, 'Mller-Ldenscheidt 60', 'Strae 60, Kln', 'Grere nderung fr Kunde 60: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 61, 'Mller-Ldenscheidt 61', 'Strae 61, Kln', 'Grere nderung fr Kunde 61: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 62, 'Mller-Ldenscheidt 62', 'Strae 62, Kln', 'Grere nderung fr Kunde 62: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 63, 'Mller-Ldenscheidt 63', 'Strae 63, Kln', 'Grere nderung fr Kunde 63: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 64, 'Mller-Ldenscheidt 64', 'Strae 64, Kln', 'Grere nderung fr Kunde 64: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 65, 'Mller-Ldenscheidt 65', 'Strae 65, Kln', 'Grere nderung fr Kunde 65: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 66, 'Mller-Ldenscheidt 66', 'Strae 66, Kln', 'Grere nderung fr Kunde 66: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 67, 'Mller-Ldenscheidt 67', 'Strae 67, Kln', 'Grere nderung fr Kunde 67: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 68, 'Mller-Ldenscheidt 68', 'Strae 68, Kln', 'Grere nderung fr Kunde 68: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 69, 'Mller-Ldenscheidt 69', 'Strae 69, Kln', 'Grere nderung fr Kunde 69: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 70, 'Mller-Ldenscheidt 70', 'Strae 70, Kln', 'Grere nderung fr Kunde 70: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 71, 'Mller-Ldenscheidt 71', 'Strae 71, Kln', 'Grere nderung fr Kunde 71: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 72, 'Mller-Ldenscheidt 72', 'Strae 72, Kln', 'Grere nderung fr Kunde 72: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 73, 'Mller-Ldenscheidt 73', 'Strae 73, Kln', 'Grere nderung fr Kunde 73: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 74, 'Mller-Ldenscheidt 74', 'Strae 74, Kln', 'Grere nderung fr Kunde 74: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 75, 'Mller-Ldenscheidt 75', 'Strae 75, Kln', 'Grere nderung fr Kunde 75: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 76, 'Mller-Ldenscheidt 76', 'Strae 76, Kln', 'Grere nderung fr Kunde 76: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 77, 'Mller-Ldenscheidt 77', 'Strae 77, Kln', 'Grere nderung fr Kunde 77: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 78, 'Mller-Ldenscheidt 78', 'Strae 78, Kln', 'Grere nderung fr Kunde 78: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 79, 'Mller-Ldenscheidt 79', 'Strae 79, Kln', 'Grere nderung fr Kunde 79: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 80, 'Mller-Ldenscheidt 80', 'Strae 80, Kln', 'Grere nderung fr Kunde 80: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 81, 'Mller-Ldenscheidt 81', 'Strae 81, Kln', 'Grere nderung fr Kunde 81: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 82, 'Mller-Ldenscheidt 82', 'Strae 82, Kln', 'Grere nderung fr Kunde 82: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 83, 'Mller-Ldenscheidt 83', 'Strae 83, Kln', 'Grere nderung fr Kunde 83: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 84, 'Mller-Ldenscheidt 84', 'Strae 84, Kln', 'Grere nderung fr Kunde 84: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 85, 'Mller-Ldenscheidt 85', 'Strae 85, Kln', 'Grere nderung fr Kunde 85: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 86, 'Mller-Ldenscheidt 86', 'Strae 86, Kln', 'Grere nderung fr Kunde 86: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 87, 'Mller-Ldenscheidt 87', 'Strae 87, Kln', 'Grere nderung fr Kunde 87: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 88, 'Mller-Ldenscheidt 88', 'Strae 88, Kln', 'Grere nderung fr Kunde 88: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 89, 'Mller-Ldenscheidt 89', 'Strae 89, Kln', 'Grere nderung fr Kunde 89: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 90, 'Mller-Ldenscheidt 90', 'Strae 90, Kln', 'Grere nderung fr Kunde 90: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 91, 'Mller-Ldenscheidt 91', 'Strae 91, Kln', 'Grere nderung fr Kunde 91: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 92, 'Mller-Ldenscheidt 92', 'Strae 92, Kln', 'Grere nderung fr Kunde 92: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 93, 'Mller-Ldenscheidt 93', 'Strae 93, Kln', 'Grere nderung fr Kunde 93: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 94, 'Mller-Ldenscheidt 94', 'Strae 94, Kln', 'Grere nderung fr Kunde 94: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 95, 'Mller-Ldenscheidt 95', 'Strae 95, Kln', 'Grere nderung fr Kunde 95: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 96, 'Mller-Ldenscheidt 96', 'Strae 96, Kln', 'Grere nderung fr Kunde 96: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 97, 'Mller-Ldenscheidt 97', 'Strae 0, Kln', 'Grere nderung fr Kunde 97: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 98, 'Mller-Ldenscheidt 98', 'Strae 1, Kln', 'Grere nderung fr Kunde 98: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 99, 'Mller-Ldenscheidt 99', 'Strae 2, Kln', 'Grere nderung fr Kunde 99: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 100, 'Mller-Ldenscheidt 100', 'Strae 3, Kln', 'Grere nderung fr Kunde 100: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 101, 'Mller-Ldenscheidt 101', 'Strae 4, Kln', 'Grere nderung fr Kunde 101: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 102, 'Mller-Ldenscheidt 102', 'Strae 5, Kln', 'Grere nderung fr Kunde 102: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 103, 'Mller-Ldenscheidt 103', 'Strae 6, Kln', 'Grere nderung fr Kunde 103: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 104, 'Mller-Ldenscheidt 104', 'Strae 7, Kln', 'Grere nderung fr Kunde 104: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 105, 'Mller-Ldenscheidt 105', 'Strae 8, Kln', 'Grere nderung fr Kunde 105: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 106, 'Mller-Ldenscheidt 106', 'Strae 9, Kln', 'Grere nderung fr Kunde 106: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 107, 'Mller-Ldenscheidt 107', 'Strae 10, Kln', 'Grere nderung fr Kunde 107: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 108, 'Mller-Ldenscheidt 108', 'Strae 11, Kln', 'Grere nderung fr Kunde 108: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 109, 'Mller-Ldenscheidt 109', 'Strae 12, Kln', 'Grere nderung fr Kunde 109: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 110, 'Mller-Ldenscheidt 110', 'Strae 13, Kln', 'Grere nderung fr Kunde 110: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 111, 'Mller-Ldenscheidt 111', 'Strae 14, Kln', 'Grere nderung fr Kunde 111: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 112, 'Mller-Ldenscheidt 112', 'Strae 15, Kln', 'Grere nderung fr Kunde 112: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 113, 'Mller-Ldenscheidt 113', 'Strae 16, Kln', 'Grere nderung fr Kunde 113: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 114, 'Mller-Ldenscheidt 114', 'Strae 17, Kln', 'Grere nderung fr Kunde 114: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 115, 'Mller-Ldenscheidt 115', 'Strae 18, Kln', 'Grere nderung fr Kunde 115: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 116, 'Mller-Ldenscheidt 116', 'Strae 19, Kln', 'Grere nderung fr Kunde 116: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 117, 'Mller-Ldenscheidt 117', 'Strae 20, Kln', 'Grere nderung fr Kunde 117: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 118, 'Mller-Ldenscheidt 118', 'Strae 21, Kln', 'Grere nderung fr Kunde 118: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 119, 'Mller-Ldenscheidt 119', 'Strae 22, Kln', 'Grere nderung fr Kunde 119: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 120, 'Mller-Ldenscheidt 120', 'Strae 23, Kln', 'Grere nderung fr Kunde 120: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 121, 'Mller-Ldenscheidt 121', 'Strae 24, Kln', 'Grere nderung fr Kunde 121: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 122, 'Mller-Ldenscheidt 122', 'Strae 25, Kln', 'Grere nderung fr Kunde 122: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 123, 'Mller-Ldenscheidt 123', 'Strae 26, Kln', 'Grere nderung fr Kunde 123: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 124, 'Mller-Ldenscheidt 124', 'Strae 27, Kln', 'Grere nderung fr Kunde 124: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 125, 'Mller-Ldenscheidt 125', 'Strae 28, Kln', 'Grere nderung fr Kunde 125: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 126, 'Mller-Ldenscheidt 126', 'Strae 29, Kln', 'Grere nderung fr Kunde 126: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 127, 'Mller-Ldenscheidt 127', 'Strae 30, Kln', 'Grere nderung fr Kunde 127: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 128, 'Mller-Ldenscheidt 128', 'Strae 31, Kln', 'Grere nderung fr Kunde 128: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 129, 'Mller-Ldenscheidt 129', 'Strae 32, Kln', 'Grere nderung fr Kunde 129: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 130, 'Mller-Ldenscheidt 130', 'Strae 33, Kln', 'Grere nderung fr Kunde 130: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 131, 'Mller-Ldenscheidt 131', 'Strae 34, Kln', 'Grere nderung fr Kunde 131: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 132, 'Mller-Ldenscheidt 132', 'Strae 35, Kln', 'Grere nderung fr Kunde 132: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 133, 'Mller-Ldenscheidt 133', 'Strae 36, Kln', 'Grere nderung fr Kunde 133: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 134, 'Mller-Ldenscheidt 134', 'Strae 37, Kln', 'Grere nderung fr Kunde 134: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 135, 'Mller-Ldenscheidt 135', 'Strae 38, Kln', 'Grere nderung fr Kunde 135: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 136, 'Mller-Ldenscheidt 136', 'Strae 39, Kln', 'Grere nderung fr Kunde 136: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 137, 'Mller-Ldenscheidt 137', 'Strae 40, Kln', 'Grere nderung fr Kunde 137: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 138, 'Mller-Ldenscheidt 138', 'Strae 41, Kln', 'Grere nderung fr Kunde 138: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 139, 'Mller-Ldenscheidt 139', 'Strae 42, Kln', 'Grere nderung fr Kunde 139: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 140, 'Mller-Ldenscheidt 140', 'Strae 43, Kln', 'Grere nderung fr Kunde 140: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 141, 'Mller-Ldenscheidt 141', 'Strae 44, Kln', 'Grere nderung fr Kunde 141: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 142, 'Mller-Ldenscheidt 142', 'Strae 45, Kln', 'Grere nderung fr Kunde 142: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 143, 'Mller-Ldenscheidt 143', 'Strae 46, Kln', 'Grere nderung fr Kunde 143: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 144, 'Mller-Ldenscheidt 144', 'Strae 47, Kln', 'Grere nderung fr Kunde 144: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 145, 'Mller-Ldenscheidt 145', 'Strae 48, Kln', 'Grere nderung fr Kunde 145: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 146, 'Mller-Ldenscheidt 146', 'Strae 49, Kln', 'Grere nderung fr Kunde 146: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 147, 'Mller-Ldenscheidt 147', 'Strae 50, Kln', 'Grere nderung fr Kunde 147: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 148, 'Mller-Ldenscheidt 148', 'Strae 51, Kln', 'Grere nderung fr Kunde 148: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 149, 'Mller-Ldenscheidt 149', 'Strae 52, Kln', 'Grere nderung fr Kunde 149: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 150, 'Mller-Ldenscheidt 150', 'Strae 53, Kln', 'Grere nderung fr Kunde 150: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 151, 'Mller-Ldenscheidt 151', 'Strae 54, Kln', 'Grere nderung fr Kunde 151: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 152, 'Mller-Ldenscheidt 152', 'Strae 55, Kln', 'Grere nderung fr Kunde 152: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 153, 'Mller-Ldenscheidt 153', 'Strae 56, Kln', 'Grere nderung fr Kunde 153: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 154, 'Mller-Ldenscheidt 154', 'Strae 57, Kln', 'Grere nderung fr Kunde 154: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 155, 'Mller-Ldenscheidt 155', 'Strae 58, Kln', 'Grere nderung fr Kunde 155: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 156, 'Mller-Ldenscheidt 156', 'Strae 59, Kln', 'Grere nderung fr Kunde 156: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 157, 'Mller-Ldenscheidt 157', 'Strae 60, Kln', 'Grere nderung fr Kunde 157: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 158, 'Mller-Ldenscheidt 158', 'Strae 61, Kln', 'Grere nderung fr Kunde 158: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 159, 'Mller-Ldenscheidt 159', 'Strae 62, Kln', 'Grere nderung fr Kunde 159: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 160, 'Mller-Ldenscheidt 160', 'Strae 63, Kln', 'Grere nderung fr Kunde 160: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 161, 'Mller-Ldenscheidt 161', 'Strae 64, Kln', 'Grere nderung fr Kunde 161: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 162, 'Mller-Ldenscheidt 162', 'Strae 65, Kln', 'Grere nderung fr Kunde 162: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 163, 'Mller-Ldenscheidt 163', 'Strae 66, Kln', 'Grere nderung fr Kunde 163: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 164, 'Mller-Ldenscheidt 164', 'Strae 67, Kln', 'Grere nderung fr Kunde 164: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 165, 'Mller-Ldenscheidt 165', 'Strae 68, Kln', 'Grere nderung fr Kunde 165: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 166, 'Mller-Ldenscheidt 166', 'Strae 69, Kln', 'Grere nderung fr Kunde 166: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 167, 'Mller-Ldenscheidt 167', 'Strae 70, Kln', 'Grere nderung fr Kunde 167: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 168, 'Mller-Ldenscheidt 168', 'Strae 71, Kln', 'Grere nderung fr Kunde 168: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 169, 'Mller-Ldenscheidt 169', 'Strae 72, Kln', 'Grere nderung fr Kunde 169: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 170, 'Mller-Ldenscheidt 170', 'Strae 73, Kln', 'Grere nderung fr Kunde 170: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 171, 'Mller-Ldenscheidt 171', 'Strae 74, Kln', 'Grere nderung fr Kunde 171: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 172, 'Mller-Ldenscheidt 172', 'Strae 75, Kln', 'Grere nderung fr Kunde 172: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 173, 'Mller-Ldenscheidt 173', 'Strae 76, Kln', 'Grere nderung fr Kunde 173: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 174, 'Mller-Ldenscheidt 174', 'Strae 77, Kln', 'Grere nderung fr Kunde 174: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 175, 'Mller-Ldenscheidt 175', 'Strae 78, Kln', 'Grere nderung fr Kunde 175: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 176, 'Mller-Ldenscheidt 176', 'Strae 79, Kln', 'Grere nderung fr Kunde 176: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 177, 'Mller-Ldenscheidt 177', 'Strae 80, Kln', 'Grere nderung fr Kunde 177: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 178, 'Mller-Ldenscheidt 178', 'Strae 81, Kln', 'Grere nderung fr Kunde 178: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 179, 'Mller-Ldenscheidt 179', 'Strae 82, Kln', 'Grere nderung fr Kunde 179: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 180, 'Mller-Ldenscheidt 180', 'Strae 83, Kln', 'Grere nderung fr Kunde 180: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 181, 'Mller-Ldenscheidt 181', 'Strae 84, Kln', 'Grere nderung fr Kunde 181: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 182, 'Mller-Ldenscheidt 182', 'Strae 85, Kln', 'Grere nderung fr Kunde 182: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 183, 'Mller-Ldenscheidt 183', 'Strae 86, Kln', 'Grere nderung fr Kunde 183: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 184, 'Mller-Ldenscheidt 184', 'Strae 87, Kln', 'Grere nderung fr Kunde 184: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 185, 'Mller-Ldenscheidt 185', 'Strae 88, Kln', 'Grere nderung fr Kunde 185: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 186, 'Mller-Ldenscheidt 186', 'Strae 89, Kln', 'Grere nderung fr Kunde 186: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 187, 'Mller-Ldenscheidt 187', 'Strae 90, Kln', 'Grere nderung fr Kunde 187: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 188, 'Mller-Ldenscheidt 188', 'Strae 91, Kln', 'Grere nderung fr Kunde 188: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 189, 'Mller-Ldenscheidt 189', 'Strae 92, Kln', 'Grere nderung fr Kunde 189: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 190, 'Mller-Ldenscheidt 190', 'Strae 93, Kln', 'Grere nderung fr Kunde 190: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 191, 'Mller-Ldenscheidt 191', 'Strae 94, Kln', 'Grere nderung fr Kunde 191: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 192, 'Mller-Ldenscheidt 192', 'Strae 95, Kln', 'Grere nderung fr Kunde 192: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 193, 'Mller-Ldenscheidt 193', 'Strae 96, Kln', 'Grere nderung fr Kunde 193: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 194, 'Mller-Ldenscheidt 194', 'Strae 0, Kln', 'Grere nderung fr Kunde 194: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 195, 'Mller-Ldenscheidt 195', 'Strae 1, Kln', 'Grere nderung fr Kunde 195: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 196, 'Mller-Ldenscheidt 196', 'Strae 2, Kln', 'Grere nderung fr Kunde 196: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 197, 'Mller-Ldenscheidt 197', 'Strae 3, Kln', 'Grere nderung fr Kunde 197: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 198, 'Mller-Ldenscheidt 198', 'Strae 4, Kln', 'Grere nderung fr Kunde 198: bergabe am Montag, Preis 12 EUR' );
+insert into kunde( id, name, ort, bemerkung ) values ( 199, 'Mller-Ldenscheidt 199', 'Strae 5, Kln', 'Grere nderung fr Kunde 199: bergabe am Montag, Preis 12 EUR' );
@@ -0,0 +1,57 @@
+/*
+** @file
+** @brief Benchmark input: Header with an include guard.
+*/
+#ifndef GUARDED_H
+#define GUARDED_H
+#define COLUMN_1 col_1
+#define COLUMN_2 col_2
+#define COLUMN_3 col_3
+#define COLUMN_4 col_4
+#define COLUMN_5 col_5
+#define COLUMN_6 col_6
+#define COLUMN_7 col_7
+#define COLUMN_8 col_8
+#define COLUMN_9 col_9
+#define COLUMN_10 col_10
+#define COLUMN_11 col_11
+#define COLUMN_12 col_12
+#define COLUMN_13 col_13
+#define COLUMN_14 col_14
+#define COLUMN_15 col_15
+#define COLUMN_16 col_16
+#define COLUMN_17 col_17
+#define COLUMN_18 col_18
+#define COLUMN_19 col_19
+#define COLUMN_20 col_20
+#define COLUMN_21 col_21
+#define COLUMN_22 col_22
+#define COLUMN_23 col_23
+#define COLUMN_24 col_24
+#define COLUMN_25 col_25
+#define COLUMN_26 col_26
+#define COLUMN_27 col_27
+#define COLUMN_28 col_28
+#define COLUMN_29 col_29
+#define COLUMN_30 col_30
+#define COLUMN_31 col_31
+#define COLUMN_32 col_32
+#define COLUMN_33 col_33
+#define COLUMN_34 col_34
+#define COLUMN_35 col_35
+#define COLUMN_36 col_36
+#define COLUMN_37 col_37
+#define COLUMN_38 col_38
+#define COLUMN_39 col_39
+#define COLUMN_40 col_40
+#define COLUMN_41 col_41
+#define COLUMN_42 col_42
+#define COLUMN_43 col_43
+#define COLUMN_44 col_44
+#define COLUMN_45 col_45
+#define COLUMN_46 col_46
+#define COLUMN_47 col_47
+#define COLUMN_48 col_48
+#define COLUMN_49 col_49
+#define COLUMN_50 col_50
+#endif // GUARDED_H
@@ -0,0 +1,81 @@
+-- Benchmark input: Plain SQL repeated to build a large input file (see benchmark_sqtpp.ps1 -large).
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1001, 1, 'P-0001', 2, 3.50 );
+update product set stock = stock - 2 where product_id = 'P-0001'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1002, 2, 'P-0002', 3, 6.50 );
+update product set stock = stock - 3 where product_id = 'P-0002'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1003, 3, 'P-0003', 4, 9.50 );
+update product set stock = stock - 4 where product_id = 'P-0003'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1004, 4, 'P-0004', 5, 12.50 );
+update product set stock = stock - 5 where product_id = 'P-0004'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1005, 5, 'P-0005', 6, 15.50 );
+update product set stock = stock - 6 where product_id = 'P-0005'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1006, 6, 'P-0006', 7, 18.50 );
+update product set stock = stock - 7 where product_id = 'P-0006'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1007, 7, 'P-0007', 1, 21.50 );
+update product set stock = stock - 1 where product_id = 'P-0007'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1008, 8, 'P-0008', 2, 24.50 );
+update product set stock = stock - 2 where product_id = 'P-0008'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1009, 9, 'P-0009', 3, 27.50 );
+update product set stock = stock - 3 where product_id = 'P-0009'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1010, 10, 'P-0010', 4, 30.50 );
+update product set stock = stock - 4 where product_id = 'P-0010'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1011, 11, 'P-0011', 5, 33.50 );
+update product set stock = stock - 5 where product_id = 'P-0011'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1012, 12, 'P-0012', 6, 36.50 );
+update product set stock = stock - 6 where product_id = 'P-0012'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1013, 13, 'P-0013', 7, 39.50 );
+update product set stock = stock - 7 where product_id = 'P-0013'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1014, 14, 'P-0014', 1, 42.50 );
+update product set stock = stock - 1 where product_id = 'P-0014'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1015, 15, 'P-0015', 2, 45.50 );
+update product set stock = stock - 2 where product_id = 'P-0015'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1016, 16, 'P-0016', 3, 48.50 );
+update product set stock = stock - 3 where product_id = 'P-0016'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1017, 17, 'P-0017', 4, 51.50 );
+update product set stock = stock - 4 where product_id = 'P-0017'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1018, 18, 'P-0018', 5, 54.50 );
+update product set stock = stock - 5 where product_id = 'P-0018'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1019, 19, 'P-0019', 6, 57.50 );
+update product set stock = stock - 6 where product_id = 'P-0019'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1020, 20, 'P-0020', 7, 60.50 );
+update product set stock = stock - 7 where product_id = 'P-0020'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1021, 21, 'P-0021', 1, 63.50 );
+update product set stock = stock - 1 where product_id = 'P-0021'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1022, 22, 'P-0022', 2, 66.50 );
+update product set stock = stock - 2 where product_id = 'P-0022'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1023, 23, 'P-0023', 3, 69.50 );
+update product set stock = stock - 3 where product_id = 'P-0023'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1024, 24, 'P-0024', 4, 72.50 );
+update product set stock = stock - 4 where product_id = 'P-0024'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1025, 25, 'P-0025', 5, 75.50 );
+update product set stock = stock - 5 where product_id = 'P-0025'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1026, 26, 'P-0026', 6, 78.50 );
+update product set stock = stock - 6 where product_id = 'P-0026'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1027, 27, 'P-0027', 7, 81.50 );
+update product set stock = stock - 7 where product_id = 'P-0027'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1028, 28, 'P-0028', 1, 84.50 );
+update product set stock = stock - 1 where product_id = 'P-0028'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1029, 29, 'P-0029', 2, 87.50 );
+update product set stock = stock - 2 where product_id = 'P-0029'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1030, 30, 'P-0030', 3, 90.50 );
+update product set stock = stock - 3 where product_id = 'P-0030'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1031, 31, 'P-0031', 4, 93.50 );
+update product set stock = stock - 4 where product_id = 'P-0031'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1032, 32, 'P-0032', 5, 96.50 );
+update product set stock = stock - 5 where product_id = 'P-0032'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1033, 33, 'P-0033', 6, 99.50 );
+update product set stock = stock - 6 where product_id = 'P-0033'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1034, 34, 'P-0034', 7, 102.50 );
+update product set stock = stock - 7 where product_id = 'P-0034'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1035, 35, 'P-0035', 1, 105.50 );
+update product set stock = stock - 1 where product_id = 'P-0035'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1036, 36, 'P-0036', 2, 108.50 );
+update product set stock = stock - 2 where product_id = 'P-0036'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1037, 37, 'P-0037', 3, 111.50 );
+update product set stock = stock - 3 where product_id = 'P-0037'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1038, 38, 'P-0038', 4, 114.50 );
+update product set stock = stock - 4 where product_id = 'P-0038'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1039, 39, 'P-0039', 5, 117.50 );
+update product set stock = stock - 5 where product_id = 'P-0039'; -- keep stock in sync
+insert into order_line ( order_id, line_no, product_id, quantity, price ) values ( 1040, 40, 'P-0040', 6, 120.50 );
+update product set stock = stock - 6 where product_id = 'P-0040'; -- keep stock in sync
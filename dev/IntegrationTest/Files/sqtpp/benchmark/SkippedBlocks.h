@@ -0,0 +1,1112 @@
+/*
+** @file
+** @brief Benchmark input: Large conditional blocks which are skipped.
+*/
+#ifdef TRACE_ENABLED
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_1', 1, 'trace step 1' );
+-- # trace point 1
+#else
+select 'trace 1' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_2', 2, 'trace step 2' );
+-- # trace point 2
+#else
+select 'trace 2' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_3', 3, 'trace step 3' );
+-- # trace point 3
+#else
+select 'trace 3' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_4', 4, 'trace step 4' );
+-- # trace point 4
+#else
+select 'trace 4' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_5', 5, 'trace step 5' );
+-- # trace point 5
+#else
+select 'trace 5' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_6', 6, 'trace step 6' );
+-- # trace point 6
+#else
+select 'trace 6' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_7', 7, 'trace step 7' );
+-- # trace point 7
+#else
+select 'trace 7' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_8', 8, 'trace step 8' );
+-- # trace point 8
+#else
+select 'trace 8' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_9', 9, 'trace step 9' );
+-- # trace point 9
+#else
+select 'trace 9' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_10', 10, 'trace step 10' );
+-- # trace point 10
+#else
+select 'trace 10' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_11', 11, 'trace step 11' );
+-- # trace point 11
+#else
+select 'trace 11' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_12', 12, 'trace step 12' );
+-- # trace point 12
+#else
+select 'trace 12' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_13', 13, 'trace step 13' );
+-- # trace point 13
+#else
+select 'trace 13' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_14', 14, 'trace step 14' );
+-- # trace point 14
+#else
+select 'trace 14' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_15', 15, 'trace step 15' );
+-- # trace point 15
+#else
+select 'trace 15' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_16', 16, 'trace step 16' );
+-- # trace point 16
+#else
+select 'trace 16' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_17', 17, 'trace step 17' );
+-- # trace point 17
+#else
+select 'trace 17' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_18', 18, 'trace step 18' );
+-- # trace point 18
+#else
+select 'trace 18' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_19', 19, 'trace step 19' );
+-- # trace point 19
+#else
+select 'trace 19' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_20', 20, 'trace step 20' );
+-- # trace point 20
+#else
+select 'trace 20' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_21', 21, 'trace step 21' );
+-- # trace point 21
+#else
+select 'trace 21' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_22', 22, 'trace step 22' );
+-- # trace point 22
+#else
+select 'trace 22' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_23', 23, 'trace step 23' );
+-- # trace point 23
+#else
+select 'trace 23' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_24', 24, 'trace step 24' );
+-- # trace point 24
+#else
+select 'trace 24' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_25', 25, 'trace step 25' );
+-- # trace point 25
+#else
+select 'trace 25' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_26', 26, 'trace step 26' );
+-- # trace point 26
+#else
+select 'trace 26' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_27', 27, 'trace step 27' );
+-- # trace point 27
+#else
+select 'trace 27' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_28', 28, 'trace step 28' );
+-- # trace point 28
+#else
+select 'trace 28' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_29', 29, 'trace step 29' );
+-- # trace point 29
+#else
+select 'trace 29' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_30', 30, 'trace step 30' );
+-- # trace point 30
+#else
+select 'trace 30' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_31', 31, 'trace step 31' );
+-- # trace point 31
+#else
+select 'trace 31' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_32', 32, 'trace step 32' );
+-- # trace point 32
+#else
+select 'trace 32' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_33', 33, 'trace step 33' );
+-- # trace point 33
+#else
+select 'trace 33' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_34', 34, 'trace step 34' );
+-- # trace point 34
+#else
+select 'trace 34' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_35', 35, 'trace step 35' );
+-- # trace point 35
+#else
+select 'trace 35' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_36', 36, 'trace step 36' );
+-- # trace point 36
+#else
+select 'trace 36' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_37', 37, 'trace step 37' );
+-- # trace point 37
+#else
+select 'trace 37' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_38', 38, 'trace step 38' );
+-- # trace point 38
+#else
+select 'trace 38' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_39', 39, 'trace step 39' );
+-- # trace point 39
+#else
+select 'trace 39' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_40', 40, 'trace step 40' );
+-- # trace point 40
+#else
+select 'trace 40' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_41', 41, 'trace step 41' );
+-- # trace point 41
+#else
+select 'trace 41' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_42', 42, 'trace step 42' );
+-- # trace point 42
+#else
+select 'trace 42' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_43', 43, 'trace step 43' );
+-- # trace point 43
+#else
+select 'trace 43' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_44', 44, 'trace step 44' );
+-- # trace point 44
+#else
+select 'trace 44' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_45', 45, 'trace step 45' );
+-- # trace point 45
+#else
+select 'trace 45' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_46', 46, 'trace step 46' );
+-- # trace point 46
+#else
+select 'trace 46' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_47', 47, 'trace step 47' );
+-- # trace point 47
+#else
+select 'trace 47' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_48', 48, 'trace step 48' );
+-- # trace point 48
+#else
+select 'trace 48' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_49', 49, 'trace step 49' );
+-- # trace point 49
+#else
+select 'trace 49' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_50', 50, 'trace step 50' );
+-- # trace point 50
+#else
+select 'trace 50' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_51', 51, 'trace step 51' );
+-- # trace point 51
+#else
+select 'trace 51' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_52', 52, 'trace step 52' );
+-- # trace point 52
+#else
+select 'trace 52' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_53', 53, 'trace step 53' );
+-- # trace point 53
+#else
+select 'trace 53' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_54', 54, 'trace step 54' );
+-- # trace point 54
+#else
+select 'trace 54' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_55', 55, 'trace step 55' );
+-- # trace point 55
+#else
+select 'trace 55' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_56', 56, 'trace step 56' );
+-- # trace point 56
+#else
+select 'trace 56' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_57', 57, 'trace step 57' );
+-- # trace point 57
+#else
+select 'trace 57' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_58', 58, 'trace step 58' );
+-- # trace point 58
+#else
+select 'trace 58' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_59', 59, 'trace step 59' );
+-- # trace point 59
+#else
+select 'trace 59' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_60', 60, 'trace step 60' );
+-- # trace point 60
+#else
+select 'trace 60' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_61', 61, 'trace step 61' );
+-- # trace point 61
+#else
+select 'trace 61' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_62', 62, 'trace step 62' );
+-- # trace point 62
+#else
+select 'trace 62' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_63', 63, 'trace step 63' );
+-- # trace point 63
+#else
+select 'trace 63' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_64', 64, 'trace step 64' );
+-- # trace point 64
+#else
+select 'trace 64' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_65', 65, 'trace step 65' );
+-- # trace point 65
+#else
+select 'trace 65' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_66', 66, 'trace step 66' );
+-- # trace point 66
+#else
+select 'trace 66' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_67', 67, 'trace step 67' );
+-- # trace point 67
+#else
+select 'trace 67' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_68', 68, 'trace step 68' );
+-- # trace point 68
+#else
+select 'trace 68' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_69', 69, 'trace step 69' );
+-- # trace point 69
+#else
+select 'trace 69' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_70', 70, 'trace step 70' );
+-- # trace point 70
+#else
+select 'trace 70' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_71', 71, 'trace step 71' );
+-- # trace point 71
+#else
+select 'trace 71' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_72', 72, 'trace step 72' );
+-- # trace point 72
+#else
+select 'trace 72' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_73', 73, 'trace step 73' );
+-- # trace point 73
+#else
+select 'trace 73' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_74', 74, 'trace step 74' );
+-- # trace point 74
+#else
+select 'trace 74' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_75', 75, 'trace step 75' );
+-- # trace point 75
+#else
+select 'trace 75' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_76', 76, 'trace step 76' );
+-- # trace point 76
+#else
+select 'trace 76' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_77', 77, 'trace step 77' );
+-- # trace point 77
+#else
+select 'trace 77' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_78', 78, 'trace step 78' );
+-- # trace point 78
+#else
+select 'trace 78' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_79', 79, 'trace step 79' );
+-- # trace point 79
+#else
+select 'trace 79' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_80', 80, 'trace step 80' );
+-- # trace point 80
+#else
+select 'trace 80' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_81', 81, 'trace step 81' );
+-- # trace point 81
+#else
+select 'trace 81' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_82', 82, 'trace step 82' );
+-- # trace point 82
+#else
+select 'trace 82' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_83', 83, 'trace step 83' );
+-- # trace point 83
+#else
+select 'trace 83' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_84', 84, 'trace step 84' );
+-- # trace point 84
+#else
+select 'trace 84' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_85', 85, 'trace step 85' );
+-- # trace point 85
+#else
+select 'trace 85' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_86', 86, 'trace step 86' );
+-- # trace point 86
+#else
+select 'trace 86' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_87', 87, 'trace step 87' );
+-- # trace point 87
+#else
+select 'trace 87' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_88', 88, 'trace step 88' );
+-- # trace point 88
+#else
+select 'trace 88' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_89', 89, 'trace step 89' );
+-- # trace point 89
+#else
+select 'trace 89' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_90', 90, 'trace step 90' );
+-- # trace point 90
+#else
+select 'trace 90' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_91', 91, 'trace step 91' );
+-- # trace point 91
+#else
+select 'trace 91' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_92', 92, 'trace step 92' );
+-- # trace point 92
+#else
+select 'trace 92' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_93', 93, 'trace step 93' );
+-- # trace point 93
+#else
+select 'trace 93' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_94', 94, 'trace step 94' );
+-- # trace point 94
+#else
+select 'trace 94' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_95', 95, 'trace step 95' );
+-- # trace point 95
+#else
+select 'trace 95' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 1
+insert into trace_log( proc_name, step, message ) values ( 'proc_96', 96, 'trace step 96' );
+-- # trace point 96
+#else
+select 'trace 96' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 2
+insert into trace_log( proc_name, step, message ) values ( 'proc_97', 97, 'trace step 97' );
+-- # trace point 97
+#else
+select 'trace 97' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 3
+insert into trace_log( proc_name, step, message ) values ( 'proc_98', 98, 'trace step 98' );
+-- # trace point 98
+#else
+select 'trace 98' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 4
+insert into trace_log( proc_name, step, message ) values ( 'proc_99', 99, 'trace step 99' );
+-- # trace point 99
+#else
+select 'trace 99' as message, getdate() as logged_at from dual;
+#endif
+#if TRACE_LEVEL > 0
+insert into trace_log( proc_name, step, message ) values ( 'proc_100', 100, 'trace step 100' );
+-- # trace point 100
+#else
+select 'trace 100' as message, getdate() as logged_at from dual;
+#endif
+#else
+select col_1, count(*) as cnt_1 from table_1 where id_1 > 1 group by col_1;
+select col_2, count(*) as cnt_2 from table_2 where id_2 > 2 group by col_2;
+select col_3, count(*) as cnt_3 from table_3 where id_3 > 3 group by col_3;
+select col_4, count(*) as cnt_4 from table_4 where id_4 > 4 group by col_4;
+select col_5, count(*) as cnt_5 from table_5 where id_5 > 5 group by col_5;
+select col_6, count(*) as cnt_6 from table_6 where id_6 > 6 group by col_6;
+select col_7, count(*) as cnt_7 from table_7 where id_7 > 7 group by col_7;
+select col_8, count(*) as cnt_8 from table_8 where id_8 > 8 group by col_8;
+select col_9, count(*) as cnt_9 from table_9 where id_9 > 9 group by col_9;
+select col_10, count(*) as cnt_10 from table_10 where id_10 > 10 group by col_10;
+select col_11, count(*) as cnt_11 from table_11 where id_11 > 11 group by col_11;
+select col_12, count(*) as cnt_12 from table_12 where id_12 > 12 group by col_12;
+select col_13, count(*) as cnt_13 from table_13 where id_13 > 13 group by col_13;
+select col_14, count(*) as cnt_14 from table_14 where id_14 > 14 group by col_14;
+select col_15, count(*) as cnt_15 from table_15 where id_15 > 15 group by col_15;
+select col_16, count(*) as cnt_16 from table_16 where id_16 > 16 group by col_16;
+select col_17, count(*) as cnt_17 from table_17 where id_17 > 17 group by col_17;
+select col_18, count(*) as cnt_18 from table_18 where id_18 > 18 group by col_18;
+select col_19, count(*) as cnt_19 from table_19 where id_19 > 19 group by col_19;
+select col_20, count(*) as cnt_20 from table_20 where id_20 > 20 group by col_20;
+select col_21, count(*) as cnt_21 from table_21 where id_21 > 21 group by col_21;
+select col_22, count(*) as cnt_22 from table_22 where id_22 > 22 group by col_22;
+select col_23, count(*) as cnt_23 from table_23 where id_23 > 23 group by col_23;
+select col_24, count(*) as cnt_24 from table_24 where id_24 > 24 group by col_24;
+select col_25, count(*) as cnt_25 from table_25 where id_25 > 25 group by col_25;
+select col_26, count(*) as cnt_26 from table_26 where id_26 > 26 group by col_26;
+select col_27, count(*) as cnt_27 from table_27 where id_27 > 27 group by col_27;
+select col_28, count(*) as cnt_28 from table_28 where id_28 > 28 group by col_28;
+select col_29, count(*) as cnt_29 from table_29 where id_29 > 29 group by col_29;
+select col_30, count(*) as cnt_30 from table_30 where id_30 > 30 group by col_30;
+select col_31, count(*) as cnt_31 from table_31 where id_31 > 31 group by col_31;
+select col_32, count(*) as cnt_32 from table_32 where id_32 > 32 group by col_32;
+select col_33, count(*) as cnt_33 from table_33 where id_33 > 33 group by col_33;
+select col_34, count(*) as cnt_34 from table_34 where id_34 > 34 group by col_34;
+select col_35, count(*) as cnt_35 from table_35 where id_35 > 35 group by col_35;
+select col_36, count(*) as cnt_36 from table_36 where id_36 > 36 group by col_36;
+select col_37, count(*) as cnt_37 from table_37 where id_37 > 37 group by col_37;
+select col_38, count(*) as cnt_38 from table_38 where id_38 > 38 group by col_38;
+select col_39, count(*) as cnt_39 from table_39 where id_39 > 39 group by col_39;
+select col_40, count(*) as cnt_40 from table_40 where id_40 > 40 group by col_40;
+select col_41, count(*) as cnt_41 from table_41 where id_41 > 41 group by col_41;
+select col_42, count(*) as cnt_42 from table_42 where id_42 > 42 group by col_42;
+select col_43, count(*) as cnt_43 from table_43 where id_43 > 43 group by col_43;
+select col_44, count(*) as cnt_44 from table_44 where id_44 > 44 group by col_44;
+select col_45, count(*) as cnt_45 from table_45 where id_45 > 45 group by col_45;
+select col_46, count(*) as cnt_46 from table_46 where id_46 > 46 group by col_46;
+select col_47, count(*) as cnt_47 from table_47 where id_47 > 47 group by col_47;
+select col_48, count(*) as cnt_48 from table_48 where id_48 > 48 group by col_48;
+select col_49, count(*) as cnt_49 from table_49 where id_49 > 49 group by col_49;
+select col_50, count(*) as cnt_50 from table_50 where id_50 > 50 group by col_50;
+select col_51, count(*) as cnt_51 from table_51 where id_51 > 51 group by col_51;
+select col_52, count(*) as cnt_52 from table_52 where id_52 > 52 group by col_52;
+select col_53, count(*) as cnt_53 from table_53 where id_53 > 53 group by col_53;
+select col_54, count(*) as cnt_54 from table_54 where id_54 > 54 group by col_54;
+select col_55, count(*) as cnt_55 from table_55 where id_55 > 55 group by col_55;
+select col_56, count(*) as cnt_56 from table_56 where id_56 > 56 group by col_56;
+select col_57, count(*) as cnt_57 from table_57 where id_57 > 57 group by col_57;
+select col_58, count(*) as cnt_58 from table_58 where id_58 > 58 group by col_58;
+select col_59, count(*) as cnt_59 from table_59 where id_59 > 59 group by col_59;
+select col_60, count(*) as cnt_60 from table_60 where id_60 > 60 group by col_60;
+select col_61, count(*) as cnt_61 from table_61 where id_61 > 61 group by col_61;
+select col_62, count(*) as cnt_62 from table_62 where id_62 > 62 group by col_62;
+select col_63, count(*) as cnt_63 from table_63 where id_63 > 63 group by col_63;
+select col_64, count(*) as cnt_64 from table_64 where id_64 > 64 group by col_64;
+select col_65, count(*) as cnt_65 from table_65 where id_65 > 65 group by col_65;
+select col_66, count(*) as cnt_66 from table_66 where id_66 > 66 group by col_66;
+select col_67, count(*) as cnt_67 from table_67 where id_67 > 67 group by col_67;
+select col_68, count(*) as cnt_68 from table_68 where id_68 > 68 group by col_68;
+select col_69, count(*) as cnt_69 from table_69 where id_69 > 69 group by col_69;
+select col_70, count(*) as cnt_70 from table_70 where id_70 > 70 group by col_70;
+select col_71, count(*) as cnt_71 from table_71 where id_71 > 71 group by col_71;
+select col_72, count(*) as cnt_72 from table_72 where id_72 > 72 group by col_72;
+select col_73, count(*) as cnt_73 from table_73 where id_73 > 73 group by col_73;
+select col_74, count(*) as cnt_74 from table_74 where id_74 > 74 group by col_74;
+select col_75, count(*) as cnt_75 from table_75 where id_75 > 75 group by col_75;
+select col_76, count(*) as cnt_76 from table_76 where id_76 > 76 group by col_76;
+select col_77, count(*) as cnt_77 from table_77 where id_77 > 77 group by col_77;
+select col_78, count(*) as cnt_78 from table_78 where id_78 > 78 group by col_78;
+select col_79, count(*) as cnt_79 from table_79 where id_79 > 79 group by col_79;
+select col_80, count(*) as cnt_80 from table_80 where id_80 > 80 group by col_80;
+select col_81, count(*) as cnt_81 from table_81 where id_81 > 81 group by col_81;
+select col_82, count(*) as cnt_82 from table_82 where id_82 > 82 group by col_82;
+select col_83, count(*) as cnt_83 from table_83 where id_83 > 83 group by col_83;
+select col_84, count(*) as cnt_84 from table_84 where id_84 > 84 group by col_84;
+select col_85, count(*) as cnt_85 from table_85 where id_85 > 85 group by col_85;
+select col_86, count(*) as cnt_86 from table_86 where id_86 > 86 group by col_86;
+select col_87, count(*) as cnt_87 from table_87 where id_87 > 87 group by col_87;
+select col_88, count(*) as cnt_88 from table_88 where id_88 > 88 group by col_88;
+select col_89, count(*) as cnt_89 from table_89 where id_89 > 89 group by col_89;
+select col_90, count(*) as cnt_90 from table_90 where id_90 > 90 group by col_90;
+select col_91, count(*) as cnt_91 from table_91 where id_91 > 91 group by col_91;
+select col_92, count(*) as cnt_92 from table_92 where id_92 > 92 group by col_92;
+select col_93, count(*) as cnt_93 from table_93 where id_93 > 93 group by col_93;
+select col_94, count(*) as cnt_94 from table_94 where id_94 > 94 group by col_94;
+select col_95, count(*) as cnt_95 from table_95 where id_95 > 95 group by col_95;
+select col_96, count(*) as cnt_96 from table_96 where id_96 > 96 group by col_96;
+select col_97, count(*) as cnt_97 from table_97 where id_97 > 97 group by col_97;
+select col_98, count(*) as cnt_98 from table_98 where id_98 > 98 group by col_98;
+select col_99, count(*) as cnt_99 from table_99 where id_99 > 99 group by col_99;
+select col_100, count(*) as cnt_100 from table_100 where id_100 > 100 group by col_100;
+#endif
+#if defined( LEGACY_SCHEMA )
+alter table legacy_1 add column migrated_1 int default 0 not null;
+alter table legacy_2 add column migrated_2 int default 0 not null;
+alter table legacy_3 add column migrated_3 int default 0 not null;
+alter table legacy_4 add column migrated_4 int default 0 not null;
+alter table legacy_5 add column migrated_5 int default 0 not null;
+alter table legacy_6 add column migrated_6 int default 0 not null;
+alter table legacy_7 add column migrated_7 int default 0 not null;
+alter table legacy_8 add column migrated_8 int default 0 not null;
+alter table legacy_9 add column migrated_9 int default 0 not null;
+alter table legacy_10 add column migrated_10 int default 0 not null;
+alter table legacy_11 add column migrated_11 int default 0 not null;
+alter table legacy_12 add column migrated_12 int default 0 not null;
+alter table legacy_13 add column migrated_13 int default 0 not null;
+alter table legacy_14 add column migrated_14 int default 0 not null;
+alter table legacy_15 add column migrated_15 int default 0 not null;
+alter table legacy_16 add column migrated_16 int default 0 not null;
+alter table legacy_17 add column migrated_17 int default 0 not null;
+alter table legacy_18 add column migrated_18 int default 0 not null;
+alter table legacy_19 add column migrated_19 int default 0 not null;
+alter table legacy_20 add column migrated_20 int default 0 not null;
+alter table legacy_21 add column migrated_21 int default 0 not null;
+alter table legacy_22 add column migrated_22 int default 0 not null;
+alter table legacy_23 add column migrated_23 int default 0 not null;
+alter table legacy_24 add column migrated_24 int default 0 not null;
+alter table legacy_25 add column migrated_25 int default 0 not null;
+alter table legacy_26 add column migrated_26 int default 0 not null;
+alter table legacy_27 add column migrated_27 int default 0 not null;
+alter table legacy_28 add column migrated_28 int default 0 not null;
+alter table legacy_29 add column migrated_29 int default 0 not null;
+alter table legacy_30 add column migrated_30 int default 0 not null;
+alter table legacy_31 add column migrated_31 int default 0 not null;
+alter table legacy_32 add column migrated_32 int default 0 not null;
+alter table legacy_33 add column migrated_33 int default 0 not null;
+alter table legacy_34 add column migrated_34 int default 0 not null;
+alter table legacy_35 add column migrated_35 int default 0 not null;
+alter table legacy_36 add column migrated_36 int default 0 not null;
+alter table legacy_37 add column migrated_37 int default 0 not null;
+alter table legacy_38 add column migrated_38 int default 0 not null;
+alter table legacy_39 add column migrated_39 int default 0 not null;
+alter table legacy_40 add column migrated_40 int default 0 not null;
+alter table legacy_41 add column migrated_41 int default 0 not null;
+alter table legacy_42 add column migrated_42 int default 0 not null;
+alter table legacy_43 add column migrated_43 int default 0 not null;
+alter table legacy_44 add column migrated_44 int default 0 not null;
+alter table legacy_45 add column migrated_45 int default 0 not null;
+alter table legacy_46 add column migrated_46 int default 0 not null;
+alter table legacy_47 add column migrated_47 int default 0 not null;
+alter table legacy_48 add column migrated_48 int default 0 not null;
+alter table legacy_49 add column migrated_49 int default 0 not null;
+alter table legacy_50 add column migrated_50 int default 0 not null;
+alter table legacy_51 add column migrated_51 int default 0 not null;
+alter table legacy_52 add column migrated_52 int default 0 not null;
+alter table legacy_53 add column migrated_53 int default 0 not null;
+alter table legacy_54 add column migrated_54 int default 0 not null;
+alter table legacy_55 add column migrated_55 int default 0 not null;
+alter table legacy_56 add column migrated_56 int default 0 not null;
+alter table legacy_57 add column migrated_57 int default 0 not null;
+alter table legacy_58 add column migrated_58 int default 0 not null;
+alter table legacy_59 add column migrated_59 int default 0 not null;
+alter table legacy_60 add column migrated_60 int default 0 not null;
+alter table legacy_61 add column migrated_61 int default 0 not null;
+alter table legacy_62 add column migrated_62 int default 0 not null;
+alter table legacy_63 add column migrated_63 int default 0 not null;
+alter table legacy_64 add column migrated_64 int default 0 not null;
+alter table legacy_65 add column migrated_65 int default 0 not null;
+alter table legacy_66 add column migrated_66 int default 0 not null;
+alter table legacy_67 add column migrated_67 int default 0 not null;
+alter table legacy_68 add column migrated_68 int default 0 not null;
+alter table legacy_69 add column migrated_69 int default 0 not null;
+alter table legacy_70 add column migrated_70 int default 0 not null;
+alter table legacy_71 add column migrated_71 int default 0 not null;
+alter table legacy_72 add column migrated_72 int default 0 not null;
+alter table legacy_73 add column migrated_73 int default 0 not null;
+alter table legacy_74 add column migrated_74 int default 0 not null;
+alter table legacy_75 add column migrated_75 int default 0 not null;
+alter table legacy_76 add column migrated_76 int default 0 not null;
+alter table legacy_77 add column migrated_77 int default 0 not null;
+alter table legacy_78 add column migrated_78 int default 0 not null;
+alter table legacy_79 add column migrated_79 int default 0 not null;
+alter table legacy_80 add column migrated_80 int default 0 not null;
+alter table legacy_81 add column migrated_81 int default 0 not null;
+alter table legacy_82 add column migrated_82 int default 0 not null;
+alter table legacy_83 add column migrated_83 int default 0 not null;
+alter table legacy_84 add column migrated_84 int default 0 not null;
+alter table legacy_85 add column migrated_85 int default 0 not null;
+alter table legacy_86 add column migrated_86 int default 0 not null;
+alter table legacy_87 add column migrated_87 int default 0 not null;
+alter table legacy_88 add column migrated_88 int default 0 not null;
+alter table legacy_89 add column migrated_89 int default 0 not null;
+alter table legacy_90 add column migrated_90 int default 0 not null;
+alter table legacy_91 add column migrated_91 int default 0 not null;
+alter table legacy_92 add column migrated_92 int default 0 not null;
+alter table legacy_93 add column migrated_93 int default 0 not null;
+alter table legacy_94 add column migrated_94 int default 0 not null;
+alter table legacy_95 add column migrated_95 int default 0 not null;
+alter table legacy_96 add column migrated_96 int default 0 not null;
+alter table legacy_97 add column migrated_97 int default 0 not null;
+alter table legacy_98 add column migrated_98 int default 0 not null;
+alter table legacy_99 add column migrated_99 int default 0 not null;
+alter table legacy_100 add column migrated_100 int default 0 not null;
+alter table legacy_101 add column migrated_101 int default 0 not null;
+alter table legacy_102 add column migrated_102 int default 0 not null;
+alter table legacy_103 add column migrated_103 int default 0 not null;
+alter table legacy_104 add column migrated_104 int default 0 not null;
+alter table legacy_105 add column migrated_105 int default 0 not null;
+alter table legacy_106 add column migrated_106 int default 0 not null;
+alter table legacy_107 add column migrated_107 int default 0 not null;
+alter table legacy_108 add column migrated_108 int default 0 not null;
+alter table legacy_109 add column migrated_109 int default 0 not null;
+alter table legacy_110 add column migrated_110 int default 0 not null;
+alter table legacy_111 add column migrated_111 int default 0 not null;
+alter table legacy_112 add column migrated_112 int default 0 not null;
+alter table legacy_113 add column migrated_113 int default 0 not null;
+alter table legacy_114 add column migrated_114 int default 0 not null;
+alter table legacy_115 add column migrated_115 int default 0 not null;
+alter table legacy_116 add column migrated_116 int default 0 not null;
+alter table legacy_117 add column migrated_117 int default 0 not null;
+alter table legacy_118 add column migrated_118 int default 0 not null;
+alter table legacy_119 add column migrated_119 int default 0 not null;
+alter table legacy_120 add column migrated_120 int default 0 not null;
+alter table legacy_121 add column migrated_121 int default 0 not null;
+alter table legacy_122 add column migrated_122 int default 0 not null;
+alter table legacy_123 add column migrated_123 int default 0 not null;
+alter table legacy_124 add column migrated_124 int default 0 not null;
+alter table legacy_125 add column migrated_125 int default 0 not null;
+alter table legacy_126 add column migrated_126 int default 0 not null;
+alter table legacy_127 add column migrated_127 int default 0 not null;
+alter table legacy_128 add column migrated_128 int default 0 not null;
+alter table legacy_129 add column migrated_129 int default 0 not null;
+alter table legacy_130 add column migrated_130 int default 0 not null;
+alter table legacy_131 add column migrated_131 int default 0 not null;
+alter table legacy_132 add column migrated_132 int default 0 not null;
+alter table legacy_133 add column migrated_133 int default 0 not null;
+alter table legacy_134 add column migrated_134 int default 0 not null;
+alter table legacy_135 add column migrated_135 int default 0 not null;
+alter table legacy_136 add column migrated_136 int default 0 not null;
+alter table legacy_137 add column migrated_137 int default 0 not null;
+alter table legacy_138 add column migrated_138 int default 0 not null;
+alter table legacy_139 add column migrated_139 int default 0 not null;
+alter table legacy_140 add column migrated_140 int default 0 not null;
+alter table legacy_141 add column migrated_141 int default 0 not null;
+alter table legacy_142 add column migrated_142 int default 0 not null;
+alter table legacy_143 add column migrated_143 int default 0 not null;
+alter table legacy_144 add column migrated_144 int default 0 not null;
+alter table legacy_145 add column migrated_145 int default 0 not null;
+alter table legacy_146 add column migrated_146 int default 0 not null;
+alter table legacy_147 add column migrated_147 int default 0 not null;
+alter table legacy_148 add column migrated_148 int default 0 not null;
+alter table legacy_149 add column migrated_149 int default 0 not null;
+alter table legacy_150 add column migrated_150 int default 0 not null;
+alter table legacy_151 add column migrated_151 int default 0 not null;
+alter table legacy_152 add column migrated_152 int default 0 not null;
+alter table legacy_153 add column migrated_153 int default 0 not null;
+alter table legacy_154 add column migrated_154 int default 0 not null;
+alter table legacy_155 add column migrated_155 int default 0 not null;
+alter table legacy_156 add column migrated_156 int default 0 not null;
+alter table legacy_157 add column migrated_157 int default 0 not null;
+alter table legacy_158 add column migrated_158 int default 0 not null;
+alter table legacy_159 add column migrated_159 int default 0 not null;
+alter table legacy_160 add column migrated_160 int default 0 not null;
+alter table legacy_161 add column migrated_161 int default 0 not null;
+alter table legacy_162 add column migrated_162 int default 0 not null;
+alter table legacy_163 add column migrated_163 int default 0 not null;
+alter table legacy_164 add column migrated_164 int default 0 not null;
+alter table legacy_165 add column migrated_165 int default 0 not null;
+alter table legacy_166 add column migrated_166 int default 0 not null;
+alter table legacy_167 add column migrated_167 int default 0 not null;
+alter table legacy_168 add column migrated_168 int default 0 not null;
+alter table legacy_169 add column migrated_169 int default 0 not null;
+alter table legacy_170 add column migrated_170 int default 0 not null;
+alter table legacy_171 add column migrated_171 int default 0 not null;
+alter table legacy_172 add column migrated_172 int default 0 not null;
+alter table legacy_173 add column migrated_173 int default 0 not null;
+alter table legacy_174 add column migrated_174 int default 0 not null;
+alter table legacy_175 add column migrated_175 int default 0 not null;
+alter table legacy_176 add column migrated_176 int default 0 not null;
+alter table legacy_177 add column migrated_177 int default 0 not null;
+alter table legacy_178 add column migrated_178 int default 0 not null;
+alter table legacy_179 add column migrated_179 int default 0 not null;
+alter table legacy_180 add column migrated_180 int default 0 not null;
+alter table legacy_181 add column migrated_181 int default 0 not null;
+alter table legacy_182 add column migrated_182 int default 0 not null;
+alter table legacy_183 add column migrated_183 int default 0 not null;
+alter table legacy_184 add column migrated_184 int default 0 not null;
+alter table legacy_185 add column migrated_185 int default 0 not null;
+alter table legacy_186 add column migrated_186 int default 0 not null;
+alter table legacy_187 add column migrated_187 int default 0 not null;
+alter table legacy_188 add column migrated_188 int default 0 not null;
+alter table legacy_189 add column migrated_189 int default 0 not null;
+alter table legacy_190 add column migrated_190 int default 0 not null;
+alter table legacy_191 add column migrated_191 int default 0 not null;
+alter table legacy_192 add column migrated_192 int default 0 not null;
+alter table legacy_193 add column migrated_193 int default 0 not null;
+alter table legacy_194 add column migrated_194 int default 0 not null;
+alter table legacy_195 add column migrated_195 int default 0 not null;
+alter table legacy_196 add column migrated_196 int default 0 not null;
+alter table legacy_197 add column migrated_197 int default 0 not null;
+alter table legacy_198 add column migrated_198 int default 0 not null;
+alter table legacy_199 add column migrated_199 int default 0 not null;
+alter table legacy_200 add column migrated_200 int default 0 not null;
+#elif SCHEMA_VERSION >= 2
+select 'schema version 2' as info;
+#else
+create table legacy_1 ( id int not null, name varchar(40) );
+create table legacy_2 ( id int not null, name varchar(40) );
+create table legacy_3 ( id int not null, name varchar(40) );
+create table legacy_4 ( id int not null, name varchar(40) );
+create table legacy_5 ( id int not null, name varchar(40) );
+create table legacy_6 ( id int not null, name varchar(40) );
+create table legacy_7 ( id int not null, name varchar(40) );
+create table legacy_8 ( id int not null, name varchar(40) );
+create table legacy_9 ( id int not null, name varchar(40) );
+create table legacy_10 ( id int not null, name varchar(40) );
+create table legacy_11 ( id int not null, name varchar(40) );
+create table legacy_12 ( id int not null, name varchar(40) );
+create table legacy_13 ( id int not null, name varchar(40) );
+create table legacy_14 ( id int not null, name varchar(40) );
+create table legacy_15 ( id int not null, name varchar(40) );
+create table legacy_16 ( id int not null, name varchar(40) );
+create table legacy_17 ( id int not null, name varchar(40) );
+create table legacy_18 ( id int not null, name varchar(40) );
+create table legacy_19 ( id int not null, name varchar(40) );
+create table legacy_20 ( id int not null, name varchar(40) );
+create table legacy_21 ( id int not null, name varchar(40) );
+create table legacy_22 ( id int not null, name varchar(40) );
+create table legacy_23 ( id int not null, name varchar(40) );
+create table legacy_24 ( id int not null, name varchar(40) );
+create table legacy_25 ( id int not null, name varchar(40) );
+create table legacy_26 ( id int not null, name varchar(40) );
+create table legacy_27 ( id int not null, name varchar(40) );
+create table legacy_28 ( id int not null, name varchar(40) );
+create table legacy_29 ( id int not null, name varchar(40) );
+create table legacy_30 ( id int not null, name varchar(40) );
+create table legacy_31 ( id int not null, name varchar(40) );
+create table legacy_32 ( id int not null, name varchar(40) );
+create table legacy_33 ( id int not null, name varchar(40) );
+create table legacy_34 ( id int not null, name varchar(40) );
+create table legacy_35 ( id int not null, name varchar(40) );
+create table legacy_36 ( id int not null, name varchar(40) );
+create table legacy_37 ( id int not null, name varchar(40) );
+create table legacy_38 ( id int not null, name varchar(40) );
+create table legacy_39 ( id int not null, name varchar(40) );
+create table legacy_40 ( id int not null, name varchar(40) );
+create table legacy_41 ( id int not null, name varchar(40) );
+create table legacy_42 ( id int not null, name varchar(40) );
+create table legacy_43 ( id int not null, name varchar(40) );
+create table legacy_44 ( id int not null, name varchar(40) );
+create table legacy_45 ( id int not null, name varchar(40) );
+create table legacy_46 ( id int not null, name varchar(40) );
+create table legacy_47 ( id int not null, name varchar(40) );
+create table legacy_48 ( id int not null, name varchar(40) );
+create table legacy_49 ( id int not null, name varchar(40) );
+create table legacy_50 ( id int not null, name varchar(40) );
+create table legacy_51 ( id int not null, name varchar(40) );
+create table legacy_52 ( id int not null, name varchar(40) );
+create table legacy_53 ( id int not null, name varchar(40) );
+create table legacy_54 ( id int not null, name varchar(40) );
+create table legacy_55 ( id int not null, name varchar(40) );
+create table legacy_56 ( id int not null, name varchar(40) );
+create table legacy_57 ( id int not null, name varchar(40) );
+create table legacy_58 ( id int not null, name varchar(40) );
+create table legacy_59 ( id int not null, name varchar(40) );
+create table legacy_60 ( id int not null, name varchar(40) );
+create table legacy_61 ( id int not null, name varchar(40) );
+create table legacy_62 ( id int not null, name varchar(40) );
+create table legacy_63 ( id int not null, name varchar(40) );
+create table legacy_64 ( id int not null, name varchar(40) );
+create table legacy_65 ( id int not null, name varchar(40) );
+create table legacy_66 ( id int not null, name varchar(40) );
+create table legacy_67 ( id int not null, name varchar(40) );
+create table legacy_68 ( id int not null, name varchar(40) );
+create table legacy_69 ( id int not null, name varchar(40) );
+create table legacy_70 ( id int not null, name varchar(40) );
+create table legacy_71 ( id int not null, name varchar(40) );
+create table legacy_72 ( id int not null, name varchar(40) );
+create table legacy_73 ( id int not null, name varchar(40) );
+create table legacy_74 ( id int not null, name varchar(40) );
+create table legacy_75 ( id int not null, name varchar(40) );
+create table legacy_76 ( id int not null, name varchar(40) );
+create table legacy_77 ( id int not null, name varchar(40) );
+create table legacy_78 ( id int not null, name varchar(40) );
+create table legacy_79 ( id int not null, name varchar(40) );
+create table legacy_80 ( id int not null, name varchar(40) );
+create table legacy_81 ( id int not null, name varchar(40) );
+create table legacy_82 ( id int not null, name varchar(40) );
+create table legacy_83 ( id int not null, name varchar(40) );
+create table legacy_84 ( id int not null, name varchar(40) );
+create table legacy_85 ( id int not null, name varchar(40) );
+create table legacy_86 ( id int not null, name varchar(40) );
+create table legacy_87 ( id int not null, name varchar(40) );
+create table legacy_88 ( id int not null, name varchar(40) );
+create table legacy_89 ( id int not null, name varchar(40) );
+create table legacy_90 ( id int not null, name varchar(40) );
+create table legacy_91 ( id int not null, name varchar(40) );
+create table legacy_92 ( id int not null, name varchar(40) );
+create table legacy_93 ( id int not null, name varchar(40) );
+create table legacy_94 ( id int not null, name varchar(40) );
+create table legacy_95 ( id int not null, name varchar(40) );
+create table legacy_96 ( id int not null, name varchar(40) );
+create table legacy_97 ( id int not null, name varchar(40) );
+create table legacy_98 ( id int not null, name varchar(40) );
+create table legacy_99 ( id int not null, name varchar(40) );
+create table legacy_100 ( id int not null, name varchar(40) );
+create table legacy_101 ( id int not null, name varchar(40) );
+create table legacy_102 ( id int not null, name varchar(40) );
+create table legacy_103 ( id int not null, name varchar(40) );
+create table legacy_104 ( id int not null, name varchar(40) );
+create table legacy_105 ( id int not null, name varchar(40) );
+create table legacy_106 ( id int not null, name varchar(40) );
+create table legacy_107 ( id int not null, name varchar(40) );
+create table legacy_108 ( id int not null, name varchar(40) );
+create table legacy_109 ( id int not null, name varchar(40) );
+create table legacy_110 ( id int not null, name varchar(40) );
+create table legacy_111 ( id int not null, name varchar(40) );
+create table legacy_112 ( id int not null, name varchar(40) );
+create table legacy_113 ( id int not null, name varchar(40) );
+create table legacy_114 ( id int not null, name varchar(40) );
+create table legacy_115 ( id int not null, name varchar(40) );
+create table legacy_116 ( id int not null, name varchar(40) );
+create table legacy_117 ( id int not null, name varchar(40) );
+create table legacy_118 ( id int not null, name varchar(40) );
+create table legacy_119 ( id int not null, name varchar(40) );
+create table legacy_120 ( id int not null, name varchar(40) );
+create table legacy_121 ( id int not null, name varchar(40) );
+create table legacy_122 ( id int not null, name varchar(40) );
+create table legacy_123 ( id int not null, name varchar(40) );
+create table legacy_124 ( id int not null, name varchar(40) );
+create table legacy_125 ( id int not null, name varchar(40) );
+create table legacy_126 ( id int not null, name varchar(40) );
+create table legacy_127 ( id int not null, name varchar(40) );
+create table legacy_128 ( id int not null, name varchar(40) );
+create table legacy_129 ( id int not null, name varchar(40) );
+create table legacy_130 ( id int not null, name varchar(40) );
+create table legacy_131 ( id int not null, name varchar(40) );
+create table legacy_132 ( id int not null, name varchar(40) );
+create table legacy_133 ( id int not null, name varchar(40) );
+create table legacy_134 ( id int not null, name varchar(40) );
+create table legacy_135 ( id int not null, name varchar(40) );
+create table legacy_136 ( id int not null, name varchar(40) );
+create table legacy_137 ( id int not null, name varchar(40) );
+create table legacy_138 ( id int not null, name varchar(40) );
+create table legacy_139 ( id int not null, name varchar(40) );
+create table legacy_140 ( id int not null, name varchar(40) );
+create table legacy_141 ( id int not null, name varchar(40) );
+create table legacy_142 ( id int not null, name varchar(40) );
+create table legacy_143 ( id int not null, name varchar(40) );
+create table legacy_144 ( id int not null, name varchar(40) );
+create table legacy_145 ( id int not null, name varchar(40) );
+create table legacy_146 ( id int not null, name varchar(40) );
+create table legacy_147 ( id int not null, name varchar(40) );
+create table legacy_148 ( id int not null, name varchar(40) );
+create table legacy_149 ( id int not null, name varchar(40) );
+create table legacy_150 ( id int not null, name varchar(40) );
+create table legacy_151 ( id int not null, name varchar(40) );
+create table legacy_152 ( id int not null, name varchar(40) );
+create table legacy_153 ( id int not null, name varchar(40) );
+create table legacy_154 ( id int not null, name varchar(40) );
+create table legacy_155 ( id int not null, name varchar(40) );
+create table legacy_156 ( id int not null, name varchar(40) );
+create table legacy_157 ( id int not null, name varchar(40) );
+create table legacy_158 ( id int not null, name varchar(40) );
+create table legacy_159 ( id int not null, name varchar(40) );
+create table legacy_160 ( id int not null, name varchar(40) );
+create table legacy_161 ( id int not null, name varchar(40) );
+create table legacy_162 ( id int not null, name varchar(40) );
+create table legacy_163 ( id int not null, name varchar(40) );
+create table legacy_164 ( id int not null, name varchar(40) );
+create table legacy_165 ( id int not null, name varchar(40) );
+create table legacy_166 ( id int not null, name varchar(40) );
+create table legacy_167 ( id int not null, name varchar(40) );
+create table legacy_168 ( id int not null, name varchar(40) );
+create table legacy_169 ( id int not null, name varchar(40) );
+create table legacy_170 ( id int not null, name varchar(40) );
+create table legacy_171 ( id int not null, name varchar(40) );
+create table legacy_172 ( id int not null, name varchar(40) );
+create table legacy_173 ( id int not null, name varchar(40) );
+create table legacy_174 ( id int not null, name varchar(40) );
+create table legacy_175 ( id int not null, name varchar(40) );
+create table legacy_176 ( id int not null, name varchar(40) );
+create table legacy_177 ( id int not null, name varchar(40) );
+create table legacy_178 ( id int not null, name varchar(40) );
+create table legacy_179 ( id int not null, name varchar(40) );
+create table legacy_180 ( id int not null, name varchar(40) );
+create table legacy_181 ( id int not null, name varchar(40) );
+create table legacy_182 ( id int not null, name varchar(40) );
+create table legacy_183 ( id int not null, name varchar(40) );
+create table legacy_184 ( id int not null, name varchar(40) );
+create table legacy_185 ( id int not null, name varchar(40) );
+create table legacy_186 ( id int not null, name varchar(40) );
+create table legacy_187 ( id int not null, name varchar(40) );
+create table legacy_188 ( id int not null, name varchar(40) );
+create table legacy_189 ( id int not null, name varchar(40) );
+create table legacy_190 ( id int not null, name varchar(40) );
+create table legacy_191 ( id int not null, name varchar(40) );
+create table legacy_192 ( id int not null, name varchar(40) );
+create table legacy_193 ( id int not null, name varchar(40) );
+create table legacy_194 ( id int not null, name varchar(40) );
+create table legacy_195 ( id int not null, name varchar(40) );
+create table legacy_196 ( id int not null, name varchar(40) );
+create table legacy_197 ( id int not null, name varchar(40) );
+create table legacy_198 ( id int not null, name varchar(40) );
+create table legacy_199 ( id int not null, name varchar(40) );
+create table legacy_200 ( id int not null, name varchar(40) );
+#endif
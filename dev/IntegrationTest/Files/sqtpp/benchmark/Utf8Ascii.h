@@ -0,0 +1,204 @@
+﻿/*
+** @file
+** @brief Benchmark input: UTF-8 encoded mostly ASCII text.
+*/
+insert into customer( id, name, city, remark ) values ( 0, 'Customer 0', 'City 0', 'Plain ASCII remark for customer number 0' );
+insert into customer( id, name, city, remark ) values ( 1, 'Customer 1', 'City 1', 'Plain ASCII remark for customer number 1' );
+insert into customer( id, name, city, remark ) values ( 2, 'Customer 2', 'City 2', 'Plain ASCII remark for customer number 2' );
+insert into customer( id, name, city, remark ) values ( 3, 'Customer 3', 'City 3', 'Plain ASCII remark for customer number 3' );
+insert into customer( id, name, city, remark ) values ( 4, 'Customer 4', 'City 4', 'Plain ASCII remark for customer number 4' );
+insert into customer( id, name, city, remark ) values ( 5, 'Customer 5', 'City 5', 'Plain ASCII remark for customer number 5' );
+insert into customer( id, name, city, remark ) values ( 6, 'Customer 6', 'City 6', 'Plain ASCII remark for customer number 6' );
+insert into customer( id, name, city, remark ) values ( 7, 'Customer 7', 'City 7', 'Plain ASCII remark for customer number 7' );
+insert into customer( id, name, city, remark ) values ( 8, 'Customer 8', 'City 8', 'Plain ASCII remark for customer number 8' );
+insert into customer( id, name, city, remark ) values ( 9, 'Customer 9', 'City 9', 'Plain ASCII remark for customer number 9' );
+insert into customer( id, name, city, remark ) values ( 10, 'Customer 10', 'City 10', 'Plain ASCII remark for customer number 10' );
+insert into customer( id, name, city, remark ) values ( 11, 'Customer 11', 'City 11', 'Plain ASCII remark for customer number 11' );
+insert into customer( id, name, city, remark ) values ( 12, 'Customer 12', 'City 12', 'Plain ASCII remark for customer number 12' );
+insert into customer( id, name, city, remark ) values ( 13, 'Customer 13', 'City 13', 'Plain ASCII remark for customer number 13' );
+insert into customer( id, name, city, remark ) values ( 14, 'Customer 14', 'City 14', 'Plain ASCII remark for customer number 14' );
+insert into customer( id, name, city, remark ) values ( 15, 'Customer 15', 'City 15', 'Plain ASCII remark for customer number 15' );
+insert into customer( id, name, city, remark ) values ( 16, 'Customer 16', 'City 16', 'Plain ASCII remark for customer number 16' );
+insert into customer( id, name, city, remark ) values ( 17, 'Customer 17', 'City 17', 'Plain ASCII remark for customer number 17' );
+insert into customer( id, name, city, remark ) values ( 18, 'Customer 18', 'City 18', 'Plain ASCII remark for customer number 18' );
+insert into customer( id, name, city, remark ) values ( 19, 'Customer 19', 'City 19', 'Plain ASCII remark for customer number 19' );
+insert into customer( id, name, city, remark ) values ( 20, 'Customer 20', 'City 20', 'Plain ASCII remark for customer number 20' );
+insert into customer( id, name, city, remark ) values ( 21, 'Customer 21', 'City 21', 'Plain ASCII remark for customer number 21' );
+insert into customer( id, name, city, remark ) values ( 22, 'Customer 22', 'City 22', 'Plain ASCII remark for customer number 22' );
+insert into customer( id, name, city, remark ) values ( 23, 'Customer 23', 'City 23', 'Plain ASCII remark for customer number 23' );
+insert into customer( id, name, city, remark ) values ( 24, 'Customer 24', 'City 24', 'Plain ASCII remark for customer number 24' );
+insert into customer( id, name, city, remark ) values ( 25, 'Customer 25', 'City 25', 'Plain ASCII remark for customer number 25' );
+insert into customer( id, name, city, remark ) values ( 26, 'Customer 26', 'City 26', 'Plain ASCII remark for customer number 26' );
+insert into customer( id, name, city, remark ) values ( 27, 'Customer 27', 'City 27', 'Plain ASCII remark for customer number 27' );
+insert into customer( id, name, city, remark ) values ( 28, 'Customer 28', 'City 28', 'Plain ASCII remark for customer number 28' );
+insert into customer( id, name, city, remark ) values ( 29, 'Customer 29', 'City 29', 'Plain ASCII remark for customer number 29' );
+insert into customer( id, name, city, remark ) values ( 30, 'Customer 30', 'City 30', 'Plain ASCII remark for customer number 30' );
+insert into customer( id, name, city, remark ) values ( 31, 'Customer 31', 'City 31', 'Plain ASCII remark for customer number 31' );
+insert into customer( id, name, city, remark ) values ( 32, 'Customer 32', 'City 32', 'Plain ASCII remark for customer number 32' );
+insert into customer( id, name, city, remark ) values ( 33, 'Customer 33', 'City 33', 'Plain ASCII remark for customer number 33' );
+insert into customer( id, name, city, remark ) values ( 34, 'Customer 34', 'City 34', 'Plain ASCII remark for customer number 34' );
+insert into customer( id, name, city, remark ) values ( 35, 'Customer 35', 'City 35', 'Plain ASCII remark for customer number 35' );
+insert into customer( id, name, city, remark ) values ( 36, 'Customer 36', 'City 36', 'Plain ASCII remark for customer number 36' );
+insert into customer( id, name, city, remark ) values ( 37, 'Customer 37', 'City 37', 'Plain ASCII remark for customer number 37' );
+insert into customer( id, name, city, remark ) values ( 38, 'Customer 38', 'City 38', 'Plain ASCII remark for customer number 38' );
+insert into customer( id, name, city, remark ) values ( 39, 'Customer 39', 'City 39', 'Plain ASCII remark for customer number 39' );
+insert into customer( id, name, city, remark ) values ( 40, 'Customer 40', 'City 40', 'Plain ASCII remark for customer number 40' );
+insert into customer( id, name, city, remark ) values ( 41, 'Customer 41', 'City 41', 'Plain ASCII remark for customer number 41' );
+insert into customer( id, name, city, remark ) values ( 42, 'Customer 42', 'City 42', 'Plain ASCII remark for customer number 42' );
+insert into customer( id, name, city, remark ) values ( 43, 'Customer 43', 'City 43', 'Plain ASCII remark for customer number 43' );
+insert into customer( id, name, city, remark ) values ( 44, 'Customer 44', 'City 44', 'Plain ASCII remark for customer number 44' );
+insert into customer( id, name, city, remark ) values ( 45, 'Customer 45', 'City 45', 'Plain ASCII remark for customer number 45' );
+insert into customer( id, name, city, remark ) values ( 46, 'Customer 46', 'City 46', 'Plain ASCII remark for customer number 46' );
+insert into customer( id, name, city, remark ) values ( 47, 'Customer 47', 'City 47', 'Plain ASCII remark for customer number 47' );
+insert into customer( id, name, city, remark ) values ( 48, 'Customer 48', 'City 48', 'Plain ASCII remark for customer number 48' );
+insert into customer( id, name, city, remark ) values ( 49, 'Customer 49', 'City 49', 'Plain ASCII remark for customer number 49' );
+insert into customer( id, name, city, remark ) values ( 50, 'Customer 50', 'City 50', 'Plain ASCII remark for customer number 50' );
+insert into customer( id, name, city, remark ) values ( 51, 'Customer 51', 'City 51', 'Plain ASCII remark for customer number 51' );
+insert into customer( id, name, city, remark ) values ( 52, 'Customer 52', 'City 52', 'Plain ASCII remark for customer number 52' );
+insert into customer( id, name, city, remark ) values ( 53, 'Customer 53', 'City 53', 'Plain ASCII remark for customer number 53' );
+insert into customer( id, name, city, remark ) values ( 54, 'Customer 54', 'City 54', 'Plain ASCII remark for customer number 54' );
+insert into customer( id, name, city, remark ) values ( 55, 'Customer 55', 'City 55', 'Plain ASCII remark for customer number 55' );
+insert into customer( id, name, city, remark ) values ( 56, 'Customer 56', 'City 56', 'Plain ASCII remark for customer number 56' );
+insert into customer( id, name, city, remark ) values ( 57, 'Customer 57', 'City 57', 'Plain ASCII remark for customer number 57' );
+insert into customer( id, name, city, remark ) values ( 58, 'Customer 58', 'City 58', 'Plain ASCII remark for customer number 58' );
+insert into customer( id, name, city, remark ) values ( 59, 'Customer 59', 'City 59', 'Plain ASCII remark for customer number 59' );
+insert into customer( id, name, city, remark ) values ( 60, 'Customer 60', 'City 60', 'Plain ASCII remark for customer number 60' );
+insert into customer( id, name, city, remark ) values ( 61, 'Customer 61', 'City 61', 'Plain ASCII remark for customer number 61' );
+insert into customer( id, name, city, remark ) values ( 62, 'Customer 62', 'City 62', 'Plain ASCII remark for customer number 62' );
+insert into customer( id, name, city, remark ) values ( 63, 'Customer 63', 'City 63', 'Plain ASCII remark for customer number 63' );
+insert into customer( id, name, city, remark ) values ( 64, 'Customer 64', 'City 64', 'Plain ASCII remark for customer number 64' );
+insert into customer( id, name, city, remark ) values ( 65, 'Customer 65', 'City 65', 'Plain ASCII remark for customer number 65' );
+insert into customer( id, name, city, remark ) values ( 66, 'Customer 66', 'City 66', 'Plain ASCII remark for customer number 66' );
+insert into customer( id, name, city, remark ) values ( 67, 'Customer 67', 'City 67', 'Plain ASCII remark for customer number 67' );
+insert into customer( id, name, city, remark ) values ( 68, 'Customer 68', 'City 68', 'Plain ASCII remark for customer number 68' );
+insert into customer( id, name, city, remark ) values ( 69, 'Customer 69', 'City 69', 'Plain ASCII remark for customer number 69' );
+insert into customer( id, name, city, remark ) values ( 70, 'Customer 70', 'City 70', 'Plain ASCII remark for customer number 70' );
+insert into customer( id, name, city, remark ) values ( 71, 'Customer 71', 'City 71', 'Plain ASCII remark for customer number 71' );
+insert into customer( id, name, city, remark ) values ( 72, 'Customer 72', 'City 72', 'Plain ASCII remark for customer number 72' );
+insert into customer( id, name, city, remark ) values ( 73, 'Customer 73', 'City 73', 'Plain ASCII remark for customer number 73' );
+insert into customer( id, name, city, remark ) values ( 74, 'Customer 74', 'City 74', 'Plain ASCII remark for customer number 74' );
+insert into customer( id, name, city, remark ) values ( 75, 'Customer 75', 'City 75', 'Plain ASCII remark for customer number 75' );
+insert into customer( id, name, city, remark ) values ( 76, 'Customer 76', 'City 76', 'Plain ASCII remark for customer number 76' );
+insert into customer( id, name, city, remark ) values ( 77, 'Customer 77', 'City 77', 'Plain ASCII remark for customer number 77' );
+insert into customer( id, name, city, remark ) values ( 78, 'Customer 78', 'City 78', 'Plain ASCII remark for customer number 78' );
+insert into customer( id, name, city, remark ) values ( 79, 'Customer 79', 'City 79', 'Plain ASCII remark for customer number 79' );
+insert into customer( id, name, city, remark ) values ( 80, 'Customer 80', 'City 80', 'Plain ASCII remark for customer number 80' );
+insert into customer( id, name, city, remark ) values ( 81, 'Customer 81', 'City 81', 'Plain ASCII remark for customer number 81' );
+insert into customer( id, name, city, remark ) values ( 82, 'Customer 82', 'City 82', 'Plain ASCII remark for customer number 82' );
+insert into customer( id, name, city, remark ) values ( 83, 'Customer 83', 'City 83', 'Plain ASCII remark for customer number 83' );
+insert into customer( id, name, city, remark ) values ( 84, 'Customer 84', 'City 84', 'Plain ASCII remark for customer number 84' );
+insert into customer( id, name, city, remark ) values ( 85, 'Customer 85', 'City 85', 'Plain ASCII remark for customer number 85' );
+insert into customer( id, name, city, remark ) values ( 86, 'Customer 86', 'City 86', 'Plain ASCII remark for customer number 86' );
+insert into customer( id, name, city, remark ) values ( 87, 'Customer 87', 'City 87', 'Plain ASCII remark for customer number 87' );
+insert into customer( id, name, city, remark ) values ( 88, 'Customer 88', 'City 88', 'Plain ASCII remark for customer number 88' );
+insert into customer( id, name, city, remark ) values ( 89, 'Customer 89', 'City 89', 'Plain ASCII remark for customer number 89' );
+insert into customer( id, name, city, remark ) values ( 90, 'Customer 90', 'City 90', 'Plain ASCII remark for customer number 90' );
+insert into customer( id, name, city, remark ) values ( 91, 'Customer 91', 'City 91', 'Plain ASCII remark for customer number 91' );
+insert into customer( id, name, city, remark ) values ( 92, 'Customer 92', 'City 92', 'Plain ASCII remark for customer number 92' );
+insert into customer( id, name, city, remark ) values ( 93, 'Customer 93', 'City 93', 'Plain ASCII remark for customer number 93' );
+insert into customer( id, name, city, remark ) values ( 94, 'Customer 94', 'City 94', 'Plain ASCII remark for customer number 94' );
+insert into customer( id, name, city, remark ) values ( 95, 'Customer 95', 'City 95', 'Plain ASCII remark for customer number 95' );
+insert into customer( id, name, city, remark ) values ( 96, 'Customer 96', 'City 96', 'Plain ASCII remark for customer number 96' );
+insert into customer( id, name, city, remark ) values ( 97, 'Customer 97', 'City 0', 'Plain ASCII remark for customer number 97' );
+insert into customer( id, name, city, remark ) values ( 98, 'Customer 98', 'City 1', 'Plain ASCII remark for customer number 98' );
+insert into customer( id, name, city, remark ) values ( 99, 'Customer 99', 'City 2', 'Plain ASCII remark for customer number 99' );
+insert into customer( id, name, city, remark ) values ( 100, 'Customer 100', 'City 3', 'Plain ASCII remark for customer number 100' );
+insert into customer( id, name, city, remark ) values ( 101, 'Customer 101', 'City 4', 'Plain ASCII remark for customer number 101' );
+insert into customer( id, name, city, remark ) values ( 102, 'Customer 102', 'City 5', 'Plain ASCII remark for customer number 102' );
+insert into customer( id, name, city, remark ) values ( 103, 'Customer 103', 'City 6', 'Plain ASCII remark for customer number 103' );
+insert into customer( id, name, city, remark ) values ( 104, 'Customer 104', 'City 7', 'Plain ASCII remark for customer number 104' );
+insert into customer( id, name, city, remark ) values ( 105, 'Customer 105', 'City 8', 'Plain ASCII remark for customer number 105' );
+insert into customer( id, name, city, remark ) values ( 106, 'Customer 106', 'City 9', 'Plain ASCII remark for customer number 106' );
+insert into customer( id, name, city, remark ) values ( 107, 'Customer 107', 'City 10', 'Plain ASCII remark for customer number 107' );
+insert into customer( id, name, city, remark ) values ( 108, 'Customer 108', 'City 11', 'Plain ASCII remark for customer number 108' );
+insert into customer( id, name, city, remark ) values ( 109, 'Customer 109', 'City 12', 'Plain ASCII remark for customer number 109' );
+insert into customer( id, name, city, remark ) values ( 110, 'Customer 110', 'City 13', 'Plain ASCII remark for customer number 110' );
+insert into customer( id, name, city, remark ) values ( 111, 'Customer 111', 'City 14', 'Plain ASCII remark for customer number 111' );
+insert into customer( id, name, city, remark ) values ( 112, 'Customer 112', 'City 15', 'Plain ASCII remark for customer number 112' );
+insert into customer( id, name, city, remark ) values ( 113, 'Customer 113', 'City 16', 'Plain ASCII remark for customer number 113' );
+insert into customer( id, name, city, remark ) values ( 114, 'Customer 114', 'City 17', 'Plain ASCII remark for customer number 114' );
+insert into customer( id, name, city, remark ) values ( 115, 'Customer 115', 'City 18', 'Plain ASCII remark for customer number 115' );
+insert into customer( id, name, city, remark ) values ( 116, 'Customer 116', 'City 19', 'Plain ASCII remark for customer number 116' );
+insert into customer( id, name, city, remark ) values ( 117, 'Customer 117', 'City 20', 'Plain ASCII remark for customer number 117' );
+insert into customer( id, name, city, remark ) values ( 118, 'Customer 118', 'City 21', 'Plain ASCII remark for customer number 118' );
+insert into customer( id, name, city, remark ) values ( 119, 'Customer 119', 'City 22', 'Plain ASCII remark for customer number 119' );
+insert into customer( id, name, city, remark ) values ( 120, 'Customer 120', 'City 23', 'Plain ASCII remark for customer number 120' );
+insert into customer( id, name, city, remark ) values ( 121, 'Customer 121', 'City 24', 'Plain ASCII remark for customer number 121' );
+insert into customer( id, name, city, remark ) values ( 122, 'Customer 122', 'City 25', 'Plain ASCII remark for customer number 122' );
+insert into customer( id, name, city, remark ) values ( 123, 'Customer 123', 'City 26', 'Plain ASCII remark for customer number 123' );
+insert into customer( id, name, city, remark ) values ( 124, 'Customer 124', 'City 27', 'Plain ASCII remark for customer number 124' );
+insert into customer( id, name, city, remark ) values ( 125, 'Customer 125', 'City 28', 'Plain ASCII remark for customer number 125' );
+insert into customer( id, name, city, remark ) values ( 126, 'Customer 126', 'City 29', 'Plain ASCII remark for customer number 126' );
+insert into customer( id, name, city, remark ) values ( 127, 'Customer 127', 'City 30', 'Plain ASCII remark for customer number 127' );
+insert into customer( id, name, city, remark ) values ( 128, 'Customer 128', 'City 31', 'Plain ASCII remark for customer number 128' );
+insert into customer( id, name, city, remark ) values ( 129, 'Customer 129', 'City 32', 'Plain ASCII remark for customer number 129' );
+insert into customer( id, name, city, remark ) values ( 130, 'Customer 130', 'City 33', 'Plain ASCII remark for customer number 130' );
+insert into customer( id, name, city, remark ) values ( 131, 'Customer 131', 'City 34', 'Plain ASCII remark for customer number 131' );
+insert into customer( id, name, city, remark ) values ( 132, 'Customer 132', 'City 35', 'Plain ASCII remark for customer number 132' );
+insert into customer( id, name, city, remark ) values ( 133, 'Customer 133', 'City 36', 'Plain ASCII remark for customer number 133' );
+insert into customer( id, name, city, remark ) values ( 134, 'Customer 134', 'City 37', 'Plain ASCII remark for customer number 134' );
+insert into customer( id, name, city, remark ) values ( 135, 'Customer 135', 'City 38', 'Plain ASCII remark for customer number 135' );
+insert into customer( id, name, city, remark ) values ( 136, 'Customer 136', 'City 39', 'Plain ASCII remark for customer number 136' );
+insert into customer( id, name, city, remark ) values ( 137, 'Customer 137', 'City 40', 'Plain ASCII remark for customer number 137' );
+insert into customer( id, name, city, remark ) values ( 138, 'Customer 138', 'City 41', 'Plain ASCII remark for customer number 138' );
+insert into customer( id, name, city, remark ) values ( 139, 'Customer 139', 'City 42', 'Plain ASCII remark for customer number 139' );
+insert into customer( id, name, city, remark ) values ( 140, 'Customer 140', 'City 43', 'Plain ASCII remark for customer number 140' );
+insert into customer( id, name, city, remark ) values ( 141, 'Customer 141', 'City 44', 'Plain ASCII remark for customer number 141' );
+insert into customer( id, name, city, remark ) values ( 142, 'Customer 142', 'City 45', 'Plain ASCII remark for customer number 142' );
+insert into customer( id, name, city, remark ) values ( 143, 'Customer 143', 'City 46', 'Plain ASCII remark for customer number 143' );
+insert into customer( id, name, city, remark ) values ( 144, 'Customer 144', 'City 47', 'Plain ASCII remark for customer number 144' );
+insert into customer( id, name, city, remark ) values ( 145, 'Customer 145', 'City 48', 'Plain ASCII remark for customer number 145' );
+insert into customer( id, name, city, remark ) values ( 146, 'Customer 146', 'City 49', 'Plain ASCII remark for customer number 146' );
+insert into customer( id, name, city, remark ) values ( 147, 'Customer 147', 'City 50', 'Plain ASCII remark for customer number 147' );
+insert into customer( id, name, city, remark ) values ( 148, 'Customer 148', 'City 51', 'Plain ASCII remark for customer number 148' );
+insert into customer( id, name, city, remark ) values ( 149, 'Customer 149', 'City 52', 'Plain ASCII remark for customer number 149' );
+insert into customer( id, name, city, remark ) values ( 150, 'Customer 150', 'City 53', 'Plain ASCII remark for customer number 150' );
+insert into customer( id, name, city, remark ) values ( 151, 'Customer 151', 'City 54', 'Plain ASCII remark for customer number 151' );
+insert into customer( id, name, city, remark ) values ( 152, 'Customer 152', 'City 55', 'Plain ASCII remark for customer number 152' );
+insert into customer( id, name, city, remark ) values ( 153, 'Customer 153', 'City 56', 'Plain ASCII remark for customer number 153' );
+insert into customer( id, name, city, remark ) values ( 154, 'Customer 154', 'City 57', 'Plain ASCII remark for customer number 154' );
+insert into customer( id, name, city, remark ) values ( 155, 'Customer 155', 'City 58', 'Plain ASCII remark for customer number 155' );
+insert into customer( id, name, city, remark ) values ( 156, 'Customer 156', 'City 59', 'Plain ASCII remark for customer number 156' );
+insert into customer( id, name, city, remark ) values ( 157, 'Customer 157', 'City 60', 'Plain ASCII remark for customer number 157' );
+insert into customer( id, name, city, remark ) values ( 158, 'Customer 158', 'City 61', 'Plain ASCII remark for customer number 158' );
+insert into customer( id, name, city, remark ) values ( 159, 'Customer 159', 'City 62', 'Plain ASCII remark for customer number 159' );
+insert into customer( id, name, city, remark ) values ( 160, 'Customer 160', 'City 63', 'Plain ASCII remark for customer number 160' );
+insert into customer( id, name, city, remark ) values ( 161, 'Customer 161', 'City 64', 'Plain ASCII remark for customer number 161' );
+insert into customer( id, name, city, remark ) values ( 162, 'Customer 162', 'City 65', 'Plain ASCII remark for customer number 162' );
+insert into customer( id, name, city, remark ) values ( 163, 'Customer 163', 'City 66', 'Plain ASCII remark for customer number 163' );
+insert into customer( id, name, city, remark ) values ( 164, 'Customer 164', 'City 67', 'Plain ASCII remark for customer number 164' );
+insert into customer( id, name, city, remark ) values ( 165, 'Customer 165', 'City 68', 'Plain ASCII remark for customer number 165' );
+insert into customer( id, name, city, remark ) values ( 166, 'Customer 166', 'City 69', 'Plain ASCII remark for customer number 166' );
+insert into customer( id, name, city, remark ) values ( 167, 'Customer 167', 'City 70', 'Plain ASCII remark for customer number 167' );
+insert into customer( id, name, city, remark ) values ( 168, 'Customer 168', 'City 71', 'Plain ASCII remark for customer number 168' );
+insert into customer( id, name, city, remark ) values ( 169, 'Customer 169', 'City 72', 'Plain ASCII remark for customer number 169' );
+insert into customer( id, name, city, remark ) values ( 170, 'Customer 170', 'City 73', 'Plain ASCII remark for customer number 170' );
+insert into customer( id, name, city, remark ) values ( 171, 'Customer 171', 'City 74', 'Plain ASCII remark for customer number 171' );
+insert into customer( id, name, city, remark ) values ( 172, 'Customer 172', 'City 75', 'Plain ASCII remark for customer number 172' );
+insert into customer( id, name, city, remark ) values ( 173, 'Customer 173', 'City 76', 'Plain ASCII remark for customer number 173' );
+insert into customer( id, name, city, remark ) values ( 174, 'Customer 174', 'City 77', 'Plain ASCII remark for customer number 174' );
+insert into customer( id, name, city, remark ) values ( 175, 'Customer 175', 'City 78', 'Plain ASCII remark for customer number 175' );
+insert into customer( id, name, city, remark ) values ( 176, 'Customer 176', 'City 79', 'Plain ASCII remark for customer number 176' );
+insert into customer( id, name, city, remark ) values ( 177, 'Customer 177', 'City 80', 'Plain ASCII remark for customer number 177' );
+insert into customer( id, name, city, remark ) values ( 178, 'Customer 178', 'City 81', 'Plain ASCII remark for customer number 178' );
+insert into customer( id, name, city, remark ) values ( 179, 'Customer 179', 'City 82', 'Plain ASCII remark for customer number 179' );
+insert into customer( id, name, city, remark ) values ( 180, 'Customer 180', 'City 83', 'Plain ASCII remark for customer number 180' );
+insert into customer( id, name, city, remark ) values ( 181, 'Customer 181', 'City 84', 'Plain ASCII remark for customer number 181' );
+insert into customer( id, name, city, remark ) values ( 182, 'Customer 182', 'City 85', 'Plain ASCII remark for customer number 182' );
+insert into customer( id, name, city, remark ) values ( 183, 'Customer 183', 'City 86', 'Plain ASCII remark for customer number 183' );
+insert into customer( id, name, city, remark ) values ( 184, 'Customer 184', 'City 87', 'Plain ASCII remark for customer number 184' );
+insert into customer( id, name, city, remark ) values ( 185, 'Customer 185', 'City 88', 'Plain ASCII remark for customer number 185' );
+insert into customer( id, name, city, remark ) values ( 186, 'Customer 186', 'City 89', 'Plain ASCII remark for customer number 186' );
+insert into customer( id, name, city, remark ) values ( 187, 'Customer 187', 'City 90', 'Plain ASCII remark for customer number 187' );
+insert into customer( id, name, city, remark ) values ( 188, 'Customer 188', 'City 91', 'Plain ASCII remark for customer number 188' );
+insert into customer( id, name, city, remark ) values ( 189, 'Customer 189', 'City 92', 'Plain ASCII remark for customer number 189' );
+insert into customer( id, name, city, remark ) values ( 190, 'Customer 190', 'City 93', 'Plain ASCII remark for customer number 190' );
+insert into customer( id, name, city, remark ) values ( 191, 'Customer 191', 'City 94', 'Plain ASCII remark for customer number 191' );
+insert into customer( id, name, city, remark ) values ( 192, 'Customer 192', 'City 95', 'Plain ASCII remark for customer number 192' );
+insert into customer( id, name, city, remark ) values ( 193, 'Customer 193', 'City 96', 'Plain ASCII remark for customer number 193' );
+insert into customer( id, name, city, remark ) values ( 194, 'Customer 194', 'City 0', 'Plain ASCII remark for customer number 194' );
+insert into customer( id, name, city, remark ) values ( 195, 'Customer 195', 'City 1', 'Plain ASCII remark for customer number 195' );
+insert into customer( id, name, city, remark ) values ( 196, 'Customer 196', 'City 2', 'Plain ASCII remark for customer number 196' );
+insert into customer( id, name, city, remark ) values ( 197, 'Customer 197', 'City 3', 'Plain ASCII remark for customer number 197' );
+insert into customer( id, name, city, remark ) values ( 198, 'Customer 198', 'City 4', 'Plain ASCII remark for customer number 198' );
+insert into customer( id, name, city, remark ) values ( 199, 'Customer 199', 'City 5', 'Plain ASCII remark for customer number 199' );
@@ -0,0 +1,204 @@
+﻿/*
+** @file
+** @brief Benchmark input: UTF-8 encoded CJK text.
+*/
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 0, '山田太郎0', '東京都千代田区丸の内0丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 1, '山田太郎1', '東京都千代田区丸の内1丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 2, '山田太郎2', '東京都千代田区丸の内2丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 3, '山田太郎3', '東京都千代田区丸の内3丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 4, '山田太郎4', '東京都千代田区丸の内4丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 5, '山田太郎5', '東京都千代田区丸の内5丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 6, '山田太郎6', '東京都千代田区丸の内6丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 7, '山田太郎7', '東京都千代田区丸の内7丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 8, '山田太郎8', '東京都千代田区丸の内8丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 9, '山田太郎9', '東京都千代田区丸の内9丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 10, '山田太郎10', '東京都千代田区丸の内10丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 11, '山田太郎11', '東京都千代田区丸の内11丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 12, '山田太郎12', '東京都千代田区丸の内12丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 13, '山田太郎13', '東京都千代田区丸の内13丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 14, '山田太郎14', '東京都千代田区丸の内14丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 15, '山田太郎15', '東京都千代田区丸の内15丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 16, '山田太郎16', '東京都千代田区丸の内16丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 17, '山田太郎17', '東京都千代田区丸の内17丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 18, '山田太郎18', '東京都千代田区丸の内18丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 19, '山田太郎19', '東京都千代田区丸の内19丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 20, '山田太郎20', '東京都千代田区丸の内20丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 21, '山田太郎21', '東京都千代田区丸の内21丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 22, '山田太郎22', '東京都千代田区丸の内22丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 23, '山田太郎23', '東京都千代田区丸の内23丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 24, '山田太郎24', '東京都千代田区丸の内24丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 25, '山田太郎25', '東京都千代田区丸の内25丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 26, '山田太郎26', '東京都千代田区丸の内26丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 27, '山田太郎27', '東京都千代田区丸の内27丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 28, '山田太郎28', '東京都千代田区丸の内28丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 29, '山田太郎29', '東京都千代田区丸の内29丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 30, '山田太郎30', '東京都千代田区丸の内30丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 31, '山田太郎31', '東京都千代田区丸の内31丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 32, '山田太郎32', '東京都千代田区丸の内32丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 33, '山田太郎33', '東京都千代田区丸の内33丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 34, '山田太郎34', '東京都千代田区丸の内34丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 35, '山田太郎35', '東京都千代田区丸の内35丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 36, '山田太郎36', '東京都千代田区丸の内36丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 37, '山田太郎37', '東京都千代田区丸の内37丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 38, '山田太郎38', '東京都千代田区丸の内38丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 39, '山田太郎39', '東京都千代田区丸の内39丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 40, '山田太郎40', '東京都千代田区丸の内40丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 41, '山田太郎41', '東京都千代田区丸の内41丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 42, '山田太郎42', '東京都千代田区丸の内42丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 43, '山田太郎43', '東京都千代田区丸の内43丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 44, '山田太郎44', '東京都千代田区丸の内44丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 45, '山田太郎45', '東京都千代田区丸の内45丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 46, '山田太郎46', '東京都千代田区丸の内46丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 47, '山田太郎47', '東京都千代田区丸の内47丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 48, '山田太郎48', '東京都千代田区丸の内48丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 49, '山田太郎49', '東京都千代田区丸の内49丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 50, '山田太郎50', '東京都千代田区丸の内50丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 51, '山田太郎51', '東京都千代田区丸の内51丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 52, '山田太郎52', '東京都千代田区丸の内52丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 53, '山田太郎53', '東京都千代田区丸の内53丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 54, '山田太郎54', '東京都千代田区丸の内54丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 55, '山田太郎55', '東京都千代田区丸の内55丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 56, '山田太郎56', '東京都千代田区丸の内56丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 57, '山田太郎57', '東京都千代田区丸の内57丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 58, '山田太郎58', '東京都千代田区丸の内58丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 59, '山田太郎59', '東京都千代田区丸の内59丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 60, '山田太郎60', '東京都千代田区丸の内60丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 61, '山田太郎61', '東京都千代田区丸の内61丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 62, '山田太郎62', '東京都千代田区丸の内62丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 63, '山田太郎63', '東京都千代田区丸の内63丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 64, '山田太郎64', '東京都千代田区丸の内64丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 65, '山田太郎65', '東京都千代田区丸の内65丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 66, '山田太郎66', '東京都千代田区丸の内66丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 67, '山田太郎67', '東京都千代田区丸の内67丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 68, '山田太郎68', '東京都千代田区丸の内68丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 69, '山田太郎69', '東京都千代田区丸の内69丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 70, '山田太郎70', '東京都千代田区丸の内70丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 71, '山田太郎71', '東京都千代田区丸の内71丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 72, '山田太郎72', '東京都千代田区丸の内72丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 73, '山田太郎73', '東京都千代田区丸の内73丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 74, '山田太郎74', '東京都千代田区丸の内74丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 75, '山田太郎75', '東京都千代田区丸の内75丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 76, '山田太郎76', '東京都千代田区丸の内76丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 77, '山田太郎77', '東京都千代田区丸の内77丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 78, '山田太郎78', '東京都千代田区丸の内78丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 79, '山田太郎79', '東京都千代田区丸の内79丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 80, '山田太郎80', '東京都千代田区丸の内80丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 81, '山田太郎81', '東京都千代田区丸の内81丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 82, '山田太郎82', '東京都千代田区丸の内82丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 83, '山田太郎83', '東京都千代田区丸の内83丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 84, '山田太郎84', '東京都千代田区丸の内84丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 85, '山田太郎85', '東京都千代田区丸の内85丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 86, '山田太郎86', '東京都千代田区丸の内86丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 87, '山田太郎87', '東京都千代田区丸の内87丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 88, '山田太郎88', '東京都千代田区丸の内88丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 89, '山田太郎89', '東京都千代田区丸の内89丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 90, '山田太郎90', '東京都千代田区丸の内90丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 91, '山田太郎91', '東京都千代田区丸の内91丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 92, '山田太郎92', '東京都千代田区丸の内92丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 93, '山田太郎93', '東京都千代田区丸の内93丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 94, '山田太郎94', '東京都千代田区丸の内94丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 95, '山田太郎95', '東京都千代田区丸の内95丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 96, '山田太郎96', '東京都千代田区丸の内96丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 97, '山田太郎97', '東京都千代田区丸の内0丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 98, '山田太郎98', '東京都千代田区丸の内1丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 99, '山田太郎99', '東京都千代田区丸の内2丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 100, '山田太郎100', '東京都千代田区丸の内3丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 101, '山田太郎101', '東京都千代田区丸の内4丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 102, '山田太郎102', '東京都千代田区丸の内5丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 103, '山田太郎103', '東京都千代田区丸の内6丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 104, '山田太郎104', '東京都千代田区丸の内7丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 105, '山田太郎105', '東京都千代田区丸の内8丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 106, '山田太郎106', '東京都千代田区丸の内9丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 107, '山田太郎107', '東京都千代田区丸の内10丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 108, '山田太郎108', '東京都千代田区丸の内11丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 109, '山田太郎109', '東京都千代田区丸の内12丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 110, '山田太郎110', '東京都千代田区丸の内13丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 111, '山田太郎111', '東京都千代田区丸の内14丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 112, '山田太郎112', '東京都千代田区丸の内15丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 113, '山田太郎113', '東京都千代田区丸の内16丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 114, '山田太郎114', '東京都千代田区丸の内17丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 115, '山田太郎115', '東京都千代田区丸の内18丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 116, '山田太郎116', '東京都千代田区丸の内19丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 117, '山田太郎117', '東京都千代田区丸の内20丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 118, '山田太郎118', '東京都千代田区丸の内21丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 119, '山田太郎119', '東京都千代田区丸の内22丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 120, '山田太郎120', '東京都千代田区丸の内23丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 121, '山田太郎121', '東京都千代田区丸の内24丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 122, '山田太郎122', '東京都千代田区丸の内25丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 123, '山田太郎123', '東京都千代田区丸の内26丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 124, '山田太郎124', '東京都千代田区丸の内27丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 125, '山田太郎125', '東京都千代田区丸の内28丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 126, '山田太郎126', '東京都千代田区丸の内29丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 127, '山田太郎127', '東京都千代田区丸の内30丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 128, '山田太郎128', '東京都千代田区丸の内31丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 129, '山田太郎129', '東京都千代田区丸の内32丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 130, '山田太郎130', '東京都千代田区丸の内33丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 131, '山田太郎131', '東京都千代田区丸の内34丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 132, '山田太郎132', '東京都千代田区丸の内35丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 133, '山田太郎133', '東京都千代田区丸の内36丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 134, '山田太郎134', '東京都千代田区丸の内37丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 135, '山田太郎135', '東京都千代田区丸の内38丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 136, '山田太郎136', '東京都千代田区丸の内39丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 137, '山田太郎137', '東京都千代田区丸の内40丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 138, '山田太郎138', '東京都千代田区丸の内41丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 139, '山田太郎139', '東京都千代田区丸の内42丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 140, '山田太郎140', '東京都千代田区丸の内43丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 141, '山田太郎141', '東京都千代田区丸の内44丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 142, '山田太郎142', '東京都千代田区丸の内45丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 143, '山田太郎143', '東京都千代田区丸の内46丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 144, '山田太郎144', '東京都千代田区丸の内47丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 145, '山田太郎145', '東京都千代田区丸の内48丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 146, '山田太郎146', '東京都千代田区丸の内49丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 147, '山田太郎147', '東京都千代田区丸の内50丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 148, '山田太郎148', '東京都千代田区丸の内51丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 149, '山田太郎149', '東京都千代田区丸の内52丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 150, '山田太郎150', '東京都千代田区丸の内53丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 151, '山田太郎151', '東京都千代田区丸の内54丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 152, '山田太郎152', '東京都千代田区丸の内55丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 153, '山田太郎153', '東京都千代田区丸の内56丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 154, '山田太郎154', '東京都千代田区丸の内57丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 155, '山田太郎155', '東京都千代田区丸の内58丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 156, '山田太郎156', '東京都千代田区丸の内59丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 157, '山田太郎157', '東京都千代田区丸の内60丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 158, '山田太郎158', '東京都千代田区丸の内61丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 159, '山田太郎159', '東京都千代田区丸の内62丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 160, '山田太郎160', '東京都千代田区丸の内63丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 161, '山田太郎161', '東京都千代田区丸の内64丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 162, '山田太郎162', '東京都千代田区丸の内65丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 163, '山田太郎163', '東京都千代田区丸の内66丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 164, '山田太郎164', '東京都千代田区丸の内67丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 165, '山田太郎165', '東京都千代田区丸の内68丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 166, '山田太郎166', '東京都千代田区丸の内69丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 167, '山田太郎167', '東京都千代田区丸の内70丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 168, '山田太郎168', '東京都千代田区丸の内71丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 169, '山田太郎169', '東京都千代田区丸の内72丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 170, '山田太郎170', '東京都千代田区丸の内73丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 171, '山田太郎171', '東京都千代田区丸の内74丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 172, '山田太郎172', '東京都千代田区丸の内75丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 173, '山田太郎173', '東京都千代田区丸の内76丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 174, '山田太郎174', '東京都千代田区丸の内77丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 175, '山田太郎175', '東京都千代田区丸の内78丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 176, '山田太郎176', '東京都千代田区丸の内79丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 177, '山田太郎177', '東京都千代田区丸の内80丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 178, '山田太郎178', '東京都千代田区丸の内81丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 179, '山田太郎179', '東京都千代田区丸の内82丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 180, '山田太郎180', '東京都千代田区丸の内83丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 181, '山田太郎181', '東京都千代田区丸の内84丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 182, '山田太郎182', '東京都千代田区丸の内85丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 183, '山田太郎183', '東京都千代田区丸の内86丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 184, '山田太郎184', '東京都千代田区丸の内87丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 185, '山田太郎185', '東京都千代田区丸の内88丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 186, '山田太郎186', '東京都千代田区丸の内89丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 187, '山田太郎187', '東京都千代田区丸の内90丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 188, '山田太郎188', '東京都千代田区丸の内91丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 189, '山田太郎189', '東京都千代田区丸の内92丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 190, '山田太郎190', '東京都千代田区丸の内93丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 191, '山田太郎191', '東京都千代田区丸の内94丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 192, '山田太郎192', '東京都千代田区丸の内95丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 193, '山田太郎193', '東京都千代田区丸の内96丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 194, '山田太郎194', '東京都千代田区丸の内0丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 195, '山田太郎195', '東京都千代田区丸の内1丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 196, '山田太郎196', '東京都千代田区丸の内2丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 197, '山田太郎197', '東京都千代田区丸の内3丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 198, '山田太郎198', '東京都千代田区丸の内4丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
+insert into 顧客( id, 名前, 住所, 備考 ) values ( 199, '山田太郎199', '東京都千代田区丸の内5丁目', '重要な顧客です。来週月曜日に新しい契約書を送付する予定。' );
@@ -0,0 +1,204 @@
+/*
+** @file
+** @brief Benchmark input: UTF-8 encoded mixed German text without byte order mark.
+*/
+insert into kunde( id, name, ort, bemerkung ) values ( 0, 'Müller-Lüdenscheidt 0', 'Straße 0, Köln', 'Größere Änderung für Kunde 0: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 1, 'Müller-Lüdenscheidt 1', 'Straße 1, Köln', 'Größere Änderung für Kunde 1: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 2, 'Müller-Lüdenscheidt 2', 'Straße 2, Köln', 'Größere Änderung für Kunde 2: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 3, 'Müller-Lüdenscheidt 3', 'Straße 3, Köln', 'Größere Änderung für Kunde 3: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 4, 'Müller-Lüdenscheidt 4', 'Straße 4, Köln', 'Größere Änderung für Kunde 4: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 5, 'Müller-Lüdenscheidt 5', 'Straße 5, Köln', 'Größere Änderung für Kunde 5: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 6, 'Müller-Lüdenscheidt 6', 'Straße 6, Köln', 'Größere Änderung für Kunde 6: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 7, 'Müller-Lüdenscheidt 7', 'Straße 7, Köln', 'Größere Änderung für Kunde 7: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 8, 'Müller-Lüdenscheidt 8', 'Straße 8, Köln', 'Größere Änderung für Kunde 8: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 9, 'Müller-Lüdenscheidt 9', 'Straße 9, Köln', 'Größere Änderung für Kunde 9: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 10, 'Müller-Lüdenscheidt 10', 'Straße 10, Köln', 'Größere Änderung für Kunde 10: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 11, 'Müller-Lüdenscheidt 11', 'Straße 11, Köln', 'Größere Änderung für Kunde 11: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 12, 'Müller-Lüdenscheidt 12', 'Straße 12, Köln', 'Größere Änderung für Kunde 12: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 13, 'Müller-Lüdenscheidt 13', 'Straße 13, Köln', 'Größere Änderung für Kunde 13: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 14, 'Müller-Lüdenscheidt 14', 'Straße 14, Köln', 'Größere Änderung für Kunde 14: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 15, 'Müller-Lüdenscheidt 15', 'Straße 15, Köln', 'Größere Änderung für Kunde 15: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 16, 'Müller-Lüdenscheidt 16', 'Straße 16, Köln', 'Größere Änderung für Kunde 16: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 17, 'Müller-Lüdenscheidt 17', 'Straße 17, Köln', 'Größere Änderung für Kunde 17: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 18, 'Müller-Lüdenscheidt 18', 'Straße 18, Köln', 'Größere Änderung für Kunde 18: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 19, 'Müller-Lüdenscheidt 19', 'Straße 19, Köln', 'Größere Änderung für Kunde 19: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 20, 'Müller-Lüdenscheidt 20', 'Straße 20, Köln', 'Größere Änderung für Kunde 20: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 21, 'Müller-Lüdenscheidt 21', 'Straße 21, Köln', 'Größere Änderung für Kunde 21: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 22, 'Müller-Lüdenscheidt 22', 'Straße 22, Köln', 'Größere Änderung für Kunde 22: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 23, 'Müller-Lüdenscheidt 23', 'Straße 23, Köln', 'Größere Änderung für Kunde 23: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 24, 'Müller-Lüdenscheidt 24', 'Straße 24, Köln', 'Größere Änderung für Kunde 24: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 25, 'Müller-Lüdenscheidt 25', 'Straße 25, Köln', 'Größere Änderung für Kunde 25: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 26, 'Müller-Lüdenscheidt 26', 'Straße 26, Köln', 'Größere Änderung für Kunde 26: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 27, 'Müller-Lüdenscheidt 27', 'Straße 27, Köln', 'Größere Änderung für Kunde 27: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 28, 'Müller-Lüdenscheidt 28', 'Straße 28, Köln', 'Größere Änderung für Kunde 28: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 29, 'Müller-Lüdenscheidt 29', 'Straße 29, Köln', 'Größere Änderung für Kunde 29: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 30, 'Müller-Lüdenscheidt 30', 'Straße 30, Köln', 'Größere Änderung für Kunde 30: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 31, 'Müller-Lüdenscheidt 31', 'Straße 31, Köln', 'Größere Änderung für Kunde 31: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 32, 'Müller-Lüdenscheidt 32', 'Straße 32, Köln', 'Größere Änderung für Kunde 32: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 33, 'Müller-Lüdenscheidt 33', 'Straße 33, Köln', 'Größere Änderung für Kunde 33: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 34, 'Müller-Lüdenscheidt 34', 'Straße 34, Köln', 'Größere Änderung für Kunde 34: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 35, 'Müller-Lüdenscheidt 35', 'Straße 35, Köln', 'Größere Änderung für Kunde 35: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 36, 'Müller-Lüdenscheidt 36', 'Straße 36, Köln', 'Größere Änderung für Kunde 36: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 37, 'Müller-Lüdenscheidt 37', 'Straße 37, Köln', 'Größere Änderung für Kunde 37: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 38, 'Müller-Lüdenscheidt 38', 'Straße 38, Köln', 'Größere Änderung für Kunde 38: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 39, 'Müller-Lüdenscheidt 39', 'Straße 39, Köln', 'Größere Änderung für Kunde 39: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 40, 'Müller-Lüdenscheidt 40', 'Straße 40, Köln', 'Größere Änderung für Kunde 40: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 41, 'Müller-Lüdenscheidt 41', 'Straße 41, Köln', 'Größere Änderung für Kunde 41: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 42, 'Müller-Lüdenscheidt 42', 'Straße 42, Köln', 'Größere Änderung für Kunde 42: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 43, 'Müller-Lüdenscheidt 43', 'Straße 43, Köln', 'Größere Änderung für Kunde 43: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 44, 'Müller-Lüdenscheidt 44', 'Straße 44, Köln', 'Größere Änderung für Kunde 44: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 45, 'Müller-Lüdenscheidt 45', 'Straße 45, Köln', 'Größere Änderung für Kunde 45: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 46, 'Müller-Lüdenscheidt 46', 'Straße 46, Köln', 'Größere Änderung für Kunde 46: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 47, 'Müller-Lüdenscheidt 47', 'Straße 47, Köln', 'Größere Änderung für Kunde 47: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 48, 'Müller-Lüdenscheidt 48', 'Straße 48, Köln', 'Größere Änderung für Kunde 48: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 49, 'Müller-Lüdenscheidt 49', 'Straße 49, Köln', 'Größere Änderung für Kunde 49: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 50, 'Müller-Lüdenscheidt 50', 'Straße 50, Köln', 'Größere Änderung für Kunde 50: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 51, 'Müller-Lüdenscheidt 51', 'Straße 51, Köln', 'Größere Änderung für Kunde 51: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 52, 'Müller-Lüdenscheidt 52', 'Straße 52, Köln', 'Größere Änderung für Kunde 52: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 53, 'Müller-Lüdenscheidt 53', 'Straße 53, Köln', 'Größere Änderung für Kunde 53: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 54, 'Müller-Lüdenscheidt 54', 'Straße 54, Köln', 'Größere Änderung für Kunde 54: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 55, 'Müller-Lüdenscheidt 55', 'Straße 55, Köln', 'Größere Änderung für Kunde 55: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 56, 'Müller-Lüdenscheidt 56', 'Straße 56, Köln', 'Größere Änderung für Kunde 56: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 57, 'Müller-Lüdenscheidt 57', 'Straße 57, Köln', 'Größere Änderung für Kunde 57: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 58, 'Müller-Lüdenscheidt 58', 'Straße 58, Köln', 'Größere Änderung für Kunde 58: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 59, 'Müller-Lüdenscheidt 59', 'Straße 59, Köln', 'Größere Änderung für Kunde 59: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 60, 'Müller-Lüdenscheidt 60', 'Straße 60, Köln', 'Größere Änderung für Kunde 60: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 61, 'Müller-Lüdenscheidt 61', 'Straße 61, Köln', 'Größere Änderung für Kunde 61: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 62, 'Müller-Lüdenscheidt 62', 'Straße 62, Köln', 'Größere Änderung für Kunde 62: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 63, 'Müller-Lüdenscheidt 63', 'Straße 63, Köln', 'Größere Änderung für Kunde 63: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 64, 'Müller-Lüdenscheidt 64', 'Straße 64, Köln', 'Größere Änderung für Kunde 64: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 65, 'Müller-Lüdenscheidt 65', 'Straße 65, Köln', 'Größere Änderung für Kunde 65: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 66, 'Müller-Lüdenscheidt 66', 'Straße 66, Köln', 'Größere Änderung für Kunde 66: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 67, 'Müller-Lüdenscheidt 67', 'Straße 67, Köln', 'Größere Änderung für Kunde 67: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 68, 'Müller-Lüdenscheidt 68', 'Straße 68, Köln', 'Größere Änderung für Kunde 68: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 69, 'Müller-Lüdenscheidt 69', 'Straße 69, Köln', 'Größere Änderung für Kunde 69: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 70, 'Müller-Lüdenscheidt 70', 'Straße 70, Köln', 'Größere Änderung für Kunde 70: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 71, 'Müller-Lüdenscheidt 71', 'Straße 71, Köln', 'Größere Änderung für Kunde 71: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 72, 'Müller-Lüdenscheidt 72', 'Straße 72, Köln', 'Größere Änderung für Kunde 72: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 73, 'Müller-Lüdenscheidt 73', 'Straße 73, Köln', 'Größere Änderung für Kunde 73: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 74, 'Müller-Lüdenscheidt 74', 'Straße 74, Köln', 'Größere Änderung für Kunde 74: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 75, 'Müller-Lüdenscheidt 75', 'Straße 75, Köln', 'Größere Änderung für Kunde 75: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 76, 'Müller-Lüdenscheidt 76', 'Straße 76, Köln', 'Größere Änderung für Kunde 76: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 77, 'Müller-Lüdenscheidt 77', 'Straße 77, Köln', 'Größere Änderung für Kunde 77: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 78, 'Müller-Lüdenscheidt 78', 'Straße 78, Köln', 'Größere Änderung für Kunde 78: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 79, 'Müller-Lüdenscheidt 79', 'Straße 79, Köln', 'Größere Änderung für Kunde 79: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 80, 'Müller-Lüdenscheidt 80', 'Straße 80, Köln', 'Größere Änderung für Kunde 80: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 81, 'Müller-Lüdenscheidt 81', 'Straße 81, Köln', 'Größere Änderung für Kunde 81: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 82, 'Müller-Lüdenscheidt 82', 'Straße 82, Köln', 'Größere Änderung für Kunde 82: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 83, 'Müller-Lüdenscheidt 83', 'Straße 83, Köln', 'Größere Änderung für Kunde 83: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 84, 'Müller-Lüdenscheidt 84', 'Straße 84, Köln', 'Größere Änderung für Kunde 84: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 85, 'Müller-Lüdenscheidt 85', 'Straße 85, Köln', 'Größere Änderung für Kunde 85: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 86, 'Müller-Lüdenscheidt 86', 'Straße 86, Köln', 'Größere Änderung für Kunde 86: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 87, 'Müller-Lüdenscheidt 87', 'Straße 87, Köln', 'Größere Änderung für Kunde 87: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 88, 'Müller-Lüdenscheidt 88', 'Straße 88, Köln', 'Größere Änderung für Kunde 88: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 89, 'Müller-Lüdenscheidt 89', 'Straße 89, Köln', 'Größere Änderung für Kunde 89: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 90, 'Müller-Lüdenscheidt 90', 'Straße 90, Köln', 'Größere Änderung für Kunde 90: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 91, 'Müller-Lüdenscheidt 91', 'Straße 91, Köln', 'Größere Änderung für Kunde 91: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 92, 'Müller-Lüdenscheidt 92', 'Straße 92, Köln', 'Größere Änderung für Kunde 92: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 93, 'Müller-Lüdenscheidt 93', 'Straße 93, Köln', 'Größere Änderung für Kunde 93: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 94, 'Müller-Lüdenscheidt 94', 'Straße 94, Köln', 'Größere Änderung für Kunde 94: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 95, 'Müller-Lüdenscheidt 95', 'Straße 95, Köln', 'Größere Änderung für Kunde 95: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 96, 'Müller-Lüdenscheidt 96', 'Straße 96, Köln', 'Größere Änderung für Kunde 96: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 97, 'Müller-Lüdenscheidt 97', 'Straße 0, Köln', 'Größere Änderung für Kunde 97: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 98, 'Müller-Lüdenscheidt 98', 'Straße 1, Köln', 'Größere Änderung für Kunde 98: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 99, 'Müller-Lüdenscheidt 99', 'Straße 2, Köln', 'Größere Änderung für Kunde 99: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 100, 'Müller-Lüdenscheidt 100', 'Straße 3, Köln', 'Größere Änderung für Kunde 100: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 101, 'Müller-Lüdenscheidt 101', 'Straße 4, Köln', 'Größere Änderung für Kunde 101: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 102, 'Müller-Lüdenscheidt 102', 'Straße 5, Köln', 'Größere Änderung für Kunde 102: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 103, 'Müller-Lüdenscheidt 103', 'Straße 6, Köln', 'Größere Änderung für Kunde 103: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 104, 'Müller-Lüdenscheidt 104', 'Straße 7, Köln', 'Größere Änderung für Kunde 104: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 105, 'Müller-Lüdenscheidt 105', 'Straße 8, Köln', 'Größere Änderung für Kunde 105: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 106, 'Müller-Lüdenscheidt 106', 'Straße 9, Köln', 'Größere Änderung für Kunde 106: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 107, 'Müller-Lüdenscheidt 107', 'Straße 10, Köln', 'Größere Änderung für Kunde 107: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 108, 'Müller-Lüdenscheidt 108', 'Straße 11, Köln', 'Größere Änderung für Kunde 108: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 109, 'Müller-Lüdenscheidt 109', 'Straße 12, Köln', 'Größere Änderung für Kunde 109: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 110, 'Müller-Lüdenscheidt 110', 'Straße 13, Köln', 'Größere Änderung für Kunde 110: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 111, 'Müller-Lüdenscheidt 111', 'Straße 14, Köln', 'Größere Änderung für Kunde 111: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 112, 'Müller-Lüdenscheidt 112', 'Straße 15, Köln', 'Größere Änderung für Kunde 112: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 113, 'Müller-Lüdenscheidt 113', 'Straße 16, Köln', 'Größere Änderung für Kunde 113: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 114, 'Müller-Lüdenscheidt 114', 'Straße 17, Köln', 'Größere Änderung für Kunde 114: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 115, 'Müller-Lüdenscheidt 115', 'Straße 18, Köln', 'Größere Änderung für Kunde 115: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 116, 'Müller-Lüdenscheidt 116', 'Straße 19, Köln', 'Größere Änderung für Kunde 116: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 117, 'Müller-Lüdenscheidt 117', 'Straße 20, Köln', 'Größere Änderung für Kunde 117: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 118, 'Müller-Lüdenscheidt 118', 'Straße 21, Köln', 'Größere Änderung für Kunde 118: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 119, 'Müller-Lüdenscheidt 119', 'Straße 22, Köln', 'Größere Änderung für Kunde 119: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 120, 'Müller-Lüdenscheidt 120', 'Straße 23, Köln', 'Größere Änderung für Kunde 120: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 121, 'Müller-Lüdenscheidt 121', 'Straße 24, Köln', 'Größere Änderung für Kunde 121: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 122, 'Müller-Lüdenscheidt 122', 'Straße 25, Köln', 'Größere Änderung für Kunde 122: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 123, 'Müller-Lüdenscheidt 123', 'Straße 26, Köln', 'Größere Änderung für Kunde 123: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 124, 'Müller-Lüdenscheidt 124', 'Straße 27, Köln', 'Größere Änderung für Kunde 124: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 125, 'Müller-Lüdenscheidt 125', 'Straße 28, Köln', 'Größere Änderung für Kunde 125: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 126, 'Müller-Lüdenscheidt 126', 'Straße 29, Köln', 'Größere Änderung für Kunde 126: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 127, 'Müller-Lüdenscheidt 127', 'Straße 30, Köln', 'Größere Änderung für Kunde 127: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 128, 'Müller-Lüdenscheidt 128', 'Straße 31, Köln', 'Größere Änderung für Kunde 128: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 129, 'Müller-Lüdenscheidt 129', 'Straße 32, Köln', 'Größere Änderung für Kunde 129: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 130, 'Müller-Lüdenscheidt 130', 'Straße 33, Köln', 'Größere Änderung für Kunde 130: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 131, 'Müller-Lüdenscheidt 131', 'Straße 34, Köln', 'Größere Änderung für Kunde 131: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 132, 'Müller-Lüdenscheidt 132', 'Straße 35, Köln', 'Größere Änderung für Kunde 132: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 133, 'Müller-Lüdenscheidt 133', 'Straße 36, Köln', 'Größere Änderung für Kunde 133: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 134, 'Müller-Lüdenscheidt 134', 'Straße 37, Köln', 'Größere Änderung für Kunde 134: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 135, 'Müller-Lüdenscheidt 135', 'Straße 38, Köln', 'Größere Änderung für Kunde 135: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 136, 'Müller-Lüdenscheidt 136', 'Straße 39, Köln', 'Größere Änderung für Kunde 136: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 137, 'Müller-Lüdenscheidt 137', 'Straße 40, Köln', 'Größere Änderung für Kunde 137: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 138, 'Müller-Lüdenscheidt 138', 'Straße 41, Köln', 'Größere Änderung für Kunde 138: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 139, 'Müller-Lüdenscheidt 139', 'Straße 42, Köln', 'Größere Änderung für Kunde 139: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 140, 'Müller-Lüdenscheidt 140', 'Straße 43, Köln', 'Größere Änderung für Kunde 140: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 141, 'Müller-Lüdenscheidt 141', 'Straße 44, Köln', 'Größere Änderung für Kunde 141: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 142, 'Müller-Lüdenscheidt 142', 'Straße 45, Köln', 'Größere Änderung für Kunde 142: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 143, 'Müller-Lüdenscheidt 143', 'Straße 46, Köln', 'Größere Änderung für Kunde 143: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 144, 'Müller-Lüdenscheidt 144', 'Straße 47, Köln', 'Größere Änderung für Kunde 144: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 145, 'Müller-Lüdenscheidt 145', 'Straße 48, Köln', 'Größere Änderung für Kunde 145: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 146, 'Müller-Lüdenscheidt 146', 'Straße 49, Köln', 'Größere Änderung für Kunde 146: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 147, 'Müller-Lüdenscheidt 147', 'Straße 50, Köln', 'Größere Änderung für Kunde 147: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 148, 'Müller-Lüdenscheidt 148', 'Straße 51, Köln', 'Größere Änderung für Kunde 148: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 149, 'Müller-Lüdenscheidt 149', 'Straße 52, Köln', 'Größere Änderung für Kunde 149: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 150, 'Müller-Lüdenscheidt 150', 'Straße 53, Köln', 'Größere Änderung für Kunde 150: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 151, 'Müller-Lüdenscheidt 151', 'Straße 54, Köln', 'Größere Änderung für Kunde 151: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 152, 'Müller-Lüdenscheidt 152', 'Straße 55, Köln', 'Größere Änderung für Kunde 152: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 153, 'Müller-Lüdenscheidt 153', 'Straße 56, Köln', 'Größere Änderung für Kunde 153: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 154, 'Müller-Lüdenscheidt 154', 'Straße 57, Köln', 'Größere Änderung für Kunde 154: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 155, 'Müller-Lüdenscheidt 155', 'Straße 58, Köln', 'Größere Änderung für Kunde 155: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 156, 'Müller-Lüdenscheidt 156', 'Straße 59, Köln', 'Größere Änderung für Kunde 156: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 157, 'Müller-Lüdenscheidt 157', 'Straße 60, Köln', 'Größere Änderung für Kunde 157: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 158, 'Müller-Lüdenscheidt 158', 'Straße 61, Köln', 'Größere Änderung für Kunde 158: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 159, 'Müller-Lüdenscheidt 159', 'Straße 62, Köln', 'Größere Änderung für Kunde 159: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 160, 'Müller-Lüdenscheidt 160', 'Straße 63, Köln', 'Größere Änderung für Kunde 160: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 161, 'Müller-Lüdenscheidt 161', 'Straße 64, Köln', 'Größere Änderung für Kunde 161: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 162, 'Müller-Lüdenscheidt 162', 'Straße 65, Köln', 'Größere Änderung für Kunde 162: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 163, 'Müller-Lüdenscheidt 163', 'Straße 66, Köln', 'Größere Änderung für Kunde 163: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 164, 'Müller-Lüdenscheidt 164', 'Straße 67, Köln', 'Größere Änderung für Kunde 164: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 165, 'Müller-Lüdenscheidt 165', 'Straße 68, Köln', 'Größere Änderung für Kunde 165: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 166, 'Müller-Lüdenscheidt 166', 'Straße 69, Köln', 'Größere Änderung für Kunde 166: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 167, 'Müller-Lüdenscheidt 167', 'Straße 70, Köln', 'Größere Änderung für Kunde 167: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 168, 'Müller-Lüdenscheidt 168', 'Straße 71, Köln', 'Größere Änderung für Kunde 168: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 169, 'Müller-Lüdenscheidt 169', 'Straße 72, Köln', 'Größere Änderung für Kunde 169: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 170, 'Müller-Lüdenscheidt 170', 'Straße 73, Köln', 'Größere Änderung für Kunde 170: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 171, 'Müller-Lüdenscheidt 171', 'Straße 74, Köln', 'Größere Änderung für Kunde 171: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 172, 'Müller-Lüdenscheidt 172', 'Straße 75, Köln', 'Größere Änderung für Kunde 172: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 173, 'Müller-Lüdenscheidt 173', 'Straße 76, Köln', 'Größere Änderung für Kunde 173: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 174, 'Müller-Lüdenscheidt 174', 'Straße 77, Köln', 'Größere Änderung für Kunde 174: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 175, 'Müller-Lüdenscheidt 175', 'Straße 78, Köln', 'Größere Änderung für Kunde 175: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 176, 'Müller-Lüdenscheidt 176', 'Straße 79, Köln', 'Größere Änderung für Kunde 176: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 177, 'Müller-Lüdenscheidt 177', 'Straße 80, Köln', 'Größere Änderung für Kunde 177: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 178, 'Müller-Lüdenscheidt 178', 'Straße 81, Köln', 'Größere Änderung für Kunde 178: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 179, 'Müller-Lüdenscheidt 179', 'Straße 82, Köln', 'Größere Änderung für Kunde 179: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 180, 'Müller-Lüdenscheidt 180', 'Straße 83, Köln', 'Größere Änderung für Kunde 180: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 181, 'Müller-Lüdenscheidt 181', 'Straße 84, Köln', 'Größere Änderung für Kunde 181: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 182, 'Müller-Lüdenscheidt 182', 'Straße 85, Köln', 'Größere Änderung für Kunde 182: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 183, 'Müller-Lüdenscheidt 183', 'Straße 86, Köln', 'Größere Änderung für Kunde 183: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 184, 'Müller-Lüdenscheidt 184', 'Straße 87, Köln', 'Größere Änderung für Kunde 184: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 185, 'Müller-Lüdenscheidt 185', 'Straße 88, Köln', 'Größere Änderung für Kunde 185: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 186, 'Müller-Lüdenscheidt 186', 'Straße 89, Köln', 'Größere Änderung für Kunde 186: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 187, 'Müller-Lüdenscheidt 187', 'Straße 90, Köln', 'Größere Änderung für Kunde 187: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 188, 'Müller-Lüdenscheidt 188', 'Straße 91, Köln', 'Größere Änderung für Kunde 188: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 189, 'Müller-Lüdenscheidt 189', 'Straße 92, Köln', 'Größere Änderung für Kunde 189: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 190, 'Müller-Lüdenscheidt 190', 'Straße 93, Köln', 'Größere Änderung für Kunde 190: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 191, 'Müller-Lüdenscheidt 191', 'Straße 94, Köln', 'Größere Änderung für Kunde 191: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 192, 'Müller-Lüdenscheidt 192', 'Straße 95, Köln', 'Größere Änderung für Kunde 192: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 193, 'Müller-Lüdenscheidt 193', 'Straße 96, Köln', 'Größere Änderung für Kunde 193: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 194, 'Müller-Lüdenscheidt 194', 'Straße 0, Köln', 'Größere Änderung für Kunde 194: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 195, 'Müller-Lüdenscheidt 195', 'Straße 1, Köln', 'Größere Änderung für Kunde 195: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 196, 'Müller-Lüdenscheidt 196', 'Straße 2, Köln', 'Größere Änderung für Kunde 196: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 197, 'Müller-Lüdenscheidt 197', 'Straße 3, Köln', 'Größere Änderung für Kunde 197: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 198, 'Müller-Lüdenscheidt 198', 'Straße 4, Köln', 'Größere Änderung für Kunde 198: Übergabe am Montag, Preis 12 €' );
+insert into kunde( id, name, ort, bemerkung ) values ( 199, 'Müller-Lüdenscheidt 199', 'Straße 5, Köln', 'Größere Änderung für Kunde 199: Übergabe am Montag, Preis 12 €' );
@@ -0,0 +1 @@
+-- Benchmark input: Empty include directory searched first.
@@ -0,0 +1,2 @@
+-- columns.h: small header without include guard found in the last include directory
+select 'columns' as part, __LINE__ as line from dual;
@@ -0,0 +1,2 @@
+-- grants.h: small header without include guard found in the last include directory
+select 'grants' as part, __LINE__ as line from dual;
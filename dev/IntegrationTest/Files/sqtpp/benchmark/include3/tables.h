@@ -0,0 +1,2 @@
+-- tables.h: small header without include guard found in the last include directory
+select 'tables' as part, __LINE__ as line from dual;
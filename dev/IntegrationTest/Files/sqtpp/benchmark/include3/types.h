@@ -0,0 +1,2 @@
+-- types.h: small header without include guard found in the last include directory
+select 'types' as part, __LINE__ as line from dual;
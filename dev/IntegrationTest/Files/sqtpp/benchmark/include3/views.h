@@ -0,0 +1,2 @@
+-- views.h: small header without include guard found in the last include directory
+select 'views' as part, __LINE__ as line from dual;
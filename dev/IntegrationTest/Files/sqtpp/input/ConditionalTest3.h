@@ -0,0 +1,13 @@
+/*
+** @file 
+** @brief Check the results of a header included more than once with changed macros.
+*/
+#define SEL LEVEL
+#define LEVEL 1
+#include "include/conditional3.h"
+#undef LEVEL
+#define LEVEL 2
+#include "include/conditional3.h"
+#include "include/conditional3.h"
+#undef LEVEL
+#include "include/conditional3.h"
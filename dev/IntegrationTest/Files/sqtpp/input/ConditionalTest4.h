@@ -0,0 +1,14 @@
+/*
+** @file 
+** @brief Check skipping of conditional blocks in a header included more than once.
+*/
+#define MODE_B 1
+#include "include/conditional4.h"
+#include "include/conditional4.h"
+#define MODE_A
+#include "include/conditional4.h"
+#include "include/conditional4.h"
+#undef MODE_A
+#undef MODE_B
+#define MODE_B 0
+#include "include/conditional4.h"
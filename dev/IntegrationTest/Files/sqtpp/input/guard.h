@@ -0,0 +1,14 @@
+/**
+** @file
+** @brief Include a file with an include guard several times.
+*/
+// first time --> must include
+#include "include/guard.h"
+
+// guard macro defined --> dont include
+#include "include/guard.h"
+
+// guard macro undefined --> include again
+#undef GUARD_H
+#include "include/guard.h"
+#include "include/guard.h"
@@ -0,0 +1,7 @@
+#if SEL == 1
+level 1
+#elif SEL == 2
+level 2
+#else
+no level
+#endif
@@ -0,0 +1,28 @@
+#ifdef MODE_A
+mode a __LINE__
+#  if 1
+nested #if in a
+#  else
+nested #else in a
+#  endif
+#elif MODE_B
+mode b __LINE__
+#ifndef MODE_A
+nested in b
+#endif
+#else
+no mode __LINE__
+#endif
+#if 0
+never # used
+  #  ifdef NESTED
+#endif
+#else
+line __LINE__
+#endif
+#ifndef MODE_A
+not a __LINE__
+#else
+
+#endif
+end __LINE__
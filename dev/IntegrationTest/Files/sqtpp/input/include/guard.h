@@ -0,0 +1,7 @@
+/*
+** @file Include file for the guard.h test case.
+*/
+#ifndef GUARD_H
+#define GUARD_H
+guard.h included __LINE__
+#endif // GUARD_H
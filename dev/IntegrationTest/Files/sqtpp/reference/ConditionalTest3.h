@@ -0,0 +1,41 @@
+
+
+
+
+
+
+
+
+level 1
+
+
+
+
+
+
+
+
+
+
+
+level 2
+
+
+
+
+
+
+
+level 2
+
+
+
+
+
+
+
+
+
+
+no level
+
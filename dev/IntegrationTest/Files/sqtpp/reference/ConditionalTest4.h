@@ -0,0 +1,153 @@
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+mode b 9
+
+nested in b
+
+
+
+
+
+
+
+
+
+line 21
+
+
+not a 24
+
+
+
+end 28
+
+
+
+
+
+
+
+
+
+mode b 9
+
+nested in b
+
+
+
+
+
+
+
+
+
+line 21
+
+
+not a 24
+
+
+
+end 28
+
+
+mode a 2
+
+nested #if in a
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+line 21
+
+
+
+
+
+
+end 28
+
+
+mode a 2
+
+nested #if in a
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+line 21
+
+
+
+
+
+
+end 28
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+no mode 14
+
+
+
+
+
+
+line 21
+
+
+not a 24
+
+
+
+end 28
@@ -0,0 +1,26 @@
+
+
+
+
+
+
+
+
+
+
+guard.h included 5
+
+
+
+
+
+
+
+
+
+
+
+
+guard.h included 5
+
+
@@ -0,0 +1,145 @@
+# ---------------------------------------------------------------------
+# Batch to measure the performance of sqtpp
+# Each benchmark preprocesses one of the files found in the folder
+# IntegrationTest\Files\sqtpp\benchmark a couple of times and 
+# prints the average duration.
+#
+# Usage: benchmark_sqtpp.ps1 [-sqtpp path] [-count n] [-large] [-coldcache]
+# ---------------------------------------------------------------------
+param( [string] $sqtpp = "bin\release\sqtpp.exe", [int] $count = 10, [switch] $large, [switch] $coldcache )
+
+$files = "IntegrationTest\Files\sqtpp\benchmark"
+
+function Measure-Sqtpp( [string] $name, [string[]] $arguments )
+{
+    # Warm up (file system cache).
+    &$sqtpp -onul $arguments | Out-Null
+
+    $t0 = [System.DateTime]::Now;
+    for ( $i = 0; $i -lt $count; $i++ ) {
+        &$sqtpp -onul $arguments | Out-Null
+    }
+    $t1 = [System.DateTime]::Now;
+    $d = ($t1 - $t0).TotalMilliseconds / $count;
+
+    Write-Host ( "{0,-40} {1,10:F1} ms" -f $name, $d )
+}
+
+
+# Evaluation of #if / #elif expressions.
+Measure-Sqtpp "Conditional directives" @( "/e+", "$files\Conditional.csql" )
+
+# Re-evaluation of #if / #elif expressions in a header included again and again.
+Measure-Sqtpp "Reincluded header" @( "/e+", "$files\Reinclude.csql" )
+
+# #if expressions using integer constant macros.
+Measure-Sqtpp "Constant macros" @( "/e+", "$files\ConstantMacros.csql" )
+
+# Skipping of large conditional blocks in a header included again and again.
+Measure-Sqtpp "Skipped blocks" @( "/e+", "$files\SkippedBlocks.csql" )
+
+# #include of a header whose include guard is already defined.
+Measure-Sqtpp "Guarded includes" @( "/e+", "$files\Guarded.csql" )
+
+# Resolution of #include files found in the last of several include directories.
+Measure-Sqtpp "Include directories" @( "/e+", "/I$files\include1", "/I$files\include2", "/I$files\include3", "$files\Includes.csql" )
+
+# Decoding of UTF-8 input files with mostly ASCII, mixed German and CJK text.
+Measure-Sqtpp "UTF-8 ASCII text" @( "/e+", "$files\Utf8Ascii.csql" )
+Measure-Sqtpp "UTF-8 German text" @( "/e+", "$files\Utf8German.csql" )
+Measure-Sqtpp "UTF-8 CJK text" @( "/e+", "$files\Utf8Cjk.csql" )
+
+# Detection of the character set of UTF-8 input files without byte order mark.
+Measure-Sqtpp "UTF-8 text without BOM" @( "/e+", "$files\Utf8NoBom.csql" )
+
+# Reading of UTF-16 (little and big endian) input files.
+Measure-Sqtpp "UTF-16 text" @( "/e+", "$files\Utf16.csql" )
+Measure-Sqtpp "UTF-16BE text" @( "/e+", "$files\Utf16Be.csql" )
+
+# Conversion of single byte code pages.
+Measure-Sqtpp "Code page 437" @( "/e+", "/C437", "$files\Cp437.csql" )
+Measure-Sqtpp "Code page 850" @( "/e+", "/C850", "$files\Cp850.csql" )
+Measure-Sqtpp "Code page 1252" @( "/e+", "/C1252", "$files\Cp1252.csql" )
+
+# Writing a large output file (about 700 KB) in UTF-8, UTF-16 and code page 1252.
+# Run with -sqtpp of a build writing the output by a std::wofstream to compare.
+$outputFile = Join-Path $env:TEMP "sqtpp_output.sql"
+Measure-Sqtpp "Output UTF-8" @( "/e+", "/Co65001", "-o$outputFile", "$files\Utf8German.csql" )
+Measure-Sqtpp "Output UTF-16" @( "/e+", "/Co1200", "-o$outputFile", "$files\Utf8German.csql" )
+Measure-Sqtpp "Output code page 1252" @( "/e+", "/Co1252", "-o$outputFile", "$files\Utf8German.csql" )
+Remove-Item $outputFile
+
+# Writing the output into a named pipe (like csql reads the output of sqtpp).
+# This script is the reader: It creates the pipe, starts sqtpp and reads the
+# output through a 4 KB pipe buffer like csql does.
+$pipeName = "sqtpp_benchmark_$PID"
+$buffer   = New-Object byte[] 4096
+$bytes    = 0
+$t0 = [System.DateTime]::Now;
+for ( $i = 0; $i -lt $count; $i++ ) {
+    $pipe    = New-Object System.IO.Pipes.NamedPipeServerStream( $pipeName, "In", 1, "Byte", "None", 4096, 4096 )
+    $process = Start-Process -FilePath $sqtpp -ArgumentList @( "/e+", "/Co65001", "-o\\.\pipe\$pipeName", "$files\Utf8German.csql" ) -NoNewWindow -PassThru
+    $pipe.WaitForConnection()
+    while ( ($n = $pipe.Read( $buffer, 0, $buffer.Length )) -gt 0 ) {
+        $bytes+= $n
+    }
+    $pipe.Dispose()
+    $process.WaitForExit()
+}
+$t1 = [System.DateTime]::Now;
+Write-Host ( "{0,-40} {1,10:F1} MB/s" -f "Output to a named pipe", ($bytes / 1MB / ($t1 - $t0).TotalSeconds) )
+
+# Reading a 1 GB input file (LargeInput.sql repeated). Run with -large only.
+if ( $large ) {
+    $largeFile = Join-Path $env:TEMP "sqtpp_large.sql"
+    if ( !(Test-Path $largeFile) ) {
+        $text   = [System.IO.File]::ReadAllText( (Resolve-Path "$files\LargeInput.sql") )
+        $writer = New-Object System.IO.StreamWriter( $largeFile, $false, [System.Text.Encoding]::ASCII )
+        for ( $size = 0; $size -lt 1GB; $size+= $text.Length ) {
+            $writer.Write( $text )
+        }
+        $writer.Close()
+    }
+    Measure-Sqtpp "Large input (1 GB)" @( "/e+", $largeFile )
+}
+
+# Including 500 small headers with a cold file system cache. Run with -coldcache only.
+# The headers are generated once. Opening a file without buffering purges
+# it from the file system cache so each run reads the headers from disk.
+if ( $coldcache ) {
+    $includeDir = Join-Path $env:TEMP "sqtpp_includes"
+    $rootFile   = Join-Path $includeDir "Includes500.csql"
+    if ( !(Test-Path $rootFile) ) {
+        $root = New-Object System.Text.StringBuilder
+        for ( $i = 0; $i -lt 500; $i++ ) {
+            $name  = "dir{0}\include{1:D3}.h" -f ($i % 10), $i
+            $path  = Join-Path $includeDir $name
+            $guard = "INCLUDE{0:D3}_H" -f $i
+            $text  = New-Object System.Text.StringBuilder
+            [void]$text.AppendLine( "#ifndef $guard" ).AppendLine( "#define $guard" )
+            for ( $j = 0; $j -lt 20; $j++ ) {
+                [void]$text.AppendLine( "select $j, 'line $j of $name' from dual;" )
+            }
+            [void]$text.AppendLine( "#endif" )
+            New-Item -ItemType Directory -Force -Path (Split-Path $path) | Out-Null
+            [System.IO.File]::WriteAllText( $path, $text.ToString() )
+            [void]$root.AppendLine( "#include ""$name""" )
+        }
+        [System.IO.File]::WriteAllText( $rootFile, $root.ToString() )
+    }
+
+    $includeFiles = Get-ChildItem -Recurse -File $includeDir
+    $noBuffering  = [System.IO.FileOptions] 0x20000000
+    $d = 0
+    for ( $i = 0; $i -lt $count; $i++ ) {
+        foreach ( $file in $includeFiles ) {
+            $stream = New-Object System.IO.FileStream( $file.FullName, "Open", "Read", "ReadWrite", 4096, $noBuffering )
+            $stream.Close()
+        }
+        $t0 = [System.DateTime]::Now;
+        &$sqtpp -onul "/e+" $rootFile | Out-Null
+        $t1 = [System.DateTime]::Now;
+        $d+= ($t1 - $t0).TotalMilliseconds
+    }
+    Write-Host ( "{0,-40} {1,10:F1} ms" -f "500 includes (cold cache)", ($d / $count) )
+}
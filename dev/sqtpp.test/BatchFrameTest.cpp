@@ -0,0 +1,263 @@
+#include "stdafx.h"
+#include <ctime>
+#include <iterator>
+#include "Options.h"
+#include "CodePage.h"
+#include "Streams.h"
+#include "Processor.h"
+#include "TestBase.h"
+
+namespace sqtpp {
+namespace test {
+
+/**
+** @brief Reads the batch frames while they are written by the processor.
+**
+** The frames are parsed as soon as they are complete. So the reader
+** knows when (and after how many characters) the first batch could
+** have been executed by a consumer.
+*/
+class FrameReader : public std::wstreambuf
+{
+public:
+	/// A batch frame read.
+	struct Frame
+	{
+		size_t  nOrdinal;
+		size_t  nLine;
+		wstring sFile;
+		wstring text;
+	};
+
+	/// The frames read so far.
+	std::vector<Frame> frames;
+
+	/// The time the first frame was complete.
+	clock_t            firstFrameClock;
+
+	/// The number of characters received when the first frame was complete.
+	size_t             nFirstFrameChars;
+
+	/// The number of characters received.
+	size_t             nReceivedChars;
+
+	/// Flag indicating if a malformed header has been read.
+	bool               bMalformed;
+
+private:
+	/// The characters received but not yet parsed.
+	wstring            m_buffer;
+
+public:
+	FrameReader()
+	: firstFrameClock( 0 )
+	, nFirstFrameChars( 0 )
+	, nReceivedChars( 0 )
+	, bMalformed( false )
+	{
+	}
+
+	/// Check if all characters received belong to complete frames.
+	bool isComplete() const
+	{
+		return m_buffer.empty();
+	}
+
+protected:
+	int_type overflow( int_type character )
+	{
+		if ( character != traits_type::eof() ) {
+			const wchar_t wc = traits_type::to_char_type( character );
+			xsputn( &wc, 1 );
+		}
+		return traits_type::not_eof( character );
+	}
+
+	std::streamsize xsputn( const wchar_t* buffer, std::streamsize count )
+	{
+		m_buffer.append( buffer, size_t( count ) );
+		nReceivedChars+= size_t( count );
+		parse();
+		return count;
+	}
+
+private:
+	/// Move the complete frames from the buffer to the frames read.
+	void parse()
+	{
+		for ( ;; ) {
+			const size_t nHeaderEnd = m_buffer.find( L'\n' );
+			if ( nHeaderEnd == wstring::npos ) {
+				return;
+			}
+
+			wistringstream header( m_buffer.substr( 0, nHeaderEnd ) );
+			wstring tag;
+			size_t  nLength = 0;
+			Frame   frame;
+			header >> tag >> frame.nOrdinal >> nLength >> frame.nLine >> std::ws;
+			std::getline( header, frame.sFile );
+			if ( tag != L"#batch" || header.bad() ) {
+				bMalformed = true;
+				m_buffer.erase();
+				return;
+			}
+			if ( m_buffer.length() < nHeaderEnd + 1 + nLength ) {
+				return;
+			}
+
+			frame.text = m_buffer.substr( nHeaderEnd + 1, nLength );
+			m_buffer.erase( 0, nHeaderEnd + 1 + nLength );
+			if ( frames.empty() ) {
+				firstFrameClock  = clock();
+				nFirstFrameChars = nReceivedChars;
+			}
+			frames.push_back( frame );
+		}
+	}
+};
+
+
+[TestClass]
+public ref class BatchFrameTest : public TestBase
+{
+private:
+	static void setFramingOptions( Options& options )
+	{
+		options.frameBatches( true );
+		options.emitLine( false );
+		options.setNewLineOutput( Options::NLO_LF );
+	}
+
+public:
+	/**
+	** @brief Test the frames written for the batches of the input.
+	*/
+	[TestMethod]
+	void framingTest()
+	{
+		Options       options;
+		Processor     processor( options );
+		FrameReader   reader;
+		wostream      output( &reader );
+		wstringstream input( L"select 1\n"
+		                     L"  go \n"
+		                     L"select 2\n"
+		                     L"\n"
+		                     L"GO\n"
+		                     L"\n"
+		                     L"GO\n"
+		                     L"\n"
+		                     L"select 3" );
+
+		setFramingOptions( options );
+		processor.setOutStream( output );
+		processor.processStream( input );
+
+		Assert::IsFalse( reader.bMalformed );
+		Assert::IsTrue( reader.isComplete() );
+		// The empty batch between the last two separators is skipped.
+		Assert::IsTrue( reader.frames.size() == 3 );
+		Assert::IsTrue( reader.frames[0].nOrdinal == 1 );
+		Assert::IsTrue( reader.frames[0].nLine == 1 );
+		Assert::IsTrue( reader.frames[0].text == L"select 1\n" );
+		Assert::IsTrue( reader.frames[1].nOrdinal == 2 );
+		Assert::IsTrue( reader.frames[1].nLine == 3 );
+		Assert::IsTrue( reader.frames[1].text == L"select 2\n\n" );
+		Assert::IsTrue( reader.frames[2].nOrdinal == 3 );
+		Assert::IsTrue( reader.frames[2].nLine == 9 );
+		Assert::IsTrue( reader.frames[2].text == L"\nselect 3" );
+	}
+
+	/**
+	** @brief Test that the first batch is available before the input is processed.
+	*/
+	[TestMethod]
+	void timeToFirstBatchTest()
+	{
+		const size_t  nBatchCount = 20000;
+		Options       options;
+		Processor     processor( options );
+		FrameReader   reader;
+		wostream      output( &reader );
+		wstringstream input;
+
+		for ( size_t nBatch = 0; nBatch < nBatchCount; ++nBatch ) {
+			input << L"select * from sysobjects where id = " << nBatch << L"\nGO\n";
+		}
+
+		setFramingOptions( options );
+		processor.setOutStream( output );
+		const clock_t startClock = clock();
+		processor.processStream( input );
+		const clock_t endClock = clock();
+
+		Assert::IsFalse( reader.bMalformed );
+		Assert::IsTrue( reader.isComplete() );
+		Assert::IsTrue( reader.frames.size() == nBatchCount );
+		// The first frame has been written long before the last one.
+		Assert::IsTrue( reader.nFirstFrameChars * 100 < reader.nReceivedChars );
+
+		const double firstBatchMs = double( reader.firstFrameClock - startClock ) * 1000 / CLOCKS_PER_SEC;
+		const double totalMs      = double( endClock - startClock ) * 1000 / CLOCKS_PER_SEC;
+		Console::WriteLine( "time to first batch: {0} ms, total: {1} ms ({2} batches)", firstBatchMs, totalMs, nBatchCount );
+	}
+
+	/**
+	** @brief Test that the frame length is the number of bytes written and
+	** that messages are not written into a framed output.
+	*/
+	[TestMethod]
+	void frameLengthTest()
+	{
+		const CodePageInfo& codePage = CodePageInfo::getCodePageInfo( CPID_UTF8 );
+		Options             options;
+		FileOutputStream    input;
+
+		// The endif directive causes a warning. The literal contains an a umlaut 
+		// and an euro sign (2 and 3 bytes in UTF-8).
+		Assert::IsTrue( input.open( L"frame_input.sql", codePage ) );
+		input << L"#if 1\n"
+		         L"#endif junk\n"
+		         L"select '\x00E4\x20AC'\n"
+		         L"GO\n"
+		         L"select 2";
+		input.close();
+
+		setFramingOptions( options );
+		options.eliminateEmptyLines( true );
+		options.writeErrorsToOutput( true );
+		options.setOutputCodePage( CPID_UTF8 );
+		options.setOutputFile( L"frame_output.sql" );
+		{
+			Processor processor( options );
+			processor.processFile( L"frame_input.sql" );
+			processor.close();
+		}
+
+		std::ifstream  stream( "frame_output.sql", ios::in | ios::binary );
+		const string   bytes( (std::istreambuf_iterator<char>( stream )), std::istreambuf_iterator<char>() );
+		vector<string> texts;
+		size_t         nPos = 3;
+
+		Assert::IsTrue( bytes.substr( 0, nPos ) == "\xEF\xBB\xBF" );
+		while ( nPos < bytes.length() ) {
+			const size_t nHeaderEnd = bytes.find( '\n', nPos );
+			unsigned int nOrdinal   = 0;
+			unsigned int nLength    = 0;
+			Assert::IsTrue( nHeaderEnd != string::npos );
+			Assert::IsTrue( sscanf( bytes.c_str() + nPos, "#batch %u %u", &nOrdinal, &nLength ) == 2 );
+			Assert::IsTrue( nOrdinal == texts.size() + 1 );
+			texts.push_back( bytes.substr( nHeaderEnd + 1, nLength ) );
+			nPos = nHeaderEnd + 1 + nLength;
+		}
+		Assert::IsTrue( nPos == bytes.length() );
+		Assert::IsTrue( texts.size() == 2 );
+		Assert::IsTrue( texts[0] == "select '\xC3\xA4\xE2\x82\xAC'\n" );
+		Assert::IsTrue( texts[1] == "select 2" );
+	}
+}; // class
+
+
+} // namespace test
+} // namespace sqtpp
@@ -0,0 +1,107 @@
+#include "stdafx.h"
+#include "BatchManifest.h"
+#include "TestBase.h"
+
+namespace sqtpp {
+namespace test {
+
+[TestClass]
+public ref class BatchManifestTest : public TestBase
+{
+private:
+	static void addLine( BatchManifest& manifest, const wchar_t* pwcLine, size_t nLine )
+	{
+		manifest.addLine( pwcLine, wcslen( pwcLine ), L"a.sql", nLine );
+	}
+
+public:
+	/**
+	** @brief Test that empty lines around a batch don't change its hash value.
+	*/
+	[TestMethod]
+	void hashTest()
+	{
+		BatchManifest manifest;
+
+		addLine( manifest, L"select 1", 1 );
+		addLine( manifest, L"", 2 );
+		addLine( manifest, L"select 2", 3 );
+		manifest.endBatch();
+
+		addLine( manifest, L"", 5 );
+		addLine( manifest, L"  ", 6 );
+		addLine( manifest, L"select 1", 7 );
+		addLine( manifest, L"", 8 );
+		addLine( manifest, L"select 2", 9 );
+		addLine( manifest, L"", 10 );
+		manifest.endBatch();
+
+		addLine( manifest, L"select 1", 12 );
+		addLine( manifest, L"select 2", 13 );
+		manifest.endBatch();
+
+		// Batches without text are not recorded.
+		addLine( manifest, L"", 15 );
+		manifest.endBatch();
+
+		Assert::IsTrue( manifest.getBatchCount() == 3 );
+		Assert::IsTrue( manifest.getHash( 0 ) == manifest.getHash( 1 ) );
+		Assert::IsTrue( manifest.getHash( 0 ) != manifest.getHash( 2 ) );
+	}
+
+	/**
+	** @brief Test the names of the objects created or altered.
+	*/
+	[TestMethod]
+	void objectNameTest()
+	{
+		BatchManifest manifest;
+
+		addLine( manifest, L"create procedure dbo.foo( @a int )", 1 );
+		manifest.endBatch();
+		addLine( manifest, L"-- The view.", 3 );
+		addLine( manifest, L"ALTER VIEW [dbo].[v x] AS", 4 );
+		manifest.endBatch();
+		addLine( manifest, L"CREATE OR ALTER FUNCTION \"f\"()", 6 );
+		manifest.endBatch();
+		addLine( manifest, L"create", 8 );
+		addLine( manifest, L"  /* numbered */ PROC p;2", 9 );
+		manifest.endBatch();
+		addLine( manifest, L"create table t( a int )", 11 );
+		manifest.endBatch();
+
+		Assert::IsTrue( manifest.getBatchCount() == 5 );
+		Assert::IsTrue( manifest.getObjectName( 0 ) == L"dbo.foo" );
+		Assert::IsTrue( manifest.getObjectName( 1 ) == L"[dbo].[v x]" );
+		Assert::IsTrue( manifest.getObjectName( 2 ) == L"\"f\"" );
+		Assert::IsTrue( manifest.getObjectName( 3 ) == L"p" );
+		Assert::IsTrue( manifest.getObjectName( 4 ).empty() );
+	}
+
+	/**
+	** @brief Test the format of the manifest written.
+	*/
+	[TestMethod]
+	void writeTest()
+	{
+		BatchManifest manifest;
+		wstringstream output;
+
+		addLine( manifest, L"", 1 );
+		addLine( manifest, L"create proc p as", 2 );
+		addLine( manifest, L"select 1", 3 );
+		manifest.endBatch();
+		addLine( manifest, L"a", 5 );
+		manifest.endBatch();
+		manifest.write( output );
+
+		// The hash values are the FNV-1a hashes of the UTF-16LE text.
+		Assert::IsTrue( output.str() == L"sqtpp batch manifest 1\n"
+		                                L"1\t9fdbb49214e684c4\tPROCEDURE\tp\t2\ta.sql\n"
+		                                L"2\taca247820e6cc91e\t\t\t5\ta.sql\n" );
+	}
+}; // class
+
+
+} // namespace test
+} // namespace sqtpp
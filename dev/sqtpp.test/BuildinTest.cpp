@@ -288,6 +288,56 @@ public:
 		outputText = output.str();
 		Assert::IsTrue( outputText == L"'16:45:10'" );
 	}
+
+	/**
+	** @brief Test the __TIMESTAMP__ macro
+	**
+	** The timestamp is taken and formatted only once per run.
+	*/
+	[TestMethod]
+	void timestampTest()
+	{
+		Options       options;
+		Processor     processor( options );
+		wstring       inputText;
+		wstringstream input;
+		wstringstream output;
+		wstring       outputText;
+
+		tm           testTime;
+
+		memset( &testTime, 0, sizeof( testTime ) );
+		testTime.tm_year = 101; // 2001
+		testTime.tm_mon  = 8;   // Sep
+		testTime.tm_mday = 30;
+		testTime.tm_hour = 16;
+		testTime.tm_min = 45;
+		testTime.tm_sec = 10;
+		processor.setTimestamp( &testTime );
+
+		options.setLanguage( Options::LNG_SQL );
+		options.emitLine( false );
+		options.eliminateEmptyLines( true );
+
+		processor.setOutStream( output );
+
+		inputText = L"__TIMESTAMP__ __TIMESTAMP__";
+		input.clear();
+		input.str( inputText );
+		output.str( wstring() );
+		processor.processStream( input );
+		outputText = output.str();
+		Assert::IsTrue( outputText == L"'20010930 16:45:10' '20010930 16:45:10'" );
+
+		testTime.tm_sec = 11;
+		inputText = L"__TIMESTAMP__";
+		input.clear();
+		input.str( inputText );
+		output.str( wstring() );
+		processor.processStream( input );
+		outputText = output.str();
+		Assert::IsTrue( outputText == L"'20010930 16:45:10'" );
+	}
 }; // class
 
 
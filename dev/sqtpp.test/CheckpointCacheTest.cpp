@@ -0,0 +1,135 @@
+#include "stdafx.h"
+#include "Util.h"
+#include "CheckpointCache.h"
+#include "TestBase.h"
+
+namespace sqtpp {
+namespace test {
+
+[TestClass]
+public ref class CheckpointCacheTest : public TestBase
+{
+public:
+	/**
+	** @brief Test that all kinds of line breaks are counted and hashed.
+	*/
+	[TestMethod]
+	void setRootTextTest()
+	{
+		CheckpointCache cache( L"a.sql", 1 );
+		cache.setRootText( L"a\r\nb\rc\nd" );
+		Assert::IsTrue( cache.getLineOffset( 3 ) == 7 );
+
+		CheckpointCache::Checkpoint& checkpoint = cache.addCheckpoint( 3 );
+		cache.addCheckpoint( 4 );
+		cache.updateHashes();
+		Assert::IsTrue( cache.getCheckpointCount() == 1 );
+		Assert::IsTrue( checkpoint.nPrefixHash == Util::hashText( Util::HASH_OFFSET_BASIS, L"a\r\nb\rc\n", 7 ) );
+	}
+
+	/**
+	** @brief Test that the cache is read as written and only for the same options.
+	*/
+	[TestMethod]
+	void writeReadTest()
+	{
+		CheckpointCache cache( L"a.sql", 42 );
+		cache.setRootText( L"#define A 1\n#define B(x) x\\\n + 1\nselect A\n" );
+
+		CheckpointCache::Checkpoint& checkpoint = cache.addCheckpoint( 3 );
+		checkpoint.nPosition         = 37;
+		checkpoint.nLine             = 4;
+		checkpoint.nCounter          = 2;
+		checkpoint.sNewLine          = L"\n";
+		checkpoint.nOutputLineCount  = 3;
+		checkpoint.nOutputLineNumber = 3;
+
+		TokenExpressions tokens;
+		tokens.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"1" ) );
+		Macro macroA( L"A", L"a.sql", 1 );
+		macroA.setExpression( tokens, L"1" );
+		checkpoint.macros.push_back( macroA );
+
+		tokens.clear();
+		tokens.push_back( TokenExpression( TOK_IDENTIFIER, CTX_DEFAULT, L"x" ) );
+		tokens.push_back( TokenExpression( TOK_NEW_LINE, CTX_DEFAULT, L"\n" ) );
+		tokens.push_back( TokenExpression( TOK_OP_PLUS, CTX_DEFAULT, L"+" ) );
+		tokens.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"1" ) );
+		MacroArguments arguments;
+		arguments.push_back( MacroArgument( L"x" ) );
+		Macro macroB( L"B", L"a.sql", 2 );
+		macroB.setArguments( arguments );
+		macroB.setExpression( tokens, L"(x) x\n + 1" );
+		checkpoint.macros.push_back( macroB );
+		checkpoint.undefinedMacros.push_back( L"C" );
+		checkpoint.conditionals.push_back( Location( L"a.sql", 1 ) );
+		cache.updateHashes();
+
+		wstringstream output;
+		cache.write( output );
+		Assert::IsTrue( output.str().find( L"M\tB\ta.sql\t2\t(x) x\\n + 1\t1\tx\n" ) != wstring::npos );
+		Assert::IsTrue( output.str().find( L"U\tC\n" ) != wstring::npos );
+
+		CheckpointCache sameCache( L"a.sql", 42 );
+		wstringstream   sameInput( output.str() );
+		Assert::IsTrue( sameCache.read( sameInput ) );
+		Assert::IsTrue( sameCache.getCheckpointCount() == 1 );
+
+		wstringstream sameOutput;
+		sameCache.write( sameOutput );
+		Assert::IsTrue( sameOutput.str() == output.str() );
+
+		MacroSet macros;
+		size_t   nMacroVersion = 0;
+		macros[L"C"] = Macro( L"C", L"a.sql", 1 );
+		sameCache.setRootText( L"#define A 1\n#define B(x) x\\\n + 1\nselect A\n" );
+		sameCache.restoreMacros( *sameCache.find( 100 ), macros, nMacroVersion );
+		Assert::IsTrue( macros.size() == 2 && macros.find( L"C" ) == macros.end() );
+		const Macro& restoredB = macros[L"B"];
+		Assert::IsTrue( restoredB.hasArguments() && restoredB.getArguments().size() == 1 );
+		Assert::IsTrue( restoredB.getTokens().size() == 4 && restoredB.isMultiLine() );
+		Assert::IsTrue( restoredB.getDefineLine() == 2 && restoredB.getVersion() == 2 );
+
+		CheckpointCache otherCache( L"a.sql", 43 );
+		wstringstream   otherInput( output.str() );
+		Assert::IsFalse( otherCache.read( otherInput ) );
+		Assert::IsTrue( otherCache.getCheckpointCount() == 0 );
+	}
+
+	/**
+	** @brief Test that an edit invalidates the checkpoints following it only.
+	*/
+	[TestMethod]
+	void findTest()
+	{
+		CheckpointCache cache( L"a.sql", 1 );
+		cache.addCheckpoint( 1 ).nPosition = 2;
+		cache.addCheckpoint( 3 ).nPosition = 6;
+
+		cache.setRootText( L"a\nb\nc\nd\n" );
+		cache.updateHashes();
+		Assert::IsTrue( cache.getCheckpointCount() == 2 );
+
+		const CheckpointCache::Checkpoint* pCheckpoint;
+		pCheckpoint = cache.find( 100 );
+		Assert::IsTrue( pCheckpoint != NULL && pCheckpoint->nLineCount == 3 );
+
+		pCheckpoint = cache.find( 5 );
+		Assert::IsTrue( pCheckpoint != NULL && pCheckpoint->nLineCount == 1 );
+
+		cache.setRootText( L"a\nx\nc\nd\n" );
+		pCheckpoint = cache.find( 100 );
+		Assert::IsTrue( pCheckpoint != NULL && pCheckpoint->nLineCount == 1 );
+
+		cache.setRootText( L"x\nb\nc\nd\n" );
+		Assert::IsTrue( cache.find( 100 ) == NULL );
+
+		cache.setRootText( L"a\nx\nc\nd\n" );
+		cache.updateHashes();
+		Assert::IsTrue( cache.getCheckpointCount() == 1 );
+	}
+}; // class
+
+
+} // namespace test
+} // namespace sqtpp
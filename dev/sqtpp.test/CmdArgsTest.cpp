@@ -76,6 +76,29 @@ public:
 		Assert::IsTrue( outputRange.getEndIndex() == 20 );
 	}
 
+	/**
+	** @brief Test the default path of the -h argument (independent of the order of -o and -h).
+	*/
+	[TestMethod]
+	void manifestOptionTest()
+	{
+		const int argc = 3;
+		const wchar_t* argv[] = { L"sqtpp.exe", L"-h", L"-ooutput.sql" };
+		Options options;
+		CmdArgs cmdArgs( argc, argv );
+
+		cmdArgs.ignoreMissingArgs( true );
+		cmdArgs.parse( options );
+		Assert::IsFalse( options.getOutputFile().empty() );
+		Assert::IsTrue( options.getManifestFile() == options.getOutputFile() + L".manifest" );
+
+		argv[1] = L"-ooutput.sql";
+		argv[2] = L"-h";
+		options.setManifestFile( wstring() );
+		cmdArgs.parse( options );
+		Assert::IsTrue( options.getManifestFile() == options.getOutputFile() + L".manifest" );
+	}
+
 }; // class
 
 } // namespace test
@@ -0,0 +1,119 @@
+#include "stdafx.h"
+#include "CodePage.h"
+#include "CodePageDetection.h"
+#include "TestBase.h"
+
+namespace sqtpp {
+namespace test {
+
+[TestClass]
+public ref class CodePageDetectionTest : public TestBase
+{
+public:
+	/**
+	** @brief Test for detectCodePage with files having a byte order mark or not.
+	*/
+	[TestMethod]
+	void detectFileCodePageTest()
+	{
+		wstring directory = TestFileDirectory;
+		const CodePageInfo* pCodePage;
+
+		pCodePage = CodePageDetection::detectCodePage( directory + L"CP1252.txt", CPID_WINDOWS_1252 );
+		Assert::IsTrue( pCodePage->getCodePageId() == CPID_WINDOWS_1252 );
+
+		pCodePage = CodePageDetection::detectCodePage( directory + L"UTF16.txt", CPID_WINDOWS_1252 );
+		Assert::IsTrue( pCodePage->getCodePageId() == CPID_UTF16 );
+
+		// ASCII only.
+		pCodePage = CodePageDetection::detectCodePage( directory + L"mixedcp.h", CPID_OEM_850 );
+		Assert::IsTrue( pCodePage->getCodePageId() == CPID_OEM_850 );
+
+		pCodePage = CodePageDetection::detectCodePage( directory + L"utf8nobom.txt", CPID_WINDOWS_1252 );
+		Assert::IsTrue( pCodePage->getCodePageId() == CPID_UTF8 );
+	}
+
+	/**
+	** @brief Test for detectCodePage with content of files without byte order mark.
+	*/
+	[TestMethod]
+	void detectUtf8Test()
+	{
+		const CodePageInfo* pCodePage;
+		// "ABCDEFGHIJKLMNOPQRSTUVWXYZ" followed by an a umlaut and an euro sign.
+		const char utf8[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ\xC3\xA4\xE2\x82\xAC";
+		// "ABCDEFGHIJKLMNOPQRSTUVWXYZ" followed by an a umlaut in code page 1252.
+		const char ansi[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ\xE4";
+		// An overlong encoding of a slash.
+		const char overlong[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ\xC0\xAF";
+		// An encoded surrogate.
+		const char surrogate[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ\xED\xA0\x80";
+
+		pCodePage = CodePageDetection::detectCodePage( utf8, strlen( utf8 ), CPID_WINDOWS_1252 );
+		Assert::IsTrue( pCodePage->getCodePageId() == CPID_UTF8 );
+
+		pCodePage = CodePageDetection::detectCodePage( utf8, 26, CPID_WINDOWS_1252 );
+		Assert::IsTrue( pCodePage->getCodePageId() == CPID_WINDOWS_1252 );
+
+		// Incomplete sequence at the end of the file.
+		pCodePage = CodePageDetection::detectCodePage( utf8, strlen( utf8 ) - 1, CPID_WINDOWS_1252 );
+		Assert::IsTrue( pCodePage->getCodePageId() == CPID_WINDOWS_1252 );
+
+		pCodePage = CodePageDetection::detectCodePage( ansi, strlen( ansi ), CPID_WINDOWS_1252 );
+		Assert::IsTrue( pCodePage->getCodePageId() == CPID_WINDOWS_1252 );
+
+		pCodePage = CodePageDetection::detectCodePage( overlong, strlen( overlong ), CPID_WINDOWS_1252 );
+		Assert::IsTrue( pCodePage->getCodePageId() == CPID_WINDOWS_1252 );
+
+		pCodePage = CodePageDetection::detectCodePage( surrogate, strlen( surrogate ), CPID_WINDOWS_1252 );
+		Assert::IsTrue( pCodePage->getCodePageId() == CPID_WINDOWS_1252 );
+	}
+
+	/**
+	** @brief Test for detectCodePage with a sequence at the end of the probe.
+	*/
+	[TestMethod]
+	void detectUtf8ProbeTest()
+	{
+		const CodePageInfo* pCodePage;
+		// "ABC" followed by an a umlaut.
+		const char valid[] = "ABC\xC3\xA4";
+		// "ABC" followed by the start byte of an a umlaut and an "A".
+		const char invalid[] = "ABC\xC3" "A";
+
+		// The sequence starts within the probe and ends behind it.
+		pCodePage = CodePageDetection::detectCodePage( valid, strlen( valid ), CPID_WINDOWS_1252, 4 );
+		Assert::IsTrue( pCodePage->getCodePageId() == CPID_UTF8 );
+
+		pCodePage = CodePageDetection::detectCodePage( invalid, strlen( invalid ), CPID_WINDOWS_1252, 4 );
+		Assert::IsTrue( pCodePage->getCodePageId() == CPID_WINDOWS_1252 );
+
+		// ASCII only within the probe.
+		pCodePage = CodePageDetection::detectCodePage( valid, strlen( valid ), CPID_WINDOWS_1252, 3 );
+		Assert::IsTrue( pCodePage->getCodePageId() == CPID_WINDOWS_1252 );
+	}
+
+	/**
+	** @brief Test for detectCodePage with content shorter than a byte order mark.
+	*/
+	[TestMethod]
+	void detectBomTest()
+	{
+		const CodePageInfo* pCodePage;
+		const char bom[] = "\xEF\xBB\xBF";
+
+		pCodePage = CodePageDetection::detectCodePage( bom, strlen( bom ), CPID_WINDOWS_1252 );
+		Assert::IsTrue( pCodePage->getCodePageId() == CPID_UTF8 );
+
+		// An empty file.
+		pCodePage = CodePageDetection::detectCodePage( bom, 0, CPID_WINDOWS_1252 );
+		Assert::IsTrue( pCodePage->getCodePageId() == CPID_WINDOWS_1252 );
+
+		// The first bytes of a byte order mark only.
+		pCodePage = CodePageDetection::detectCodePage( bom, 2, CPID_WINDOWS_1252 );
+		Assert::IsTrue( pCodePage->getCodePageId() == CPID_WINDOWS_1252 );
+	}
+}; // class
+
+} // namespace test
+} // namespace sqtpp
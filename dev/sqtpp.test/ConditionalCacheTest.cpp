@@ -0,0 +1,149 @@
+#include "stdafx.h"
+#include "Context.h"
+#include "Macro.h"
+#include "ConditionalCache.h"
+#include "TestBase.h"
+
+namespace sqtpp {
+namespace test {
+
+[TestClass]
+public ref class ConditionalCacheTest : public TestBase
+{
+private:
+	/**
+	** @brief Define a macro with the given version and expression.
+	*/
+	static void define( MacroSet& macros, const wchar_t* pwszIdentifier, size_t nVersion, const TokenExpressions& tokens )
+	{
+		Macro macro( pwszIdentifier, L"a.h", 1 );
+		macro.setExpression( tokens, L"" );
+		macro.setVersion( nVersion );
+		macros[macro.getIdentifier()] = macro;
+	}
+
+public:
+	/**
+	** @brief Test that a cached result is valid until a referenced macro changes.
+	**
+	** @code
+	** #define LEVEL VALUE
+	** #if LEVEL > 1
+	** @endcode
+	*/
+	[TestMethod]
+	void lookupTest()
+	{
+		ConditionalCache cache;
+		MacroSet         macros;
+		TokenExpressions tokens;
+		StringSet        identifiers;
+		bool             bValue = true;
+
+		tokens.push_back( TokenExpression( TOK_IDENTIFIER, CTX_DEFAULT, L"VALUE" ) );
+		define( macros, L"LEVEL", 1, tokens );
+		identifiers.insert( L"LEVEL" );
+
+		Assert::IsFalse( cache.lookup( L"a.h", 2, macros, bValue ) );
+		cache.insert( L"a.h", 2, identifiers, macros, false );
+		Assert::IsTrue( cache.lookup( L"a.h", 2, macros, bValue ) );
+		Assert::IsFalse( bValue );
+		Assert::IsFalse( cache.lookup( L"a.h", 3, macros, bValue ) );
+		Assert::IsFalse( cache.lookup( L"b.h", 2, macros, bValue ) );
+
+		// Defining the macro referenced by LEVEL invalidates the entry.
+		define( macros, L"VALUE", 2, TokenExpressions() );
+		Assert::IsFalse( cache.lookup( L"a.h", 2, macros, bValue ) );
+
+		// Redefining LEVEL itself too.
+		macros.erase( L"VALUE" );
+		Assert::IsTrue( cache.lookup( L"a.h", 2, macros, bValue ) );
+		define( macros, L"LEVEL", 3, tokens );
+		Assert::IsFalse( cache.lookup( L"a.h", 2, macros, bValue ) );
+	}
+
+	/**
+	** @brief Test that results depending on token pasting are not cached.
+	*/
+	[TestMethod]
+	void insertPastingTest()
+	{
+		ConditionalCache cache;
+		MacroSet         macros;
+		TokenExpressions tokens;
+		StringSet        identifiers;
+		bool             bValue = false;
+
+		tokens.push_back( TokenExpression( TOK_IDENTIFIER, CTX_DEFAULT, L"A" ) );
+		tokens.push_back( TokenExpression( TOK_SHARP_SHARP, CTX_DEFAULT, L"##" ) );
+		tokens.push_back( TokenExpression( TOK_IDENTIFIER, CTX_DEFAULT, L"B" ) );
+		define( macros, L"PASTE", 1, tokens );
+		identifiers.insert( L"PASTE" );
+
+		cache.insert( L"a.h", 2, identifiers, macros, true );
+		Assert::IsFalse( cache.lookup( L"a.h", 2, macros, bValue ) );
+	}
+
+	/**
+	** @brief Test skipping a cached false block and entering it after a redefinition.
+	**
+	** @code
+	** #if defined( LEVEL )   // line 2
+	** a                      // lines 3 - 5 are skipped
+	** b
+	** c
+	** #endif                 // line 6
+	** @endcode
+	*/
+	[TestMethod]
+	void skipTest()
+	{
+		ConditionalCache cache;
+		MacroSet         macros;
+		StringSet        identifiers;
+		bool             bValue     = true;
+		size_t           nLineCount = 0;
+
+		identifiers.insert( L"LEVEL" );
+
+		// First inclusion: evaluate, skip and record the block.
+		Assert::IsFalse( cache.lookup( L"a.h", 2, macros, bValue ) );
+		cache.insert( L"a.h", 2, identifiers, macros, false );
+		Assert::IsFalse( cache.lookupSkip( L"a.h", 2, CTX_CONDITIONAL_FALSE, nLineCount ) );
+		cache.beginSkip( L"a.h", 2, CTX_CONDITIONAL_FALSE );
+		cache.countSkippedLine();
+		cache.countSkippedLine();
+		cache.countSkippedLine();
+		cache.countSkippedLine();
+		cache.endSkip();
+
+		// Second inclusion: the cached result skips the recorded lines.
+		Assert::IsTrue( cache.lookup( L"a.h", 2, macros, bValue ) );
+		Assert::IsFalse( bValue );
+		Assert::IsTrue( cache.lookupSkip( L"a.h", 2, CTX_CONDITIONAL_FALSE, nLineCount ) );
+		Assert::IsTrue( nLineCount == 4 );
+		Assert::IsFalse( cache.lookupSkip( L"a.h", 2, CTX_CONDITIONAL_DONE, nLineCount ) );
+
+		// Third inclusion after #define LEVEL: the block is evaluated and entered again.
+		define( macros, L"LEVEL", 1, TokenExpressions() );
+		Assert::IsFalse( cache.lookup( L"a.h", 2, macros, bValue ) );
+		cache.insert( L"a.h", 2, identifiers, macros, true );
+		Assert::IsTrue( cache.lookup( L"a.h", 2, macros, bValue ) );
+		Assert::IsTrue( bValue );
+
+		// An interrupted skip is not recorded.
+		cache.beginSkip( L"a.h", 10, CTX_CONDITIONAL_FALSE );
+		cache.countSkippedLine();
+		cache.cancelSkip();
+		cache.endSkip();
+		Assert::IsFalse( cache.lookupSkip( L"a.h", 10, CTX_CONDITIONAL_FALSE, nLineCount ) );
+
+		cache.clear();
+		Assert::IsFalse( cache.lookup( L"a.h", 2, macros, bValue ) );
+		Assert::IsFalse( cache.lookupSkip( L"a.h", 2, CTX_CONDITIONAL_FALSE, nLineCount ) );
+	}
+}; // class
+
+
+} // namespace test
+} // namespace sqtpp
@@ -1024,6 +1024,185 @@ public:
 		Assert::IsTrue( value.getInteger() == 1 );
 	}
 
+
+	/**
+	** @brief Test the short circuit evaluation of && and ||.
+	**
+	** The right operand must not be evaluated (division by zero) if the 
+	** result is determined by the left operand.
+	*/
+	[TestMethod]
+	void shortCircuitTest()
+	{
+		TokenExpressions  expressions;
+		Expression        evaluator;
+		Expression::Value value;
+
+		// 0 && 1 / 0 (0)
+		expressions.clear();
+		expressions.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"0" ) );
+		expressions.push_back( TokenExpression( TOK_OP_LOGICAL_AND, CTX_DEFAULT, L"&&" ) );
+		expressions.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"1" ) );
+		expressions.push_back( TokenExpression( TOK_OP_DIVIDE, CTX_DEFAULT, L"/" ) );
+		expressions.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"0" ) );
+		evaluator.build( expressions );
+		value = evaluator.evaluate();
+		Assert::IsTrue( value.getInteger() == 0 );
+
+		// 2 || 1 / 0 (1)
+		expressions.clear();
+		expressions.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"2" ) );
+		expressions.push_back( TokenExpression( TOK_OP_LOGICAL_OR, CTX_DEFAULT, L"||" ) );
+		expressions.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"1" ) );
+		expressions.push_back( TokenExpression( TOK_OP_DIVIDE, CTX_DEFAULT, L"/" ) );
+		expressions.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"0" ) );
+		evaluator.build( expressions );
+		value = evaluator.evaluate();
+		Assert::IsTrue( value.getInteger() == 1 );
+
+		// 1 && 0 || 3 (1)
+		expressions.clear();
+		expressions.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"1" ) );
+		expressions.push_back( TokenExpression( TOK_OP_LOGICAL_AND, CTX_DEFAULT, L"&&" ) );
+		expressions.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"0" ) );
+		expressions.push_back( TokenExpression( TOK_OP_LOGICAL_OR, CTX_DEFAULT, L"||" ) );
+		expressions.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"3" ) );
+		evaluator.build( expressions );
+		value = evaluator.evaluate();
+		Assert::IsTrue( value.getInteger() == 1 );
+
+		// (0 || 0) && 1 / 0 (0)
+		expressions.clear();
+		expressions.push_back( TokenExpression( TOK_LEFT_PARENTHESIS, CTX_DEFAULT, L"(" ) );
+		expressions.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"0" ) );
+		expressions.push_back( TokenExpression( TOK_OP_LOGICAL_OR, CTX_DEFAULT, L"||" ) );
+		expressions.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"0" ) );
+		expressions.push_back( TokenExpression( TOK_RIGHT_PARENTHESIS, CTX_DEFAULT, L")" ) );
+		expressions.push_back( TokenExpression( TOK_OP_LOGICAL_AND, CTX_DEFAULT, L"&&" ) );
+		expressions.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"1" ) );
+		expressions.push_back( TokenExpression( TOK_OP_DIVIDE, CTX_DEFAULT, L"/" ) );
+		expressions.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"0" ) );
+		evaluator.build( expressions );
+		value = evaluator.evaluate();
+		Assert::IsTrue( value.getInteger() == 0 );
+	}
+
+	/**
+	** @brief Check the values of integer constant macros.
+	**
+	** The value of a closed integer constant macro is computed when the 
+	** macro is defined and used when evaluating expressions.
+	*/
+	[TestMethod]
+	void constantMacroTest()
+	{
+		TokenExpressions  expressions;
+		TokenExpressions  tokens;
+		Expression        evaluator;
+		Expression::Value value;
+		MacroSet          macros;
+
+		// #define LEVEL (2 * 3)
+		Macro level( L"LEVEL", L"", 1 );
+		tokens.clear();
+		tokens.push_back( TokenExpression( TOK_LEFT_PARENTHESIS, CTX_DEFAULT, L"(" ) );
+		tokens.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"2" ) );
+		tokens.push_back( TokenExpression( TOK_OP_MULTIPLY, CTX_DEFAULT, L"*" ) );
+		tokens.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"3" ) );
+		tokens.push_back( TokenExpression( TOK_RIGHT_PARENTHESIS, CTX_DEFAULT, L")" ) );
+		level.setExpression( tokens, L"(2 * 3)" );
+		Assert::IsTrue( level.hasConstantValue() );
+		Assert::IsTrue( level.getConstantValue() == 6 );
+		macros[level.getIdentifier()] = level;
+
+		// #define SUM 1 + 1 (the value depends on the context of the expansion)
+		Macro sum( L"SUM", L"", 2 );
+		tokens.clear();
+		tokens.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"1" ) );
+		tokens.push_back( TokenExpression( TOK_OP_PLUS, CTX_DEFAULT, L"+" ) );
+		tokens.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"1" ) );
+		sum.setExpression( tokens, L"1 + 1" );
+		Assert::IsTrue( !sum.hasConstantValue() );
+
+		// #define NAME LEVEL (not closed)
+		Macro name( L"NAME", L"", 3 );
+		tokens.clear();
+		tokens.push_back( TokenExpression( TOK_IDENTIFIER, CTX_DEFAULT, L"LEVEL" ) );
+		name.setExpression( tokens, L"LEVEL" );
+		Assert::IsTrue( !name.hasConstantValue() );
+
+		// LEVEL + 1 (7)
+		expressions.clear();
+		expressions.push_back( TokenExpression( TOK_IDENTIFIER, CTX_DEFAULT, L"LEVEL" ) );
+		expressions.push_back( TokenExpression( TOK_OP_PLUS, CTX_DEFAULT, L"+" ) );
+		expressions.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"1" ) );
+		evaluator.build( expressions );
+		value = evaluator.evaluate( &macros );
+		Assert::IsTrue( value.getInteger() == 7 );
+
+		// Without macros identifiers evaluate to zero.
+		value = evaluator.evaluate();
+		Assert::IsTrue( value.getInteger() == 1 );
+	}
+
+	/**
+	** @brief Check the defined operator with parenthesized identifiers.
+	**
+	** defined( ( X ) ) checks if X is defined just like defined X.
+	*/
+	[TestMethod]
+	void definedTest()
+	{
+		TokenExpressions  expressions;
+		Expression        evaluator;
+		Expression::Value value;
+		MacroSet          macros;
+
+		Macro level( L"LEVEL", L"", 1 );
+		macros[level.getIdentifier()] = level;
+
+		// defined LEVEL (1)
+		expressions.clear();
+		expressions.push_back( TokenExpression( TOK_OP_DEFINED, CTX_DEFAULT, L"defined" ) );
+		expressions.push_back( TokenExpression( TOK_SPACE, CTX_DEFAULT, L" " ) );
+		expressions.push_back( TokenExpression( TOK_IDENTIFIER, CTX_DEFAULT, L"LEVEL" ) );
+		evaluator.build( expressions );
+		value = evaluator.evaluate( &macros );
+		Assert::IsTrue( value.getInteger() == 1 );
+
+		// defined( ( LEVEL ) ) (1)
+		expressions.clear();
+		expressions.push_back( TokenExpression( TOK_OP_DEFINED, CTX_DEFAULT, L"defined" ) );
+		expressions.push_back( TokenExpression( TOK_LEFT_PARENTHESIS, CTX_DEFAULT, L"(" ) );
+		expressions.push_back( TokenExpression( TOK_SPACE, CTX_DEFAULT, L" " ) );
+		expressions.push_back( TokenExpression( TOK_LEFT_PARENTHESIS, CTX_DEFAULT, L"(" ) );
+		expressions.push_back( TokenExpression( TOK_SPACE, CTX_DEFAULT, L" " ) );
+		expressions.push_back( TokenExpression( TOK_IDENTIFIER, CTX_DEFAULT, L"LEVEL" ) );
+		expressions.push_back( TokenExpression( TOK_SPACE, CTX_DEFAULT, L" " ) );
+		expressions.push_back( TokenExpression( TOK_RIGHT_PARENTHESIS, CTX_DEFAULT, L")" ) );
+		expressions.push_back( TokenExpression( TOK_SPACE, CTX_DEFAULT, L" " ) );
+		expressions.push_back( TokenExpression( TOK_RIGHT_PARENTHESIS, CTX_DEFAULT, L")" ) );
+		evaluator.build( expressions );
+		value = evaluator.evaluate( &macros );
+		Assert::IsTrue( value.getInteger() == 1 );
+
+		// defined((UNKNOWN)) || 2 > 3 (0)
+		expressions.clear();
+		expressions.push_back( TokenExpression( TOK_OP_DEFINED, CTX_DEFAULT, L"defined" ) );
+		expressions.push_back( TokenExpression( TOK_LEFT_PARENTHESIS, CTX_DEFAULT, L"(" ) );
+		expressions.push_back( TokenExpression( TOK_LEFT_PARENTHESIS, CTX_DEFAULT, L"(" ) );
+		expressions.push_back( TokenExpression( TOK_IDENTIFIER, CTX_DEFAULT, L"UNKNOWN" ) );
+		expressions.push_back( TokenExpression( TOK_RIGHT_PARENTHESIS, CTX_DEFAULT, L")" ) );
+		expressions.push_back( TokenExpression( TOK_RIGHT_PARENTHESIS, CTX_DEFAULT, L")" ) );
+		expressions.push_back( TokenExpression( TOK_OP_LOGICAL_OR, CTX_DEFAULT, L"||" ) );
+		expressions.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"2" ) );
+		expressions.push_back( TokenExpression( TOK_OP_GT, CTX_DEFAULT, L">" ) );
+		expressions.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"3" ) );
+		evaluator.build( expressions );
+		value = evaluator.evaluate( &macros );
+		Assert::IsTrue( value.getInteger() == 0 );
+	}
+
 }; // class ExpressionTest
 
 } // namespace test
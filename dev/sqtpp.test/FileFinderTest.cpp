@@ -88,6 +88,40 @@ public:
 		bool isEmpty = result.empty();
 		Assert::IsTrue( isEmpty );
 	};
+
+	[TestMethod]
+	void cachedFileLookupTest()
+	{
+		std::vector<std::wstring> includeDirectories;
+		std::wstring filePath = TestFileDirectory + L"special/findfile.h";
+		FileFinderCache cache;
+		FileFinder ff( includeDirectories, filePath, &cache );
+
+		std::wstring result1 = ff.findFile( L"include/findfile_include.h" );
+		std::wstring missing1 = ff.findFile( L"not_existing_include.h" );
+		size_t probeCount = cache.getProbeCount();
+		Assert::IsTrue( probeCount > 0 );
+
+		// Found and not found files are looked up without probing the file system again.
+		std::wstring result2 = ff.findFile( L"include/findfile_include.h" );
+		std::wstring missing2 = ff.findFile( L"not_existing_include.h" );
+		Assert::IsTrue( result1 == result2 );
+		Assert::IsTrue( missing2.empty() );
+		Assert::IsTrue( cache.getProbeCount() == probeCount );
+		Assert::IsTrue( cache.getLookupCount() == 4 );
+
+		// Another cache (i.e. another processor) searches again.
+		FileFinderCache otherCache;
+		FileFinder otherFinder( includeDirectories, filePath, &otherCache );
+		Assert::IsTrue( otherFinder.findFile( L"include/findfile_include.h" ) == result1 );
+		Assert::IsTrue( otherCache.getProbeCount() > 0 );
+
+		// Clearing the cache resets the counters too.
+		cache.clear();
+		Assert::IsTrue( cache.getLookupCount() == 0 && cache.getProbeCount() == 0 );
+		Assert::IsTrue( ff.findFile( L"include/findfile_include.h" ) == result1 );
+		Assert::IsTrue( cache.getProbeCount() > 0 );
+	};
 };
 
 } // namespace test
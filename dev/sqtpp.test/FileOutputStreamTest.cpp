@@ -0,0 +1,153 @@
+#include "stdafx.h"
+#include <io.h>
+#include <sys/stat.h>
+#include <iterator>
+#include "CodePage.h"
+#include "Streams.h"
+#include "TestBase.h"
+
+namespace sqtpp {
+namespace test {
+
+[TestClass]
+public ref class FileOutputStreamTest : public TestBase
+{
+private:
+	static string readBytes( const char* pszFileName )
+	{
+		std::ifstream stream( pszFileName, ios::in | ios::binary );
+		return string( std::istreambuf_iterator<char>( stream ), std::istreambuf_iterator<char>() );
+	}
+
+	static string writeFile( const char* pszFileName, CodePageId codePageId, const wstring& text )
+	{
+		const CodePageInfo& codePage = CodePageInfo::getCodePageInfo( codePageId );
+		wstring fileName( pszFileName, pszFileName + strlen( pszFileName ) );
+		FileOutputStream stream;
+		Assert::IsTrue( stream.open( fileName, codePage ) );
+		stream << text;
+		stream.close();
+		Assert::IsTrue( stream.good() );
+		return readBytes( pszFileName );
+	}
+
+public:
+	/**
+	** @brief Test writing an UTF-8 file (with byte order mark).
+	*/
+	[TestMethod]
+	void writeUtf8Test()
+	{
+		// "abc" followed by an a umlaut and an euro sign.
+		string bytes = writeFile( "output_utf8.txt", CPID_UTF8, L"abc\x00E4\x20AC" );
+		Assert::IsTrue( bytes == "\xEF\xBB\xBF" "abc\xC3\xA4\xE2\x82\xAC" );
+	}
+
+	/**
+	** @brief Test writing an UTF-16 file (with byte order mark).
+	*/
+	[TestMethod]
+	void writeUtf16Test()
+	{
+		string bytes = writeFile( "output_utf16.txt", CPID_UTF16, L"ab\x00E4" );
+		Assert::IsTrue( bytes == string( "\xFF\xFE" "a\0b\0\xE4\0", 8 ) );
+
+		bytes = writeFile( "output_utf16be.txt", CPID_UTF16BE, L"ab\x00E4" );
+		Assert::IsTrue( bytes == string( "\xFE\xFF" "\0a\0b\0\xE4", 8 ) );
+	}
+
+	/**
+	** @brief Test writing a file in a single byte code page.
+	*/
+	[TestMethod]
+	void writeSbcsTest()
+	{
+		// "abc" followed by an a umlaut and an euro sign.
+		string bytes = writeFile( "output_cp1252.txt", CPID_WINDOWS_1252, L"abc\x00E4\x20AC" );
+		Assert::IsTrue( bytes == "abc\xE4\x80" );
+	}
+
+	/**
+	** @brief Test writing blocks larger than the buffers of the stream.
+	*/
+	[TestMethod]
+	void writeLargeBlockTest()
+	{
+		wstring text;
+		string  expected = "\xEF\xBB\xBF";
+		for ( int i = 0; i < 0x20000; ++i ) {
+			text+= L"x\x00E4";
+			expected+= "x\xC3\xA4";
+		}
+
+		string bytes = writeFile( "output_large.txt", CPID_UTF8, text );
+		Assert::IsTrue( bytes == expected );
+	}
+
+	/**
+	** @brief Test that a file is replaced only if the content has changed.
+	*/
+	[TestMethod]
+	void writeUnchangedTest()
+	{
+		const CodePageInfo& codePage = CodePageInfo::getCodePageInfo( CPID_WINDOWS_1252 );
+		const wstring fileName( L"output_unchanged.txt" );
+		FileOutputStream stream;
+
+		Assert::IsTrue( stream.open( fileName, codePage ) );
+		stream << L"abc";
+		stream.close();
+
+		// Same content.
+		Assert::IsTrue( stream.open( fileName, codePage ) );
+		stream << L"abc";
+		stream.close();
+		Assert::IsTrue( stream.isUnchanged() );
+		Assert::IsTrue( readBytes( "output_unchanged.txt" ) == "abc" );
+
+		// Same size but other content.
+		Assert::IsTrue( stream.open( fileName, codePage ) );
+		stream << L"abd";
+		stream.close();
+		Assert::IsFalse( stream.isUnchanged() );
+		Assert::IsTrue( readBytes( "output_unchanged.txt" ) == "abd" );
+
+		// Content larger than the buffers which differs at the end only.
+		wstring text( 0x50000, L'x' );
+		Assert::IsTrue( stream.open( fileName, codePage ) );
+		stream << text;
+		stream.close();
+		text[text.length() - 1] = L'y';
+		Assert::IsTrue( stream.open( fileName, codePage ) );
+		stream << text;
+		stream.close();
+		Assert::IsFalse( stream.isUnchanged() );
+		Assert::IsTrue( readBytes( "output_unchanged.txt" ) == string( 0x4FFFF, 'x' ) + 'y' );
+	}
+
+	/**
+	** @brief Test that a read only file is neither replaced nor left with a temporary file.
+	*/
+	[TestMethod]
+	void writeReadOnlyTest()
+	{
+		const CodePageInfo& codePage = CodePageInfo::getCodePageInfo( CPID_WINDOWS_1252 );
+		const wstring fileName( L"output_readonly.txt" );
+		FileOutputStream stream;
+
+		_wchmod( fileName.c_str(), _S_IREAD | _S_IWRITE );
+		Assert::IsTrue( stream.open( fileName, codePage ) );
+		stream << L"abc";
+		stream.close();
+		Assert::IsTrue( _wchmod( fileName.c_str(), _S_IREAD ) == 0 );
+
+		Assert::IsFalse( stream.open( fileName, codePage ) );
+		Assert::IsTrue( readBytes( "output_readonly.txt" ) == "abc" );
+
+		_wchmod( fileName.c_str(), _S_IREAD | _S_IWRITE );
+	}
+}; // class
+
+
+} // namespace test
+} // namespace sqtpp
@@ -0,0 +1,154 @@
+#include "stdafx.h"
+#include <iterator>
+#include "CodePage.h"
+#include "Options.h"
+#include "File.h"
+#include "Streams.h"
+#include "FileFinder.h"
+#include "FilePrefetcher.h"
+#include "TestBase.h"
+
+namespace sqtpp {
+namespace test {
+
+[TestClass]
+public ref class FilePrefetcherTest : public TestBase
+{
+private:
+	static wstring readContent( std::wistream& stream )
+	{
+		return wstring( std::istreambuf_iterator<wchar_t>( stream ), std::istreambuf_iterator<wchar_t>() );
+	}
+
+	static wstring readFile( const wstring& sFullPath )
+	{
+		FileContentStream stream;
+		stream.open( sFullPath, CodePageInfo::getDefaultCodePageId() );
+		return readContent( stream );
+	}
+
+public:
+	/**
+	** @brief Test that the includes of a file fetched are read and decoded in advance.
+	*/
+	[TestMethod]
+	void fetchIncludesTest()
+	{
+		Options         options;
+		FileFinderCache cache;
+		wstring         directory = TestFileDirectory;
+		FilePrefetcher  prefetcher( options, cache );
+
+		const wstring sRootPath = File::getFullPath( directory + L"mixedcp.h" );
+		FileContentStream rootStream;
+		const CodePageInfo* pCodePage = prefetcher.fetch( sRootPath, rootStream );
+		Assert::IsTrue( pCodePage != NULL );
+		Assert::IsTrue( readContent( rootStream ) == readFile( sRootPath ) );
+
+		// The includes have been resolved through the cache of the processor:
+		// The processor finds them without probing the file system again.
+		const wchar_t* includes[] = { 
+			L"include/mixedcp_1252.h", 
+			L"include/mixedcp_utf8.h", 
+			L"include/mixedcp_utf16.h", 
+			L"include/mixedcp_utf16be.h"
+		};
+		const size_t nIncludeCount = sizeof( includes ) / sizeof( includes[0] );
+		const size_t nProbeCount   = cache.getProbeCount();
+		Assert::IsTrue( cache.getLookupCount() == nIncludeCount );
+		Assert::IsTrue( nProbeCount > 0 );
+		for ( size_t i = 0; i < nIncludeCount; ++i ) {
+			FileFinder fileFinder( options.getIncludeDirectories(), sRootPath, &cache );
+			const wstring sIncludePath = fileFinder.findFile( includes[i] );
+			Assert::IsTrue( sIncludePath == File::getFullPath( directory + includes[i] ) );
+
+			FileContentStream includeStream;
+			pCodePage = prefetcher.fetch( sIncludePath, includeStream );
+			Assert::IsTrue( pCodePage != NULL );
+			Assert::IsTrue( readContent( includeStream ) == readFile( sIncludePath ) );
+		}
+		Assert::IsTrue( cache.getProbeCount() == nProbeCount );
+
+		// The root file and its includes have been read by the background
+		// thread and all of them were served from the prefetched content.
+		Assert::IsTrue( prefetcher.getPrefetchCount() == 1 + nIncludeCount );
+		Assert::IsTrue( prefetcher.getFetchCount() == 1 + nIncludeCount );
+
+		// Included again: The file is read by the stream itself.
+		FileContentStream againStream;
+		Assert::IsTrue( prefetcher.fetch( sRootPath, againStream ) != NULL );
+		Assert::IsTrue( prefetcher.getFetchCount() == 1 + nIncludeCount );
+	}
+
+	/**
+	** @brief Test that the includes of a file read by the processor are read in advance.
+	*/
+	[TestMethod]
+	void prefetchIncludesTest()
+	{
+		Options         options;
+		FileFinderCache cache;
+		wstring         directory = TestFileDirectory;
+		FilePrefetcher  prefetcher( options, cache );
+
+		const wstring sRootPath = File::getFullPath( directory + L"mixedcp.h" );
+		prefetcher.prefetchIncludes( sRootPath );
+
+		const wchar_t* includes[] = { 
+			L"include/mixedcp_1252.h", 
+			L"include/mixedcp_utf8.h", 
+			L"include/mixedcp_utf16.h", 
+			L"include/mixedcp_utf16be.h"
+		};
+		const size_t nIncludeCount = sizeof( includes ) / sizeof( includes[0] );
+		for ( size_t i = 0; i < nIncludeCount; ++i ) {
+			const wstring sIncludePath = File::getFullPath( directory + includes[i] );
+			FileContentStream includeStream;
+			Assert::IsTrue( prefetcher.fetch( sIncludePath, includeStream ) != NULL );
+			Assert::IsTrue( readContent( includeStream ) == readFile( sIncludePath ) );
+		}
+
+		// Only the includes have been read by the background thread.
+		Assert::IsTrue( prefetcher.getPrefetchCount() == nIncludeCount );
+		Assert::IsTrue( prefetcher.getFetchCount() == nIncludeCount );
+	}
+
+	/**
+	** @brief Test that a file fetched again is read again.
+	*/
+	[TestMethod]
+	void fetchAgainTest()
+	{
+		Options         options;
+		FileFinderCache cache;
+		wstring         directory = TestFileDirectory;
+		FilePrefetcher  prefetcher( options, cache );
+
+		const wstring sFullPath = File::getFullPath( directory + L"include1.h" );
+		FileContentStream stream1;
+		FileContentStream stream2;
+		Assert::IsTrue( prefetcher.fetch( sFullPath, stream1 ) != NULL );
+		Assert::IsTrue( prefetcher.fetch( sFullPath, stream2 ) != NULL );
+		Assert::IsTrue( readContent( stream1 ) == readContent( stream2 ) );
+	}
+
+	/**
+	** @brief Test that a missing file is reported like a file read without prefetcher.
+	*/
+	[TestMethod]
+	void fetchMissingFileTest()
+	{
+		Options         options;
+		FileFinderCache cache;
+		wstring         directory = TestFileDirectory;
+		FilePrefetcher  prefetcher( options, cache );
+
+		FileContentStream stream;
+		const CodePageInfo* pCodePage = prefetcher.fetch( File::getFullPath( directory + L"not_existing.h" ), stream );
+		Assert::IsTrue( pCodePage == NULL );
+		Assert::IsTrue( stream.fail() );
+	}
+}; // class
+
+} // namespace test
+} // namespace sqtpp
@@ -48,6 +48,71 @@ public:
 		Assert::IsTrue( File::isFile( filePath.c_str() ) );
 	}
 
+	[TestMethod]
+	void openTest()
+	{
+		wstring directory = TestFileDirectory;
+		File    ansiFile;
+		File    utf8File;
+
+		// The byte order mark must not be part of the content.
+		wistream& ansiInput = ansiFile.open( directory + L"ansiabc.txt" );
+		wistream& utf8Input = utf8File.open( directory + L"utf8abc.txt" );
+		wstring   ansiText;
+		wstring   utf8Text;
+		getline( ansiInput, ansiText );
+		getline( utf8Input, utf8Text );
+		Assert::IsTrue( ansiText == L"ABCDEFGHIJKLMNOPQRSTUVWXYZ" );
+		Assert::IsTrue( utf8Text == ansiText );
+	}
+
+	[TestMethod]
+	void openInvalidTest()
+	{
+		wstring directory = TestFileDirectory;
+		File    file;
+
+		// Invalid bytes are replaced by the unicode replacement character.
+		wistream& input = file.open( directory + L"utf8invalid.txt" );
+		wstring   text;
+		getline( input, text );
+		Assert::IsTrue( text == L"ABC\xFFFD" L"DEF" );
+	}
+
+	/**
+	** @brief Test that only the invalid bytes are replaced (not the valid characters preceding them).
+	*/
+	[TestMethod]
+	void openInvalidSequenceTest()
+	{
+		wstring directory = TestFileDirectory;
+		File    leadFile;
+		File    trailFile;
+		wstring text;
+
+		// A lead byte followed by an ASCII character.
+		getline( leadFile.open( directory + L"utf8invalidlead.txt" ), text );
+		Assert::IsTrue( text == L"ABC\xFFFD" L"DEF" );
+
+		// A continuation byte without a lead byte.
+		getline( trailFile.open( directory + L"utf8invalidtrail.txt" ), text );
+		Assert::IsTrue( text == L"\x00E4\xFFFD\x00E4" );
+	}
+
+	/**
+	** @brief Test that an odd byte at the end of an UTF-16 file is replaced.
+	*/
+	[TestMethod]
+	void openOddByteTest()
+	{
+		wstring directory = TestFileDirectory;
+		File    file;
+		wstring text;
+
+		getline( file.open( directory + L"utf16odd.txt" ), text );
+		Assert::IsTrue( text == L"AB\xFFFD" );
+	}
+
 }; // class
 
 
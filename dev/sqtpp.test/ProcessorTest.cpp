@@ -1246,6 +1246,184 @@ public:
 		Assert::IsTrue( outputText == L"C" );
 	}
 
+	/**
+	** @brief Test the minified output (blanks collapsed, comments removed, hints kept).
+	*/
+	[TestMethod]
+	void minifyTest()
+	{
+		Options       options;
+		Processor     processor( options );
+		wstringstream input;
+		wstringstream output;
+		wstring       outputText;
+
+		options.minify();
+		options.setNewLineOutput( Options::NLO_LF );
+
+		input.str( L"select  a,\t b  -- comment\n"
+		           L"  from /*+ INDEX(t) */ t\t\n"
+		           L"\n"
+		           L"/* a\n"
+		           L"   b */ where x = 'a  b  '\n"
+		           L"  and/* c */y = 1\n"
+		           L"GO" );
+		processor.setOutStream( output );
+		processor.processStream( input );
+		outputText = output.str();
+		Assert::IsTrue( outputText == L"select a, b\n"
+		                              L"from /*+ INDEX(t) */ t\n"
+		                              L"where x = 'a  b  '\n"
+		                              L"and y = 1\n"
+		                              L"GO" );
+	}
+
+	/**
+	** @brief Test the collapsing of blanks produced by macro expansions.
+	*/
+	[TestMethod]
+	void minifyMacroTest()
+	{
+		Options       options;
+		Processor     processor( options );
+		wstringstream input;
+		wstringstream output;
+		wstring       outputText;
+
+		options.minify();
+		options.setNewLineOutput( Options::NLO_LF );
+
+		input.str( L"#define E\n"
+		           L"#define S(a)  #a   ,   a\n"
+		           L"select  E   S(  x    +\ty  )  E  ,  z\n"
+		           L"  from t" );
+		processor.setOutStream( output );
+		processor.processStream( input );
+		outputText = output.str();
+		Assert::IsTrue( outputText == L"select 'x + y' , x + y , z\n"
+		                              L"from t" );
+	}
+
+	/**
+	** @brief Test that SQL line comments are kept unless the output is minified.
+	*/
+	[TestMethod]
+	void sqlCommentTest()
+	{
+		Options       options;
+		Processor     processor( options );
+		wstringstream input;
+		wstringstream output;
+		wstring       outputText;
+
+		options.keepComments( false );
+		options.setNewLineOutput( Options::NLO_LF );
+
+		input.str( L"select a -- comment\n"
+		           L"  from t --+ hint" );
+		processor.setOutStream( output );
+		processor.processStream( input );
+		outputText = output.str();
+		Assert::IsTrue( outputText == L"select a -- comment\n"
+		                              L"  from t --+ hint" );
+	}
+
+
+	/**
+	** @brief Test the processing of the input outside of the output range.
+	*/
+	[TestMethod]
+	void outputRangeTest()
+	{
+		Options       options;
+		Processor     processor( options );
+		wstringstream input;
+		wstringstream output;
+		wstring       outputText;
+
+		options.emitLine( false );
+		options.eliminateEmptyLines( true );
+		options.setNewLineOutput( Options::NLO_LF );
+		// The fourth line only.
+		options.setOutputRange( Range( 56, 81 ) );
+
+		input.str( L"#define A 1\n"
+		           L"#define F(x) x + A\n"
+		           L"select F(1), __COUNTER__\n"
+		           L"select F(2), __COUNTER__\n"
+		           L"#error The input following the range is not processed.\n"
+		           L"select F(3)\n" );
+		processor.setOutStream( output );
+		processor.processStream( input );
+		outputText = output.str();
+		Assert::IsTrue( outputText == L"select 2 + 1, 1\n" );
+	}
+
+	/**
+	** @brief Test that the text following a macro within the output range is emitted.
+	**
+	** The tokens of the macro expansion must not move the position in the file.
+	*/
+	[TestMethod]
+	void outputRangeMacroTest()
+	{
+		Options       options;
+		Processor     processor( options );
+		wstringstream input;
+		wstringstream output;
+		wstring       outputText;
+
+		options.emitLine( false );
+		options.eliminateEmptyLines( true );
+		options.setNewLineOutput( Options::NLO_LF );
+		// The second line only.
+		options.setOutputRange( Range( 44, 59 ) );
+
+		input.str( L"#define LONG 123456789012345678901234567890\n"
+		           L"select LONG, x\n"
+		           L"select y\n" );
+		processor.setOutStream( output );
+		processor.processStream( input );
+		outputText = output.str();
+		Assert::IsTrue( outputText == L"select 123456789012345678901234567890, x\n" );
+	}
+
+	/**
+	** @brief Test that the input following the output range is left unread.
+	**
+	** The conditional blocks still open are closed silently.
+	*/
+	[TestMethod]
+	void outputRangeEndTest()
+	{
+		const wchar_t* inputTexts[] = { 
+			L"select 1\n#if 1\nselect 2\n", 
+			L"select 1\n#ifndef A\n#error A is not defined.\n#endif\nselect 2\n" 
+		};
+
+		for ( int nInput = 0; nInput < 2; ++nInput ) {
+			Options       options;
+			Processor     processor( options );
+			wstringstream input( inputTexts[nInput] );
+			wstringstream output;
+			wstringstream errors;
+
+			options.emitLine( false );
+			options.eliminateEmptyLines( true );
+			options.setNewLineOutput( Options::NLO_LF );
+			// The first line only.
+			options.setOutputRange( Range( 0, 9 ) );
+
+			processor.setOutStream( output );
+			std::wstreambuf* pErrBuffer = std::wcerr.rdbuf( errors.rdbuf() );
+			processor.processStream( input );
+			std::wcerr.rdbuf( pErrBuffer );
+
+			Assert::IsTrue( output.str() == L"select 1\n" );
+			Assert::IsTrue( errors.str().empty() );
+		}
+	}
+
 
 }; // class
 
@@ -0,0 +1,224 @@
+#include "stdafx.h"
+#include "CodePage.h"
+#include "CodePageConverter.h"
+#include "TestBase.h"
+
+namespace sqtpp {
+namespace test {
+
+[TestClass]
+public ref class SbcsConverterTest : public TestBase
+{
+public:
+	/**
+	** @brief Test for in method
+	*/
+	[TestMethod]
+	void inTest()
+	{
+		mbstate_t state;
+		// "ABCDEFGHIJKLMNOPQRSTUVWXYZ" followed by the german umlauts
+		char in850[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ\x84\x94\x81\x8E\x99\x9A";
+		char in1252[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ\xE4\xF6\xFC\xC4\xD6\xDC";
+		wchar_t outUmlaut[] = L"ABCDEFGHIJKLMNOPQRSTUVWXYZ\x00E4\x00F6\x00FC\x00C4\x00D6\x00DC";
+		const char* pIn;
+		const char* pInMax;
+		const char* pInNext;
+		size_t inCount;
+
+		wchar_t  outBuffer[128];
+		wchar_t* pOut;
+		wchar_t* pOutMax;
+		wchar_t* pOutNext;
+
+		int result;
+
+		SbcsConverter converter850( CPID_OEM_850 );
+		pIn = in850;
+		inCount = strlen( pIn );
+		pInMax = pIn + inCount;
+		pOut = outBuffer;
+		pOutMax = pOut + 128;
+		result = converter850.in( state, pIn, pInMax, pInNext, pOut, pOutMax, pOutNext );
+		Assert::IsTrue( result == std::codecvt_base::ok );
+		Assert::IsTrue( pInNext == pInMax );
+		Assert::IsTrue( pOutNext == pOut + inCount );
+		Assert::IsTrue( wcsncmp( outBuffer, outUmlaut, inCount ) == 0 );
+
+		SbcsConverter converter1252( CPID_WINDOWS_1252 );
+		pIn = in1252;
+		inCount = strlen( pIn );
+		pInMax = pIn + inCount;
+		pOut = outBuffer;
+		pOutMax = pOut + 128;
+		result = converter1252.in( state, pIn, pInMax, pInNext, pOut, pOutMax, pOutNext );
+		Assert::IsTrue( result == std::codecvt_base::ok );
+		Assert::IsTrue( pInNext == pInMax );
+		Assert::IsTrue( pOutNext == pOut + inCount );
+		Assert::IsTrue( wcsncmp( outBuffer, outUmlaut, inCount ) == 0 );
+
+		pIn = in1252;
+		pOut = outBuffer;
+		pOutMax = pOut + 27;
+		result = converter1252.in( state, pIn, pInMax, pInNext, pOut, pOutMax, pOutNext );
+		Assert::IsTrue( result == std::codecvt_base::partial );
+		Assert::IsTrue( pInNext == pIn + 27 );
+		Assert::IsTrue( pOutNext == pOutMax );
+	}
+
+	/**
+	** @brief Test for out method
+	*/
+	[TestMethod]
+	void outTest()
+	{
+		mbstate_t state;
+		// "ABCDEFGHIJKLMNOPQRSTUVWXYZ" followed by the german umlauts and an euro sign.
+		wchar_t inUmlaut[] = L"ABCDEFGHIJKLMNOPQRSTUVWXYZ\x00E4\x00F6\x00FC\x00C4\x00D6\x00DC\x20AC";
+		char out850[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ\x84\x94\x81\x8E\x99\x9A?";
+		char out1252[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ\xE4\xF6\xFC\xC4\xD6\xDC\x80";
+		const wchar_t* pIn;
+		const wchar_t* pInMax;
+		const wchar_t* pInNext;
+		size_t inCount;
+
+		char  outBuffer[128];
+		char* pOut;
+		char* pOutMax;
+		char* pOutNext;
+
+		int result;
+
+		SbcsConverter converter850( CPID_OEM_850 );
+		pIn = inUmlaut;
+		inCount = wcslen( pIn );
+		pInMax = pIn + inCount;
+		pOut = outBuffer;
+		pOutMax = pOut + 128;
+		result = converter850.out( state, pIn, pInMax, pInNext, pOut, pOutMax, pOutNext );
+		Assert::IsTrue( result == std::codecvt_base::ok );
+		Assert::IsTrue( pInNext == pInMax );
+		Assert::IsTrue( pOutNext == pOut + inCount );
+		Assert::IsTrue( strncmp( outBuffer, out850, inCount ) == 0 );
+
+		SbcsConverter converter1252( CPID_WINDOWS_1252 );
+		pIn = inUmlaut;
+		pOut = outBuffer;
+		result = converter1252.out( state, pIn, pInMax, pInNext, pOut, pOutMax, pOutNext );
+		Assert::IsTrue( result == std::codecvt_base::ok );
+		Assert::IsTrue( pInNext == pInMax );
+		Assert::IsTrue( pOutNext == pOut + inCount );
+		Assert::IsTrue( strncmp( outBuffer, out1252, inCount ) == 0 );
+	}
+
+	/**
+	** @brief Test that the characters not part of the code page are converted to their best fit.
+	*/
+	[TestMethod]
+	void outBestFitTest()
+	{
+		mbstate_t state;
+		// "A" and "a" with macron and a CJK character without best fit.
+		wchar_t in[] = L"\x0100\x0101\x4E00";
+		char    out1252[] = "Aa?";
+		const wchar_t* pInNext;
+		char           outBuffer[16];
+		char*          pOutNext;
+
+		SbcsConverter converter1252( CPID_WINDOWS_1252 );
+		const int result = converter1252.out( state, in, in + 3, pInNext, outBuffer, outBuffer + 16, pOutNext );
+		Assert::IsTrue( result == std::codecvt_base::ok );
+		Assert::IsTrue( pInNext == in + 3 );
+		Assert::IsTrue( pOutNext == outBuffer + 3 );
+		Assert::IsTrue( strncmp( outBuffer, out1252, 3 ) == 0 );
+	}
+
+	/**
+	** @brief Test the tables of code page 850 and 1252 against the mapping
+	** files of the unicode consortium (MAPPINGS/VENDORS/MICSFT).
+	*/
+	[TestMethod]
+	void tableTest()
+	{
+		// The characters 0x80 to 0xFF of code page 850.
+		const wchar_t ref850[128] = {
+			0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7,
+			0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5,
+			0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9,
+			0x00FF, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x00D7, 0x0192,
+			0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA,
+			0x00BF, 0x00AE, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+			0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x00C1, 0x00C2, 0x00C0,
+			0x00A9, 0x2563, 0x2551, 0x2557, 0x255D, 0x00A2, 0x00A5, 0x2510,
+			0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x00E3, 0x00C3,
+			0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4,
+			0x00F0, 0x00D0, 0x00CA, 0x00CB, 0x00C8, 0x0131, 0x00CD, 0x00CE,
+			0x00CF, 0x2518, 0x250C, 0x2588, 0x2584, 0x00A6, 0x00CC, 0x2580,
+			0x00D3, 0x00DF, 0x00D4, 0x00D2, 0x00F5, 0x00D5, 0x00B5, 0x00FE,
+			0x00DE, 0x00DA, 0x00DB, 0x00D9, 0x00FD, 0x00DD, 0x00AF, 0x00B4,
+			0x00AD, 0x00B1, 0x2017, 0x00BE, 0x00B6, 0x00A7, 0x00F7, 0x00B8,
+			0x00B0, 0x00A8, 0x00B7, 0x00B9, 0x00B3, 0x00B2, 0x25A0, 0x00A0,
+		};
+		// The characters 0x80 to 0xFF of code page 1252. The undefined
+		// bytes are mapped to the C1 control characters.
+		const wchar_t ref1252[128] = {
+			0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+			0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+			0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+			0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178,
+			0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+			0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+			0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+			0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+			0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,
+			0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+			0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7,
+			0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+			0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+			0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+			0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+			0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF,
+		};
+
+		checkTable( CPID_OEM_850, ref850 );
+		checkTable( CPID_WINDOWS_1252, ref1252 );
+	}
+
+private:
+	/**
+	** @brief Convert all 256 bytes to unicode and back again.
+	*/
+	static void checkTable( CodePageId codePageId, const wchar_t* pReference )
+	{
+		mbstate_t     state;
+		char          bytes[256];
+		wchar_t       chars[256];
+		char          outBytes[256];
+		const char*   pInNext;
+		wchar_t*      pOutNext;
+		const wchar_t* pCharNext;
+		char*         pByteNext;
+		int           result;
+
+		for ( int i = 0; i < 256; ++i ) {
+			bytes[i] = char( i );
+		}
+
+		SbcsConverter converter( codePageId );
+		result = converter.in( state, bytes, bytes + 256, pInNext, chars, chars + 256, pOutNext );
+		Assert::IsTrue( result == std::codecvt_base::ok );
+		Assert::IsTrue( pOutNext == chars + 256 );
+		for ( int i = 0; i < 256; ++i ) {
+			const wchar_t expected = i < 128 ? wchar_t( i ) : pReference[i - 128];
+			Assert::IsTrue( chars[i] == expected );
+		}
+
+		result = converter.out( state, chars, chars + 256, pCharNext, outBytes, outBytes + 256, pByteNext );
+		Assert::IsTrue( result == std::codecvt_base::ok );
+		Assert::IsTrue( pByteNext == outBytes + 256 );
+		Assert::IsTrue( memcmp( bytes, outBytes, 256 ) == 0 );
+	}
+}; // class
+
+} // namespace test
+} // namespace sqtpp
@@ -74,6 +74,28 @@ public:
 		testTokenSequence( inputText, tokensExpected );
 	}
 
+	/**
+	** @brief Test scanning SQL identifiers with underscores, digits and dollar signs.
+	*/
+	[TestMethod]
+	void scanIdentifier2Test()
+	{
+		wstring          inputText = L"_a1\tx$y 0xAfg";
+		TokenExpressions tokensExpected;
+
+		// Dollar signs are part of identifiers in SQL scripts only.
+		m_options.setLanguage( Options::LNG_SQL );
+		tokensExpected.push_back( TokenExpression( TOK_IDENTIFIER, CTX_DEFAULT, L"_a1" ) );
+		tokensExpected.push_back( TokenExpression( TOK_SPACE, CTX_DEFAULT, L"\t" ) );
+		tokensExpected.push_back( TokenExpression( TOK_IDENTIFIER, CTX_DEFAULT, L"x$y" ) );
+		tokensExpected.push_back( TokenExpression( TOK_SPACE, CTX_DEFAULT, L" " ) );
+		tokensExpected.push_back( TokenExpression( TOK_NUMBER, CTX_DEFAULT, L"0xAf" ) );
+		tokensExpected.push_back( TokenExpression( TOK_IDENTIFIER, CTX_DEFAULT, L"g" ) );
+		tokensExpected.push_back( TokenExpression( TOK_END_OF_FILE, CTX_DEFAULT, L"" ) );
+
+		testTokenSequence( inputText, tokensExpected );
+	}
+
 	/**
 	** @brief Test scanning numbers.
 	*/
@@ -0,0 +1,67 @@
+#include "stdafx.h"
+#include "SourceMap.h"
+#include "TestBase.h"
+
+namespace sqtpp {
+namespace test {
+
+[TestClass]
+public ref class SourceMapTest : public TestBase
+{
+public:
+	/**
+	** @brief Test that consecutive lines are merged into one range.
+	*/
+	[TestMethod]
+	void addLineTest()
+	{
+		SourceMap sourceMap;
+
+		// a.sql lines 1 - 3, b.h lines 10 - 11 (line 5 empty), a.sql lines 5 - 6.
+		sourceMap.addLine( 1, L"a.sql", 1 );
+		sourceMap.addLine( 2, L"a.sql", 2 );
+		sourceMap.addLine( 3, L"a.sql", 3 );
+		sourceMap.addLine( 4, L"b.h", 10 );
+		sourceMap.addLine( 6, L"b.h", 12 );
+		sourceMap.addLine( 7, L"a.sql", 5 );
+		sourceMap.addLine( 8, L"a.sql", 6 );
+		Assert::IsTrue( sourceMap.getRangeCount() == 3 );
+
+		wstring sFilePath;
+		size_t  nSourceLine = 0;
+		Assert::IsFalse( sourceMap.find( 0, sFilePath, nSourceLine ) );
+		Assert::IsTrue( sourceMap.find( 2, sFilePath, nSourceLine ) );
+		Assert::IsTrue( sFilePath == L"a.sql" && nSourceLine == 2 );
+		Assert::IsTrue( sourceMap.find( 6, sFilePath, nSourceLine ) );
+		Assert::IsTrue( sFilePath == L"b.h" && nSourceLine == 12 );
+		Assert::IsTrue( sourceMap.find( 8, sFilePath, nSourceLine ) );
+		Assert::IsTrue( sFilePath == L"a.sql" && nSourceLine == 6 );
+	}
+
+	/**
+	** @brief Test the format of the map written.
+	*/
+	[TestMethod]
+	void writeTest()
+	{
+		SourceMap     sourceMap;
+		wstringstream output;
+
+		sourceMap.addLine( 1, L"a.sql", 1 );
+		sourceMap.addLine( 2, L"b.h", 10 );
+		sourceMap.addLine( 3, L"b.h", 11 );
+		sourceMap.addLine( 4, L"a.sql", 3 );
+		sourceMap.write( output );
+
+		Assert::IsTrue( output.str() == L"sqtpp source map 1\n"
+		                                L"F\t0\ta.sql\n"
+		                                L"F\t1\tb.h\n"
+		                                L"R\t1\t1\t0\t1\n"
+		                                L"R\t2\t3\t1\t10\n"
+		                                L"R\t4\t4\t0\t3\n" );
+	}
+}; // class
+
+
+} // namespace test
+} // namespace sqtpp
@@ -165,6 +165,75 @@ public:
 		Assert::IsTrue( pOutNext == pOut + 1 );
 	}
 
+	/**
+	** @brief Test for in method with runs of ASCII characters and multi byte sequences
+	*/
+	[TestMethod]
+	void inMixedTest()
+	{
+		Utf8Converter converter(0);
+
+		mbstate_t state;
+		// "ABCDEFGHIJKLMNOPQRSTUVWXYZ" followed by an a umlaut, "abc", an euro sign and "xyz"
+		char inMixed[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ\xC3\xA4" "abc\xE2\x82\xAC" "xyz";
+		wchar_t outMixed[] = L"ABCDEFGHIJKLMNOPQRSTUVWXYZ\x00E4" L"abc\x20AC" L"xyz";
+		// "ABCDEFGHIJKLMNOPQRSTUVWXYZ" followed by an invalid sequence
+		char inInvalid[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ\xC3\x41";
+		const char* pIn;
+		const char* pInMax;
+		const char* pInNext;
+		size_t inCount;
+
+		wchar_t  outBuffer[128];
+		wchar_t* pOut;
+		wchar_t* pOutMax;
+		wchar_t* pOutNext;
+
+		int result;
+
+		pIn = inMixed;
+		inCount = strlen( pIn );
+		pInMax = pIn + inCount;
+		pOut = outBuffer;
+		pOutMax = pOut + 128;
+		result = converter.in( state, pIn, pInMax, pInNext, pOut, pOutMax, pOutNext );
+		Assert::IsTrue( result == std::codecvt_base::ok );
+		Assert::IsTrue( pInNext == pInMax );
+		Assert::IsTrue( size_t(pOutNext - pOut) == wcslen( outMixed ) );
+		Assert::IsTrue( wcsncmp( outBuffer, outMixed, wcslen( outMixed ) ) == 0 );
+
+		// Incomplete sequence at the end of the input.
+		pIn = inMixed;
+		pInMax = pIn + 27;
+		pOut = outBuffer;
+		pOutMax = pOut + 128;
+		result = converter.in( state, pIn, pInMax, pInNext, pOut, pOutMax, pOutNext );
+		Assert::IsTrue( result == std::codecvt_base::partial );
+		Assert::IsTrue( pInNext == pIn + 26 );
+		Assert::IsTrue( pOutNext == pOut + 26 );
+
+		// Output buffer ends in front of the euro sign.
+		pIn = inMixed;
+		inCount = strlen( pIn );
+		pInMax = pIn + inCount;
+		pOut = outBuffer;
+		pOutMax = pOut + 30;
+		result = converter.in( state, pIn, pInMax, pInNext, pOut, pOutMax, pOutNext );
+		Assert::IsTrue( result == std::codecvt_base::partial );
+		Assert::IsTrue( pInNext == pIn + 31 );
+		Assert::IsTrue( pOutNext == pOut + 30 );
+
+		pIn = inInvalid;
+		inCount = strlen( pIn );
+		pInMax = pIn + inCount;
+		pOut = outBuffer;
+		pOutMax = pOut + 128;
+		result = converter.in( state, pIn, pInMax, pInNext, pOut, pOutMax, pOutNext );
+		Assert::IsTrue( result == std::codecvt_base::error );
+		Assert::IsTrue( pInNext == pIn );
+		Assert::IsTrue( pOutNext == pOut );
+	}
+
 	/**
 	** @brief Test for in method
 	*/
@@ -198,6 +267,41 @@ public:
 		Assert::IsTrue( pInNext == pIn + inCount );
 		Assert::IsTrue( pOutNext == pOut + inCount );
 	}
+
+	/**
+	** @brief Test for out method with runs of ASCII characters and other characters
+	*/
+	[TestMethod]
+	void outMixedTest()
+	{
+		Utf8Converter converter(0);
+
+		int result;
+		mbstate_t state;
+		// "ABCDEFGHIJKLMNOPQRSTUVWXYZ" followed by an a umlaut, "abc", an euro sign and "xyz"
+		wchar_t inMixed[] = L"ABCDEFGHIJKLMNOPQRSTUVWXYZ\x00E4" L"abc\x20AC" L"xyz";
+		char outMixed[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ\xC3\xA4" "abc\xE2\x82\xAC" "xyz";
+		const wchar_t* pIn;
+		const wchar_t* pInMax;
+		const wchar_t* pInNext;
+		size_t inCount;
+
+		char  outBuffer[128];
+		char* pOut;
+		char* pOutMax;
+		char* pOutNext;
+
+		pIn = inMixed;
+		inCount = wcslen( pIn );
+		pInMax = pIn + inCount;
+		pOut = outBuffer;
+		pOutMax = pOut + 128;
+		result = converter.out( state, pIn, pInMax, pInNext, pOut, pOutMax, pOutNext );
+		Assert::IsTrue( result == std::codecvt_base::ok );
+		Assert::IsTrue( pInNext == pInMax );
+		Assert::IsTrue( size_t(pOutNext - pOut) == strlen( outMixed ) );
+		Assert::IsTrue( strncmp( outBuffer, outMixed, strlen( outMixed ) ) == 0 );
+	}
 }; // class
 
 } // namespace test
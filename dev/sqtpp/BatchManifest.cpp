@@ -0,0 +1,192 @@
+#include "stdafx.h"
+#include "Util.h"
+#include "BatchManifest.h"
+
+namespace sqtpp {
+
+/**
+** @brief Constructor.
+*/
+BatchManifest::BatchManifest()
+: m_bCurrentStarted( false )
+, m_nPendingEmptyLines( 0 )
+{
+	m_current.nHash = Util::HASH_OFFSET_BASIS;
+	m_current.nLine = 0;
+}
+
+/**
+** @brief Add an output line to the current batch.
+**
+** @param pwcLine The text of the line (without the line feed).
+** @param nLength The number of characters of the line.
+** @param sFile The source file of the line.
+** @param nLine The source line.
+*/
+void BatchManifest::addLine( const wchar_t* pwcLine, size_t nLength, const std::wstring& sFile, size_t nLine )
+{
+	size_t nChar = 0;
+	while ( nChar < nLength && Util::isBlank( pwcLine[nChar] ) ) {
+		++nChar;
+	}
+	if ( nChar == nLength ) {
+		// Empty lines are hashed only if they are followed by a non empty line.
+		if ( m_bCurrentStarted ) {
+			++m_nPendingEmptyLines;
+		}
+		return;
+	}
+
+	if ( !m_bCurrentStarted ) {
+		m_bCurrentStarted   = true;
+		m_current.nHash     = Util::HASH_OFFSET_BASIS;
+		m_current.nLine     = nLine;
+		m_current.sFile     = sFile;
+		m_sHead.erase();
+	}
+	for ( ; m_nPendingEmptyLines > 0; --m_nPendingEmptyLines ) {
+		m_current.nHash = Util::hashText( m_current.nHash, L"\n", 1 );
+	}
+	m_current.nHash = Util::hashText( m_current.nHash, pwcLine, nLength );
+	m_current.nHash = Util::hashText( m_current.nHash, L"\n", 1 );
+
+	if ( m_sHead.length() < HEAD_SIZE ) {
+		const size_t nAvailable = HEAD_SIZE - m_sHead.length();
+		m_sHead.append( pwcLine, nLength < nAvailable ? nLength : nAvailable );
+		m_sHead+= L'\n';
+	}
+}
+
+/**
+** @brief Finish the current batch.
+**
+** Batches without any non empty line are not recorded.
+*/
+void BatchManifest::endBatch()
+{
+	if ( !m_bCurrentStarted ) {
+		return;
+	}
+
+	m_current.sObjectType.erase();
+	m_current.sObjectName.erase();
+	parseObject( m_sHead, m_current.sObjectType, m_current.sObjectName );
+	m_entries.push_back( m_current );
+
+	m_bCurrentStarted    = false;
+	m_nPendingEmptyLines = 0;
+}
+
+/**
+** @brief Get the next word of a batch.
+**
+** Blanks, line feeds and comments preceding the word are skipped. A word
+** ends at a blank, an opening parenthesis or a semicolon unless the
+** character is enclosed in brackets or double quotes.
+**
+** @param sText The text.
+** @param nPos The position to start with. On return the position following the word.
+*/
+std::wstring BatchManifest::readWord( const std::wstring& sText, size_t& nPos )
+{
+	const size_t nLength = sText.length();
+	for ( ;; ) {
+		while ( nPos < nLength && iswspace( sText[nPos] ) ) {
+			++nPos;
+		}
+		if ( sText.compare( nPos, 2, L"--" ) == 0 ) {
+			nPos = sText.find( L'\n', nPos );
+		} else if ( sText.compare( nPos, 2, L"/*" ) == 0 ) {
+			nPos = sText.find( L"*/", nPos + 2 );
+			if ( nPos != wstring::npos ) {
+				nPos+= 2;
+			}
+		} else {
+			break;
+		}
+		if ( nPos == wstring::npos ) {
+			nPos = nLength;
+			return wstring();
+		}
+	}
+
+	wstring word;
+	while ( nPos < nLength ) {
+		const wchar_t c = sText[nPos];
+		if ( c == L'[' || c == L'"' ) {
+			const wchar_t cEnd = c == L'[' ? L']' : L'"';
+			size_t nEnd = sText.find( cEnd, nPos + 1 );
+			nEnd = nEnd == wstring::npos ? nLength : nEnd + 1;
+			word.append( sText, nPos, nEnd - nPos );
+			nPos = nEnd;
+		} else if ( iswspace( c ) || c == L'(' || c == L';' ) {
+			break;
+		} else {
+			word+= c;
+			++nPos;
+		}
+	}
+	return word;
+}
+
+/**
+** @brief Get the object created or altered by a batch.
+**
+** Recognizes batches starting with
+** <tt>CREATE|ALTER [OR ALTER|OR REPLACE] PROC[EDURE]|VIEW|FUNCTION|TRIGGER name</tt>.
+**
+** @returns false if the batch doesn't create or alter such an object.
+*/
+bool BatchManifest::parseObject( const std::wstring& sHead, std::wstring& sType, std::wstring& sName )
+{
+	size_t  nPos = 0;
+	wstring word = readWord( sHead, nPos );
+	if ( _wcsicmp( word.c_str(), L"CREATE" ) != 0 && _wcsicmp( word.c_str(), L"ALTER" ) != 0 ) {
+		return false;
+	}
+
+	word = readWord( sHead, nPos );
+	if ( _wcsicmp( word.c_str(), L"OR" ) == 0 ) {
+		readWord( sHead, nPos );
+		word = readWord( sHead, nPos );
+	}
+
+	if ( _wcsicmp( word.c_str(), L"PROC" ) == 0 || _wcsicmp( word.c_str(), L"PROCEDURE" ) == 0 ) {
+		sType = L"PROCEDURE";
+	} else if ( _wcsicmp( word.c_str(), L"VIEW" ) == 0 ) {
+		sType = L"VIEW";
+	} else if ( _wcsicmp( word.c_str(), L"FUNCTION" ) == 0 ) {
+		sType = L"FUNCTION";
+	} else if ( _wcsicmp( word.c_str(), L"TRIGGER" ) == 0 ) {
+		sType = L"TRIGGER";
+	} else {
+		return false;
+	}
+
+	sName = readWord( sHead, nPos );
+	if ( sName.empty() ) {
+		sType.erase();
+		return false;
+	}
+	return true;
+}
+
+/**
+** @brief Write the manifest.
+*/
+void BatchManifest::write( std::wostream& output ) const
+{
+	output << L"sqtpp batch manifest 1" << L'\n';
+
+	for ( size_t nIndex = 0; nIndex < m_entries.size(); ++nIndex ) {
+		const Entry& entry = m_entries[nIndex];
+		Util::writeNumber( output, nIndex + 1 );
+		output << L'\t';
+		Util::writeHash( output, entry.nHash );
+		output << L'\t' << entry.sObjectType << L'\t' << entry.sObjectName << L'\t';
+		Util::writeNumber( output, entry.nLine );
+		output << L'\t' << entry.sFile << L'\n';
+	}
+}
+
+} // namespace sqtpp
@@ -0,0 +1,105 @@
+/**
+** @file
+** @author Ralf Seidel
+** @brief Declaration of the #sqtpp::BatchManifest.
+**
+**  2010 by SQL Service GmbH Wuppertal
+*/
+#ifndef SQTPP_BATCH_MANIFEST_H
+#define SQTPP_BATCH_MANIFEST_H
+#if _MSC_VER > 10
+#pragma once
+#endif
+
+namespace sqtpp {
+
+/**
+** @brief List of the hash values of the batches of the output.
+**
+** The lines of the output are hashed while they are emitted. A deployment
+** may skip every batch whose hash value equals the one of the previous
+** deployment. If a batch creates or alters a procedure, view, function or
+** trigger the type and the name of the object are recorded too:
+**
+** @code
+** sqtpp batch manifest 1
+** ordinal <tab> hash <tab> object type <tab> object name <tab> line <tab> file
+** @endcode
+**
+** The hash is the 64 bit FNV-1a hash of the UTF-16LE text of the batch
+** with each line terminated by a single line feed. Empty lines at the
+** start and the end of the batch and \#line directives do not contribute
+** to the hash. So a batch keeps its hash value if other batches change.
+*/
+class BatchManifest
+{
+private:
+	/// The manifest entry of a batch.
+	struct Entry
+	{
+		/// The hash value of the text.
+		unsigned long long nHash;
+		/// The type of the object created or altered (e.g. PROCEDURE).
+		std::wstring       sObjectType;
+		/// The name of the object created or altered.
+		std::wstring       sObjectName;
+		/// The source line of the first line of the batch.
+		size_t             nLine;
+		/// The source file of the first line of the batch.
+		std::wstring       sFile;
+	};
+
+	/// Array of the entries ordered by the batch ordinal.
+	typedef std::vector<Entry> EntryArray;
+
+	/// The maximal number of characters examined for the object name.
+	enum { HEAD_SIZE = 0x200 };
+
+	/// The entries of the batches completed.
+	EntryArray   m_entries;
+
+	/// The entry of the current batch.
+	Entry        m_current;
+
+	/// Flag indicating if the current batch contains any non empty line.
+	bool         m_bCurrentStarted;
+
+	/// Number of empty lines not yet hashed (they may end the batch).
+	size_t       m_nPendingEmptyLines;
+
+	/// The start of the current batch (lines terminated by a line feed).
+	std::wstring m_sHead;
+
+private:
+	// Get the object created or altered by a batch.
+	static bool parseObject( const std::wstring& sHead, std::wstring& sType, std::wstring& sName );
+
+	// Get the next word of a batch.
+	static std::wstring readWord( const std::wstring& sText, size_t& nPos );
+
+public:
+	// Constructor.
+	BatchManifest();
+
+	// Add an output line to the current batch.
+	void addLine( const wchar_t* pwcLine, size_t nLength, const std::wstring& sFile, size_t nLine );
+
+	// Finish the current batch.
+	void endBatch();
+
+	/// Get the number of batches completed.
+	size_t getBatchCount() const throw() { return m_entries.size(); }
+
+	/// Get the hash value of a batch (zero based index).
+	unsigned long long getHash( size_t nIndex ) const { return m_entries[nIndex].nHash; }
+
+	/// Get the name of the object created or altered by a batch (zero based index).
+	const std::wstring& getObjectName( size_t nIndex ) const { return m_entries[nIndex].sObjectName; }
+
+	// Write the manifest.
+	void write( std::wostream& output ) const;
+};
+
+} // namespace sqtpp
+
+#endif // SQTPP_BATCH_MANIFEST_H
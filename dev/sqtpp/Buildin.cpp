@@ -23,10 +23,15 @@ BuildinMacro::BuildinMacro( const wchar_t* identifier, MacroExpander& macroExpan
 {
 }
 
-void BuildinMacro::addBuildinMacros( const Options& options, MacroSet& macros )
+/**
+** @brief Create the registry of the buildin macros.
+**
+** The macros in the registry don't depend on the options. They are
+** created only once and copied into the macro set of each processor.
+*/
+MacroSet BuildinMacro::createRegistry()
 {
-	TokenExpression  token;
-	TokenExpressions tokens;
+	MacroSet registry;
 	BuildinCounter cntr;
 	BuildinDate date;
 	BuildinEval eval;
@@ -39,17 +44,42 @@ void BuildinMacro::addBuildinMacros( const Options& options, MacroSet& macros )
 	BuildinUser user;
 	BuildinInclude incl;
 
-	macros[cntr.getIdentifier()] = cntr;
-	macros[date.getIdentifier()] = date;
-	macros[eval.getIdentifier()] = eval;
-	macros[file.getIdentifier()] = file;
-	macros[host.getIdentifier()] = host;
-	macros[line.getIdentifier()] = line;
-	macros[quot.getIdentifier()] = quot;
-	macros[stmp.getIdentifier()] = stmp;
-	macros[time.getIdentifier()] = time;
-	macros[user.getIdentifier()] = user;
-	macros[incl.getIdentifier()] = incl;
+	registry[cntr.getIdentifier()] = cntr;
+	registry[date.getIdentifier()] = date;
+	registry[eval.getIdentifier()] = eval;
+	registry[file.getIdentifier()] = file;
+	registry[host.getIdentifier()] = host;
+	registry[line.getIdentifier()] = line;
+	registry[quot.getIdentifier()] = quot;
+	registry[stmp.getIdentifier()] = stmp;
+	registry[time.getIdentifier()] = time;
+	registry[user.getIdentifier()] = user;
+	registry[incl.getIdentifier()] = incl;
+
+	return registry;
+}
+
+/**
+** @brief Get the registry of the option independent buildin macros.
+*/
+const MacroSet& BuildinMacro::getRegistry()
+{
+	static const MacroSet registry = createRegistry();
+	return registry;
+}
+
+/**
+** @brief Add all buildin macros to the given macro set.
+*/
+void BuildinMacro::addBuildinMacros( const Options& options, MacroSet& macros )
+{
+	TokenExpression  token;
+	TokenExpressions tokens;
+	const MacroSet&  registry = getRegistry();
+
+	for ( MacroSet::const_iterator it = registry.begin(); it != registry.end(); ++it ) {
+		macros[it->first] = it->second;
+	}
 
 	BuildinMacro  language( L"__SQTPP_LANGUAGE", MacroExpander::getInstance() );
 	const Options::LanguageInfo& languageInfo = options.getLanguageInfo();
@@ -78,42 +108,54 @@ class BuildinFile::BuildinFileExpander : public sqtpp::MacroExpander
 		assert( argumentValues.size() == 0 );
 
 		const File&    file      = processor.getCurrentFile();
-		const Options& options   = processor.getOptions();
-		const wchar_t  delimiter = (wchar_t)options.getStringDelimiter();
-		wstring        filePath  = file.getPath();
-		wstringstream  buffer;
+		const wstring& fileLiteral = file.getPathLiteral();
 
+		if ( fileLiteral.empty() ) {
+			file.setPathLiteral( quotePath( processor.getOptions(), file.getPath() ) );
+		}
+
+		TokenExpression token( TOK_STRING, processor.getContext(), file.getPathLiteral() );
 
-		buffer << delimiter;
+		result.push_back( token );
+	}
+
+private:
+	/// Create the string literal of the given file path.
+	static wstring quotePath( const Options& options, const wstring& filePath )
+	{
+		const wchar_t  delimiter = (wchar_t)options.getStringDelimiter();
+		wstring        buffer;
+
+		buffer.reserve( filePath.length() + 2 );
+		buffer += delimiter;
 
 		for ( wstring::const_iterator it = filePath.begin(); it != filePath.end(); ++it ) {
 			wchar_t ch = *it;
 			if ( ch == delimiter ) {
 				if ( options.doubleQuoteEscaping() ) {
-					buffer << ch << ch;
+					buffer += ch;
+					buffer += ch;
 				} else {
-					buffer << L'\\' << ch;
+					buffer += L'\\';
+					buffer += ch;
 				}
 			} else if ( ch == L'\\' ) {
 				if ( options.doubleQuoteEscaping() ) {
 					// SQL Mode: just insert backslash.
-					buffer << ch;
+					buffer += ch;
 				} else {
 					// C Mode: insert backslash escaped.
-					buffer << ch << ch;
+					buffer += ch;
+					buffer += ch;
 				}
 			} else {
-				buffer << ch;
+				buffer += ch;
 			}
 		}
 
-		buffer << delimiter;
+		buffer += delimiter;
 
-		filePath = buffer.str();
-
-		TokenExpression token( TOK_STRING, processor.getContext(), filePath );
-
-		result.push_back( token );
+		return buffer;
 	}
 };
 
@@ -167,20 +209,8 @@ class BuildinDate::BuildinDateExpander : public sqtpp::MacroExpander
 		assert( argumentValues.size() == 0 );
 
 		const Options& options    = processor.getOptions();
-		const wstring  sFormat    = options.getDateFormat();
-		wchar_t        wcBuffer[128];
-		tm             localTime;
-
-		processor.getTimestamp( localTime );
+		const wstring& sDate      = processor.formatTimestamp( options.getDateFormat() );
 
-
-		// Convert date to string.
-		size_t length = wcsftime( wcBuffer, sizeof(wcBuffer) / sizeof( wchar_t ), sFormat.c_str(), &localTime );
-		if ( length == 0 ) {
-			throw RuntimeError( "The time format is to long." );
-		}
-
-		wstring sDate( wcBuffer, length );
 		TokenExpression token( TOK_STRING, processor.getContext(), sDate );
 
 		result.push_back( token );
@@ -208,19 +238,8 @@ class BuildinTime::BuildinTimeExpander : public sqtpp::MacroExpander
 		assert( argumentValues.size() == 0 );
 
 		const Options& options    = processor.getOptions();
-		const wstring  sFormat    = options.getTimeFormat();
-		wchar_t        wcBuffer[128];
-		tm             localTime;
+		const wstring& sTime      = processor.formatTimestamp( options.getTimeFormat() );
 
-		processor.getTimestamp( localTime );
-
-		// Convert date to string.
-		size_t length = wcsftime( wcBuffer, sizeof(wcBuffer) / sizeof( wchar_t ), sFormat.c_str(), &localTime );
-		if ( length == 0 ) {
-			throw RuntimeError( "The time format is to long." );
-		}
-
-		wstring sTime( wcBuffer, length );
 		TokenExpression token( TOK_STRING, processor.getContext(), sTime );
 
 		result.push_back( token );
@@ -248,19 +267,8 @@ class BuildinTimestamp::BuildinTimestampExpander : public sqtpp::MacroExpander
 		assert( argumentValues.size() == 0 );
 
 		const Options& options    = processor.getOptions();
-		const wstring  sFormat    = options.getTimestampFormat();
-		wchar_t        wcBuffer[128];
-		tm             localTime;
-
-		processor.getTimestamp( localTime );
-
-		// Convert date to string.
-		size_t length = wcsftime( wcBuffer, sizeof(wcBuffer) / sizeof( wchar_t ), sFormat.c_str(), &localTime );
-		if ( length == 0 ) {
-			throw RuntimeError( "The time format is to long." );
-		}
+		const wstring& sTimestamp = processor.formatTimestamp( options.getTimestampFormat() );
 
-		wstring sTimestamp( wcBuffer, length );
 		TokenExpression token( TOK_STRING, processor.getContext(), sTimestamp );
 
 		result.push_back( token );
@@ -522,7 +530,7 @@ public:
 		const Options& options     = processor.getOptions();
 		const wchar_t  delimiter   = (wchar_t)options.getStringDelimiter();
 		const wchar_t  escape      = options.getStringQuoting() == Options::QUOT_DOUBLE ? delimiter : L'\\';
-		wstring resultString       = result.stringize( delimiter, escape );
+		wstring resultString       = result.stringize( delimiter, escape, options.collapseBlanks() );
 
 		result.clear();
 		result.push_back( TokenExpression( TOK_STRING, CTX_DEFAULT, resultString ) );
@@ -29,6 +29,11 @@ protected:
 	BuildinMacro( const wchar_t* identifier, MacroExpander& macroExpander  );
 public:
 	static void addBuildinMacros( const Options& options, MacroSet& macros );
+private:
+	// Get the (immutable) registry of all option independent buildin macros.
+	static const MacroSet& getRegistry();
+	// Create the registry of all option independent buildin macros.
+	static MacroSet createRegistry();
 };
 
 /**
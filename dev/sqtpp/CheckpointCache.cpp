@@ -0,0 +1,588 @@
+#include "stdafx.h"
+#include <sys/types.h>
+#include <sys/stat.h>
+#include "Options.h"
+#include "Util.h"
+#include "CheckpointCache.h"
+
+namespace sqtpp {
+
+namespace {
+
+/// The first line of the cache file.
+const wchar_t* const CACHE_HEADER = L"sqtpp checkpoints 2";
+
+/**
+** @brief Write a field escaping backslashes, tabs and line feeds.
+*/
+void writeField( std::wostream& output, const std::wstring& sText )
+{
+	output << L'\t';
+	for ( wstring::const_iterator it = sText.begin(); it != sText.end(); ++it ) {
+		switch ( *it ) {
+			case L'\\':
+				output << L"\\\\";
+				break;
+			case L'\t':
+				output << L"\\t";
+				break;
+			case L'\r':
+				output << L"\\r";
+				break;
+			case L'\n':
+				output << L"\\n";
+				break;
+			default:
+				output << *it;
+				break;
+		}
+	}
+}
+
+/**
+** @brief Parse a decimal number (0 if the text is not a number).
+*/
+unsigned long long parseNumber( const std::wstring& sText )
+{
+	unsigned long long nNumber = 0;
+	for ( wstring::const_iterator it = sText.begin(); it != sText.end(); ++it ) {
+		if ( *it < L'0' || *it > L'9' ) {
+			return 0;
+		}
+		nNumber = nNumber * 10 + ( *it - L'0' );
+	}
+	return nNumber;
+}
+
+/**
+** @brief Parse a hash value written by Util::writeHash.
+*/
+unsigned long long parseHash( const std::wstring& sText )
+{
+	unsigned long long nHash = 0;
+	for ( wstring::const_iterator it = sText.begin(); it != sText.end(); ++it ) {
+		const wchar_t wc = *it;
+		unsigned int  nDigit;
+		if ( wc >= L'0' && wc <= L'9' ) {
+			nDigit = wc - L'0';
+		} else if ( wc >= L'a' && wc <= L'f' ) {
+			nDigit = wc - L'a' + 10;
+		} else {
+			return 0;
+		}
+		nHash = ( nHash << 4 ) | nDigit;
+	}
+	return nHash;
+}
+
+/**
+** @brief Add a text terminated by a line feed to a hash value.
+*/
+void hashField( unsigned long long& nHash, const std::wstring& sText )
+{
+	nHash = Util::hashText( nHash, sText.data(), sText.length() );
+	nHash = Util::hashText( nHash, L"\n", 1 );
+}
+
+/**
+** @brief Add a number terminated by a line feed to a hash value.
+*/
+void hashField( unsigned long long& nHash, unsigned long long nNumber )
+{
+	std::wstringstream buffer;
+	Util::writeNumber( buffer, nNumber );
+	hashField( nHash, buffer.str() );
+}
+
+} // namespace
+
+
+/**
+** @brief Constructor.
+*/
+CheckpointCache::Checkpoint::Checkpoint()
+: nLineCount( 0 )
+, nPrefixHash( Util::HASH_OFFSET_BASIS )
+, bHashed( false )
+, nPosition( 0 )
+, nLine( 1 )
+, nCounter( 0 )
+, nOutputLineCount( 0 )
+, nOutputLineNumber( 0 )
+{
+}
+
+/**
+** @brief Constructor.
+**
+** @param sRootPath The full path of the root file.
+** @param nOptionsHash The hash value of the options (see #hashOptions).
+*/
+CheckpointCache::CheckpointCache( const std::wstring& sRootPath, unsigned long long nOptionsHash )
+: m_sRootPath( sRootPath )
+, m_nOptionsHash( nOptionsHash )
+{
+}
+
+/**
+** @brief Get the hash value of the options which affect the checkpoints.
+**
+** These are the options changing the macros, the conditional blocks or
+** the files included and the options changing the line feeds written
+** for the lines preceding the output range. The output range itself
+** is not part of the hash value.
+*/
+unsigned long long CheckpointCache::hashOptions( const Options& options )
+{
+	unsigned long long nHash = Util::HASH_OFFSET_BASIS;
+
+	hashField( nHash, options.getLanguage() );
+	hashField( nHash, options.getInputCodePage() );
+	hashField( nHash, options.getStringQuoting() );
+	hashField( nHash, options.getStringDelimiter() );
+	hashField( nHash, options.getNewLineOutput() );
+	hashField( nHash, options.undefAllBuildin() );
+	hashField( nHash, options.keepBlockComments() );
+	hashField( nHash, options.keepLineComments() );
+	hashField( nHash, options.keepSqlComments() );
+	hashField( nHash, options.multiLineMacroExpansion() );
+	hashField( nHash, options.multiLineStringLiterals() );
+	hashField( nHash, options.expandMacroArguments() );
+	hashField( nHash, options.supportAdSalesNG() );
+	hashField( nHash, options.eliminateEmptyLines() );
+	// The tokens of the macros are stored by their numbers.
+	hashField( nHash, TOK_END_OF_FILE );
+
+	const StringArray& includeDirectories = options.getIncludeDirectories();
+	hashField( nHash, includeDirectories.size() );
+	for ( StringArray::const_iterator it = includeDirectories.begin(); it != includeDirectories.end(); ++it ) {
+		hashField( nHash, *it );
+	}
+	const StringArray& undefines = options.getUndefines();
+	hashField( nHash, undefines.size() );
+	for ( StringArray::const_iterator it = undefines.begin(); it != undefines.end(); ++it ) {
+		hashField( nHash, *it );
+	}
+	const StringDictionary& defines = options.getDefines();
+	hashField( nHash, defines.size() );
+	for ( StringDictionary::const_iterator it = defines.begin(); it != defines.end(); ++it ) {
+		hashField( nHash, it->first );
+		hashField( nHash, it->second );
+	}
+	return nHash;
+}
+
+/**
+** @brief Get the size and the modification time of a file.
+**
+** @returns (-1, -1) if the file doesn't exist.
+*/
+CheckpointCache::FileStamp CheckpointCache::getFileStamp( const std::wstring& sFilePath )
+{
+	struct _stat64 fileInfo;
+	memset( &fileInfo, 0, sizeof( fileInfo ) );
+
+	if ( _wstat64( sFilePath.c_str(), &fileInfo ) != 0 ) {
+		return FileStamp( -1, -1 );
+	}
+	return FileStamp( (long long)fileInfo.st_size, (long long)fileInfo.st_mtime );
+}
+
+/**
+** @brief Compute the hash values of the lines of the root file.
+**
+** A line ends with a line feed, a carriage return or both (as for the
+** scanner). The line breaks are hashed as they are found. The prefix 
+** hashes are used by #find and #updateHashes.
+**
+** @param sText The text of the root file.
+*/
+void CheckpointCache::setRootText( const std::wstring& sText )
+{
+	const wchar_t* const pwcText = sText.data();
+	const size_t         nLength = sText.length();
+	unsigned long long   nHash   = Util::HASH_OFFSET_BASIS;
+	size_t               nStart  = 0;
+
+	m_lineHashes.assign( 1, nHash );
+	m_lineOffsets.assign( 1, 0 );
+	for ( size_t nOffset = 0; nOffset < nLength; ++nOffset ) {
+		const wchar_t wc = pwcText[nOffset];
+		if ( wc != L'\r' && wc != L'\n' ) {
+			continue;
+		}
+		if ( wc == L'\r' && nOffset + 1 < nLength && pwcText[nOffset + 1] == L'\n' ) {
+			++nOffset;
+		}
+		nHash  = Util::hashText( nHash, pwcText + nStart, nOffset + 1 - nStart );
+		nStart = nOffset + 1;
+		m_lineHashes.push_back( nHash );
+		m_lineOffsets.push_back( nStart );
+	}
+}
+
+/**
+** @brief Get the offset of a line of the root file text.
+**
+** @param nLineCount The number of line breaks preceding the line.
+*/
+size_t CheckpointCache::getLineOffset( size_t nLineCount ) const
+{
+	assert( nLineCount < m_lineOffsets.size() );
+	return m_lineOffsets[nLineCount];
+}
+
+/**
+** @brief Split a line of the cache file into its fields.
+**
+** The escape sequences are replaced by the characters escaped.
+*/
+void CheckpointCache::splitFields( const std::wstring& sLine, StringArray& fields )
+{
+	fields.clear();
+	fields.push_back( wstring() );
+	for ( wstring::const_iterator it = sLine.begin(); it != sLine.end(); ++it ) {
+		wchar_t wc = *it;
+		if ( wc == L'\t' ) {
+			fields.push_back( wstring() );
+			continue;
+		}
+		if ( wc == L'\\' && it + 1 != sLine.end() ) {
+			++it;
+			switch ( *it ) {
+				case L't':
+					wc = L'\t';
+					break;
+				case L'r':
+					wc = L'\r';
+					break;
+				case L'n':
+					wc = L'\n';
+					break;
+				default:
+					wc = *it;
+					break;
+			}
+		}
+		fields.back()+= wc;
+	}
+}
+
+/**
+** @brief Read the cache written by a previous run.
+**
+** The cache is ignored if it has been written for other options or
+** another root file or if it is malformed.
+**
+** @returns true if the cache has been read.
+*/
+bool CheckpointCache::read( std::wistream& input )
+{
+	wstring          sLine;
+	StringArray      fields;
+	Checkpoint*      pCheckpoint = NULL;
+	TokenExpressions tokens;
+
+	m_includeFiles.clear();
+	m_checkpoints.clear();
+
+	std::getline( input, sLine );
+	if ( sLine != CACHE_HEADER ) {
+		return false;
+	}
+	std::getline( input, sLine );
+	splitFields( sLine, fields );
+	if ( fields.size() != 3 || fields[0] != L"K" || parseHash( fields[1] ) != m_nOptionsHash || fields[2] != m_sRootPath ) {
+		return false;
+	}
+
+	while ( std::getline( input, sLine ) ) {
+		splitFields( sLine, fields );
+		const wstring& sType = fields[0];
+
+		if ( sType == L"I" && fields.size() == 4 ) {
+			FileStamp& stamp = m_includeFiles[fields[3]];
+			stamp.first  = (long long)parseNumber( fields[1] );
+			stamp.second = (long long)parseNumber( fields[2] );
+		} else if ( sType == L"C" && fields.size() == 9 && tokens.empty() ) {
+			const size_t nLineCount = size_t( parseNumber( fields[1] ) );
+			pCheckpoint = &m_checkpoints[nLineCount];
+			pCheckpoint->nLineCount        = nLineCount;
+			pCheckpoint->nPrefixHash       = parseHash( fields[2] );
+			pCheckpoint->bHashed           = true;
+			pCheckpoint->nPosition         = size_t( parseNumber( fields[3] ) );
+			pCheckpoint->nLine             = size_t( parseNumber( fields[4] ) );
+			pCheckpoint->nCounter          = int( parseNumber( fields[5] ) );
+			pCheckpoint->nOutputLineCount  = size_t( parseNumber( fields[6] ) );
+			pCheckpoint->nOutputLineNumber = size_t( parseNumber( fields[7] ) );
+			pCheckpoint->sNewLine          = fields[8];
+		} else if ( pCheckpoint == NULL ) {
+			m_includeFiles.clear();
+			m_checkpoints.clear();
+			return false;
+		} else if ( sType == L"T" && ( fields.size() == 4 || fields.size() == 5 ) && parseNumber( fields[1] ) <= TOK_END_OF_FILE && parseNumber( fields[2] ) <= CTX_CONDITIONAL_DONE ) {
+			const Token   token   = Token( parseNumber( fields[1] ) );
+			const Context context = Context( parseNumber( fields[2] ) );
+			tokens.push_back( TokenExpression( token, context, fields[3], fields.back() ) );
+		} else if ( sType == L"M" && fields.size() >= 6 ) {
+			Macro macro( fields[1], fields[2], size_t( parseNumber( fields[3] ) ) );
+			if ( fields[5] == L"1" ) {
+				MacroArguments arguments;
+				for ( size_t nField = 6; nField < fields.size(); ++nField ) {
+					arguments.push_back( MacroArgument( fields[nField] ) );
+				}
+				macro.setArguments( arguments );
+			}
+			macro.setExpression( tokens, fields[4] );
+			tokens.clear();
+			pCheckpoint->macros.push_back( macro );
+		} else if ( sType == L"U" && fields.size() == 2 ) {
+			pCheckpoint->undefinedMacros.push_back( fields[1] );
+		} else if ( sType == L"O" && fields.size() == 2 ) {
+			pCheckpoint->includeOnceFiles.insert( fields[1] );
+		} else if ( sType == L"G" && fields.size() == 3 ) {
+			pCheckpoint->includeGuards[fields[1]] = fields[2];
+		} else if ( sType == L"H" && fields.size() == 3 ) {
+			pCheckpoint->guardedIncludes[fields[1]] = fields[2];
+		} else if ( sType == L"L" && fields.size() == 3 ) {
+			pCheckpoint->conditionals.push_back( Location( fields[1], size_t( parseNumber( fields[2] ) ) ) );
+		} else {
+			m_includeFiles.clear();
+			m_checkpoints.clear();
+			return false;
+		}
+	}
+	if ( !tokens.empty() ) {
+		m_includeFiles.clear();
+		m_checkpoints.clear();
+		return false;
+	}
+	return true;
+}
+
+/**
+** @brief Discard all checkpoints if an include file has been modified.
+**
+** @returns false if the checkpoints have been discarded.
+*/
+bool CheckpointCache::checkIncludeFiles()
+{
+	for ( FileStampMap::const_iterator it = m_includeFiles.begin(); it != m_includeFiles.end(); ++it ) {
+		if ( getFileStamp( it->first ) != it->second ) {
+			m_includeFiles.clear();
+			m_checkpoints.clear();
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+** @brief Write the cache.
+*/
+void CheckpointCache::write( std::wostream& output ) const
+{
+	output << CACHE_HEADER << L'\n';
+	output << L"K\t";
+	Util::writeHash( output, m_nOptionsHash );
+	writeField( output, m_sRootPath );
+	output << L'\n';
+
+	for ( FileStampMap::const_iterator it = m_includeFiles.begin(); it != m_includeFiles.end(); ++it ) {
+		output << L"I\t";
+		Util::writeNumber( output, it->second.first );
+		output << L'\t';
+		Util::writeNumber( output, it->second.second );
+		writeField( output, it->first );
+		output << L'\n';
+	}
+
+	for ( CheckpointMap::const_iterator it = m_checkpoints.begin(); it != m_checkpoints.end(); ++it ) {
+		const Checkpoint& checkpoint = it->second;
+		if ( !checkpoint.bHashed ) {
+			continue;
+		}
+
+		output << L"C\t";
+		Util::writeNumber( output, checkpoint.nLineCount );
+		output << L'\t';
+		Util::writeHash( output, checkpoint.nPrefixHash );
+		output << L'\t';
+		Util::writeNumber( output, checkpoint.nPosition );
+		output << L'\t';
+		Util::writeNumber( output, checkpoint.nLine );
+		output << L'\t';
+		Util::writeNumber( output, checkpoint.nCounter );
+		output << L'\t';
+		Util::writeNumber( output, checkpoint.nOutputLineCount );
+		output << L'\t';
+		Util::writeNumber( output, checkpoint.nOutputLineNumber );
+		writeField( output, checkpoint.sNewLine );
+		output << L'\n';
+
+		for ( MacroArray::const_iterator itMacro = checkpoint.macros.begin(); itMacro != checkpoint.macros.end(); ++itMacro ) {
+			const TokenExpressions& tokens = itMacro->getTokens();
+			for ( TokenExpressions::const_iterator itToken = tokens.begin(); itToken != tokens.end(); ++itToken ) {
+				output << L"T\t";
+				Util::writeNumber( output, itToken->getToken() );
+				output << L'\t';
+				Util::writeNumber( output, itToken->getContext() );
+				writeField( output, itToken->getText() );
+				if ( itToken->getIdentifier() != itToken->getText() ) {
+					writeField( output, itToken->getIdentifier() );
+				}
+				output << L'\n';
+			}
+			output << L'M';
+			writeField( output, itMacro->getIdentifier() );
+			writeField( output, itMacro->getDefineFile() );
+			output << L'\t';
+			Util::writeNumber( output, itMacro->getDefineLine() );
+			writeField( output, itMacro->getDefineText() );
+			output << ( itMacro->hasArguments() ? L"\t1" : L"\t0" );
+			const MacroArguments& arguments = itMacro->getArguments();
+			for ( MacroArguments::const_iterator itArgument = arguments.begin(); itArgument != arguments.end(); ++itArgument ) {
+				writeField( output, itArgument->getIdentifier() );
+			}
+			output << L'\n';
+		}
+		for ( StringArray::const_iterator itUndefined = checkpoint.undefinedMacros.begin(); itUndefined != checkpoint.undefinedMacros.end(); ++itUndefined ) {
+			output << L'U';
+			writeField( output, *itUndefined );
+			output << L'\n';
+		}
+		for ( StringSet::const_iterator itFile = checkpoint.includeOnceFiles.begin(); itFile != checkpoint.includeOnceFiles.end(); ++itFile ) {
+			output << L'O';
+			writeField( output, *itFile );
+			output << L'\n';
+		}
+		for ( StringDictionary::const_iterator itGuard = checkpoint.includeGuards.begin(); itGuard != checkpoint.includeGuards.end(); ++itGuard ) {
+			output << L'G';
+			writeField( output, itGuard->first );
+			writeField( output, itGuard->second );
+			output << L'\n';
+		}
+		for ( StringDictionary::const_iterator itGuarded = checkpoint.guardedIncludes.begin(); itGuarded != checkpoint.guardedIncludes.end(); ++itGuarded ) {
+			output << L'H';
+			writeField( output, itGuarded->first );
+			writeField( output, itGuarded->second );
+			output << L'\n';
+		}
+		for ( LocationArray::const_iterator itLocation = checkpoint.conditionals.begin(); itLocation != checkpoint.conditionals.end(); ++itLocation ) {
+			output << L'L';
+			writeField( output, itLocation->getFile() );
+			output << L'\t';
+			Util::writeNumber( output, itLocation->getLine() );
+			output << L'\n';
+		}
+	}
+}
+
+/**
+** @brief Record an include file processed.
+**
+** The size and the modification time of the file are taken when the
+** file is added for the first time.
+*/
+void CheckpointCache::addIncludeFile( const std::wstring& sFilePath )
+{
+	if ( m_includeFiles.find( sFilePath ) == m_includeFiles.end() ) {
+		m_includeFiles[sFilePath] = getFileStamp( sFilePath );
+	}
+}
+
+/**
+** @brief Add a checkpoint.
+**
+** A checkpoint at the same line is replaced. Otherwise the checkpoints
+** following the new one are removed because their macro changes are
+** relative to the checkpoints preceding them. The prefix hash of the 
+** new checkpoint is computed by #updateHashes.
+**
+** @param nLineCount The number of line breaks of the root file preceding the checkpoint.
+** @returns The checkpoint to be filled by the caller.
+*/
+CheckpointCache::Checkpoint& CheckpointCache::addCheckpoint( size_t nLineCount )
+{
+	if ( m_checkpoints.find( nLineCount ) == m_checkpoints.end() ) {
+		m_checkpoints.erase( m_checkpoints.upper_bound( nLineCount ), m_checkpoints.end() );
+	}
+	Checkpoint& checkpoint = m_checkpoints[nLineCount];
+	checkpoint = Checkpoint();
+	checkpoint.nLineCount = nLineCount;
+	return checkpoint;
+}
+
+/**
+** @brief Find the last valid checkpoint at or before a position of the root file.
+**
+** The checkpoints are verified in ascending order. The first one whose
+** prefix hash doesn't match the current text ends the search because
+** all following checkpoints depend on the modified text too.
+**
+** @param nPosition The position the processing should be resumed at the latest.
+** @returns NULL if there isn't any valid checkpoint.
+*/
+const CheckpointCache::Checkpoint* CheckpointCache::find( size_t nPosition ) const
+{
+	const Checkpoint* pFound = NULL;
+
+	for ( CheckpointMap::const_iterator it = m_checkpoints.begin(); it != m_checkpoints.end(); ++it ) {
+		const Checkpoint& checkpoint = it->second;
+		if ( checkpoint.nPosition > nPosition ) {
+			break;
+		}
+		if ( checkpoint.nLineCount >= m_lineHashes.size() || m_lineHashes[checkpoint.nLineCount] != checkpoint.nPrefixHash ) {
+			break;
+		}
+		pFound = &checkpoint;
+	}
+	return pFound;
+}
+
+/**
+** @brief Apply the changes of the macros recorded up to a checkpoint.
+**
+** @param checkpoint The checkpoint restored (see #find).
+** @param macros The macros defined by the options. Receives the macros 
+**        defined at the checkpoint.
+** @param nMacroVersion The last version number assigned to a macro. The
+**        macros restored get new version numbers.
+*/
+void CheckpointCache::restoreMacros( const Checkpoint& checkpoint, MacroSet& macros, size_t& nMacroVersion ) const
+{
+	for ( CheckpointMap::const_iterator it = m_checkpoints.begin(); it != m_checkpoints.end() && it->first <= checkpoint.nLineCount; ++it ) {
+		const Checkpoint& changes = it->second;
+		for ( StringArray::const_iterator itUndefined = changes.undefinedMacros.begin(); itUndefined != changes.undefinedMacros.end(); ++itUndefined ) {
+			macros.erase( *itUndefined );
+		}
+		for ( MacroArray::const_iterator itMacro = changes.macros.begin(); itMacro != changes.macros.end(); ++itMacro ) {
+			Macro& macro = macros[itMacro->getIdentifier()];
+			macro = *itMacro;
+			macro.setVersion( ++nMacroVersion );
+		}
+	}
+}
+
+/**
+** @brief Compute the prefix hashes and remove the checkpoints which are no longer valid.
+**
+** The first checkpoint read from the cache file which doesn't match the
+** current text of the root file (see #setRootText) and all checkpoints
+** following it are removed. The hashes of the checkpoints added are set.
+*/
+void CheckpointCache::updateHashes()
+{
+	CheckpointMap::iterator it = m_checkpoints.begin();
+	for ( ; it != m_checkpoints.end(); ++it ) {
+		Checkpoint& checkpoint = it->second;
+		if ( checkpoint.nLineCount >= m_lineHashes.size() || ( checkpoint.bHashed && checkpoint.nPrefixHash != m_lineHashes[checkpoint.nLineCount] ) ) {
+			break;
+		}
+		checkpoint.nPrefixHash = m_lineHashes[checkpoint.nLineCount];
+		checkpoint.bHashed     = true;
+	}
+	m_checkpoints.erase( it, m_checkpoints.end() );
+}
+
+} // namespace sqtpp
@@ -0,0 +1,184 @@
+/**
+** @file
+** @author Ralf Seidel
+** @brief Declaration of the #sqtpp::CheckpointCache.
+**
+**  2010 by SQL Service GmbH Wuppertal
+*/
+#ifndef SQTPP_CHECKPOINT_CACHE_H
+#define SQTPP_CHECKPOINT_CACHE_H
+#if _MSC_VER > 10
+#pragma once
+#endif
+#include "Location.h"
+#include "Macro.h"
+
+namespace sqtpp {
+
+class Options;
+
+/**
+** @brief Snapshots of the processor state at line boundaries of the root file.
+**
+** If the output is restricted to a range of the root file everything
+** preceding the range is processed for the macro definitions, the
+** conditional blocks and the files included only. The cache stores the
+** state reached at some line boundaries on the way. A later run restores
+** the last checkpoint preceding its output range instead of starting
+** with the first line.
+**
+** A checkpoint is valid as long as the text of the root file preceding it
+** is unchanged. So each checkpoint records the hash value of this text
+** and an edit below a checkpoint keeps the checkpoint valid. The cache as
+** a whole is valid for the options and the root file it has been created
+** for and as long as none of the include files has been modified (their
+** size and time of the last modification are recorded).
+**
+** The cache is stored as a text file:
+** @code
+** sqtpp checkpoints 2
+** K <tab> options hash <tab> root file
+** I <tab> size <tab> modification time <tab> include file
+** C <tab> line breaks <tab> prefix hash <tab> position <tab> line <tab> counter <tab> output lines <tab> output line number <tab> new line
+** T <tab> token <tab> context <tab> text [<tab> identifier (if it differs from the text)]
+** M <tab> identifier <tab> file <tab> line <tab> definition <tab> argument list flag [<tab> argument]...
+** U <tab> identifier
+** O <tab> file included once
+** G <tab> file <tab> guard macro
+** H <tab> include request <tab> guarded file
+** L <tab> file <tab> line of an open conditional directive
+** @endcode
+** The lines following a C line belong to the checkpoint. Backslashes,
+** tabs and line feeds within the fields are escaped by a backslash.
+**
+** The macros are recorded as changes: The M and U lines of a checkpoint
+** are the macros (re)defined and undefined since the previous checkpoint
+** (the first checkpoint: since the macros defined by the options). The 
+** T lines preceding an M line are the tokens of the macro expression.
+*/
+class CheckpointCache
+{
+public:
+	/// Array of macros.
+	typedef std::vector<Macro>           MacroArray;
+
+	/// Array of the locations of the open conditional directives (bottom first).
+	typedef std::vector<Location>        LocationArray;
+
+	/// The processor state at a line boundary of the root file.
+	struct Checkpoint
+	{
+		/// The number of line breaks of the root file preceding the checkpoint.
+		size_t               nLineCount;
+		/// The hash value of the root file text preceding the checkpoint.
+		unsigned long long   nPrefixHash;
+		/// Flag indicating if #nPrefixHash has been computed.
+		bool                 bHashed;
+		/// The position in the root file (as counted by the processor).
+		size_t               nPosition;
+		/// The line number of the root file (may differ from the line breaks after \#line).
+		size_t               nLine;
+		/// The next value of the __COUNTER__ macro.
+		int                  nCounter;
+		/// The new line characters of the root file.
+		std::wstring         sNewLine;
+		/// The number of line feeds written to the output.
+		size_t               nOutputLineCount;
+		/// The output line number (for the \#line directives).
+		size_t               nOutputLineNumber;
+		/// The macros (re)defined since the previous checkpoint.
+		MacroArray           macros;
+		/// The identifiers of the macros undefined since the previous checkpoint.
+		StringArray          undefinedMacros;
+		/// Files that should be included only once.
+		StringSet            includeOnceFiles;
+		/// Include guard macros by full path.
+		StringDictionary     includeGuards;
+		/// Full paths of guarded files by include request.
+		StringDictionary     guardedIncludes;
+		/// The open conditional directives.
+		LocationArray        conditionals;
+
+		// Constructor.
+		Checkpoint();
+	};
+
+private:
+	/// Size and modification time of an include file.
+	typedef std::pair<long long, long long>       FileStamp;
+
+	/// Stamps of the include files by full path.
+	typedef std::map<std::wstring, FileStamp>     FileStampMap;
+
+	/// Checkpoints by the number of preceding line breaks.
+	typedef std::map<size_t, Checkpoint>          CheckpointMap;
+
+	/// The full path of the root file.
+	std::wstring  m_sRootPath;
+
+	/// The hash value of the options the checkpoints depend on.
+	unsigned long long m_nOptionsHash;
+
+	/// The include files processed.
+	FileStampMap  m_includeFiles;
+
+	/// The checkpoints.
+	CheckpointMap m_checkpoints;
+
+	/// The hash values of the root file text preceding each line break (by the number of line breaks).
+	std::vector<unsigned long long> m_lineHashes;
+
+	/// The offsets of the lines of the root file text (by the number of preceding line breaks).
+	std::vector<size_t> m_lineOffsets;
+
+private:
+	// Get the size and the modification time of a file.
+	static FileStamp getFileStamp( const std::wstring& sFilePath );
+
+	// Split a line of the cache file into its fields.
+	static void splitFields( const std::wstring& sLine, StringArray& fields );
+
+public:
+	// Constructor.
+	CheckpointCache( const std::wstring& sRootPath, unsigned long long nOptionsHash );
+
+	// Get the hash value of the options which affect the checkpoints.
+	static unsigned long long hashOptions( const Options& options );
+
+	/// Get the number of checkpoints.
+	size_t getCheckpointCount() const throw() { return m_checkpoints.size(); }
+
+	// Read the cache written by a previous run.
+	bool read( std::wistream& input );
+
+	// Compute the hash values of the lines of the root file.
+	void setRootText( const std::wstring& sText );
+
+	// Get the offset of a line of the root file text.
+	size_t getLineOffset( size_t nLineCount ) const;
+
+	// Discard all checkpoints if an include file has been modified.
+	bool checkIncludeFiles();
+
+	// Write the cache.
+	void write( std::wostream& output ) const;
+
+	// Record an include file processed.
+	void addIncludeFile( const std::wstring& sFilePath );
+
+	// Add a checkpoint (replacing one at the same line).
+	Checkpoint& addCheckpoint( size_t nLineCount );
+
+	// Find the last valid checkpoint at or before a position of the root file.
+	const Checkpoint* find( size_t nPosition ) const;
+
+	// Apply the changes of the macros recorded up to a checkpoint.
+	void restoreMacros( const Checkpoint& checkpoint, MacroSet& macros, size_t& nMacroVersion ) const;
+
+	// Compute the prefix hashes and remove the checkpoints which are no longer valid.
+	void updateHashes();
+};
+
+} // namespace sqtpp
+
+#endif // SQTPP_CHECKPOINT_CACHE_H
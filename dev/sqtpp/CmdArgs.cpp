@@ -18,6 +18,7 @@ CmdArgs::CmdArgs( int argc, const wchar_t* const argv[] )
 : m_argc( argc )
 , m_argv( argv )
 , m_bIgnoreMissingArgs( false )
+, m_bDefaultManifestFile( false )
 {
 }
 
@@ -76,11 +77,20 @@ void CmdArgs::usage()
 	wcout << L"                " << L"The default settings depends on the language setting." << endl;
 	wcout << L"                " << L"For SQL the default is single quotes." << endl;
 	wcout << L"-TLanguage      " << L"Set input language." << endl;
+	wcout << L"-b[Sep[,Sep]]   " << L"Write the output as length prefixed frames, one for each batch." << endl;
+	wcout << L"                " << L"The batches are separated by lines with one of the separators (default GO)." << endl;
+	wcout << L"-h[Filepath]    " << L"Write a manifest with the hash value of each batch. The default path" << endl;
+	wcout << L"                " << L"is the path of the output file followed by .manifest." << endl;
 	wcout << L"-e[+|-]         " << L"Option to eliminate empty lines in the output (+)." << endl;
 	wcout << L"-c[b|l|s][+|-]  " << L"Option to keep the comments in the output (+) or to eliminate them (-)." << endl;
 	wcout << L"                " << L"With the optional specifier b, l and s the elimination can be." << endl;
 	wcout << L"                " << L"switched on or off for (b)lock, (l)ine or (s)ql comments." << endl;
+	wcout << L"-m              " << L"Minify the output: Remove comments (except optimizer hints), empty lines," << endl;
+	wcout << L"                " << L"#line directives and redundant blanks." << endl;
+	wcout << L"-pFilepath      " << L"Cache checkpoints of the input file in the file. With an output range" << endl;
+	wcout << L"                " << L"the processing resumes at the last checkpoint preceding the range." << endl;
 	wcout << L"-rFrom-To       " << L"Option to restrict the output to the specified range in the input file." << endl;
+	wcout << L"-sFilepath      " << L"Write a source map to the file instead of #line directives." << endl;
 	exit( 0 );
 }
 
@@ -96,6 +106,8 @@ void CmdArgs::parse( Options& options )
 {
 	int nextArg = 1;
 
+	m_bDefaultManifestFile = false;
+
 	while ( nextArg < m_argc ) {
 		const wchar_t* pszArgument = m_argv[nextArg];
 
@@ -135,12 +147,21 @@ void CmdArgs::parse( Options& options )
 				case L'V':
 					options.verbose( true );
 					break;
+				case L'b':
+					setBatchSeparators( options, &pszArgument[2] );
+					break;
 				case L'c':
 					setKeepComments( options, &pszArgument[2] );
 					break;
 				case L'e':
 					setEliminateEmptyLines( options, &pszArgument[2] );
 					break;
+				case L'h':
+					setManifestFile( options, &pszArgument[2] );
+					break;
+				case L'm':
+					options.minify();
+					break;
 				case L'i':
 					setInputFile( options, &pszArgument[2] );
 					break;
@@ -151,9 +172,15 @@ void CmdArgs::parse( Options& options )
 					setOutputFile( options, &pszArgument[2] );
 					options.writeErrorsToOutput( true );
 					break;
+				case L'p':
+					setCheckpointFile( options, &pszArgument[2] );
+					break;
 				case L'r':
 					setOutputRange( options, &pszArgument[2] );
 					break;
+				case L's':
+					setSourceMapFile( options, &pszArgument[2] );
+					break;
 				default:
 					// Invalid argument {1}.
 					error::D9002 warning( pszArgument );
@@ -178,6 +205,17 @@ void CmdArgs::parse( Options& options )
 
 		++nextArg;
 	}
+
+	// The output file may follow the -h option.
+	if ( m_bDefaultManifestFile ) {
+		if ( !options.getOutputFile().empty() ) {
+			options.setManifestFile( options.getOutputFile() + L".manifest" );
+		} else {
+			// {1} requires {2}; option ignored
+			error::D9007 warning( L"-h", L"[filename]");
+			wcerr << warning;
+		}
+	}
 }
 
 /**
@@ -473,6 +511,35 @@ void CmdArgs::setStringDelimiter( Options& options, const wchar_t* pwszArgument
 	}
 }
 
+/**
+** @brief /b[Separator[,Separator...]] Write the output as batch frames.
+**
+** The default separator is GO.
+*/
+void CmdArgs::setBatchSeparators( Options& options, const wchar_t* pwszArgument )
+{
+	StringArray separators;
+	const wchar_t* pwcStart = pwszArgument;
+
+	for ( const wchar_t* pwcNext = pwszArgument; ; ++pwcNext ) {
+		if ( *pwcNext == L',' || *pwcNext == L'\0' ) {
+			wstring separator = Util::trim( wstring( pwcStart, pwcNext ) );
+			if ( !separator.empty() ) {
+				separators.push_back( separator );
+			}
+			if ( *pwcNext == L'\0' ) {
+				break;
+			}
+			pwcStart = pwcNext + 1;
+		}
+	}
+	if ( !separators.empty() ) {
+		options.setBatchSeparators( separators );
+	}
+	options.frameBatches( true );
+}
+
+
 /**
 ** @brief /e[+|-] Eliminate empty lines in the ouput (on or off).
 ** 
@@ -520,6 +587,61 @@ void CmdArgs::setOutputFile( Options& options, const wchar_t* pwszArgument )
 }
 
 
+/**
+** @brief /h[Filepath] Set the path of the batch manifest file.
+**
+** The default is the path of the output file with the extension .manifest
+** appended. It is set when all arguments have been parsed (see #parse).
+*/
+void CmdArgs::setManifestFile( Options& options, const wchar_t* pwszArgument )
+{
+	if ( *pwszArgument != L'\0' ) {
+		options.setManifestFile( getFilePath( pwszArgument ) );
+		m_bDefaultManifestFile = false;
+	} else {
+		m_bDefaultManifestFile = true;
+	}
+}
+
+
+/**
+** @brief /s Set the path of the source map file.
+**
+** The source map replaces the \#line directives in the output.
+*/
+void CmdArgs::setSourceMapFile( Options& options, const wchar_t* pwszArgument )
+{
+	if ( *pwszArgument == L'\0' ) {
+		// {1} requires {2}; option ignored
+		error::D9007 warning( L"-s", L"[filename]");
+		wcerr << warning;
+		return;
+	}
+
+	wstring filePath = getFilePath( pwszArgument );
+	options.setSourceMapFile( filePath );
+}
+
+
+/**
+** @brief /p Set the path of the checkpoint cache file.
+**
+** The file is read before and written after the input file is processed.
+*/
+void CmdArgs::setCheckpointFile( Options& options, const wchar_t* pwszArgument )
+{
+	if ( *pwszArgument == L'\0' ) {
+		// {1} requires {2}; option ignored
+		error::D9007 warning( L"-p", L"[filename]");
+		wcerr << warning;
+		return;
+	}
+
+	wstring filePath = getFilePath( pwszArgument );
+	options.setCheckpointFile( filePath );
+}
+
+
 /**
 ** @brief /c[b|l|s][+|-] Option to emit the comments to the ouput (on or off).
 ** 
@@ -37,6 +37,9 @@ private:
 
 	/// Option for the tests of this class to ignore missing arguments
 	bool                        m_bIgnoreMissingArgs;
+
+	/// -h without a path found: The manifest path is derived from the output file.
+	bool                        m_bDefaultManifestFile;
 public:
 	// Constructor.
 	CmdArgs( int argc, const wchar_t* const argv[] );
@@ -91,6 +94,9 @@ private:
 	// Handle /X
 	void setExtraOptions( Options& options, const wchar_t* pwszArgument );
 
+	// Handle /b
+	void setBatchSeparators( Options& options, const wchar_t* pwszArgument );
+
 	// Handle /e
 	void setEliminateEmptyLines( Options& options, const wchar_t* pwszArgument );
 
@@ -103,6 +109,15 @@ private:
 	// Handle /r
 	void setOutputRange( Options& options, const wchar_t* pwszArgument );
 
+	// Handle /h
+	void setManifestFile( Options& options, const wchar_t* pwszArgument );
+
+	// Handle /s
+	void setSourceMapFile( Options& options, const wchar_t* pwszArgument );
+
+	// Handle /p
+	void setCheckpointFile( Options& options, const wchar_t* pwszArgument );
+
 	// Handle /k
 	void setKeepComments( Options& options, const wchar_t* pwszArgument );
 
@@ -9,11 +9,223 @@
 */
 #include "stdafx.h"
 #include <Windows.h>
+#include <algorithm>
+#include "CodePage.h"
 #include "CodePageConverter.h"
 #include "Exceptions.h"
 
+// Use SSE2 to process 16 ASCII characters at once (if wchar_t is a 16 bit type).
+#if ( defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 ) ) && WCHAR_MAX == 0xFFFF
+#define SQTPP_SSE2
+#include <emmintrin.h>
+#include <intrin.h>
+#endif
+
 namespace sqtpp {
 
+namespace {
+
+/// Characters of the code page 437 (OEM (US)).
+const wchar_t cp437Table[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+	0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+	0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+	0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+	0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+	0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+	0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7,
+	0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5,
+	0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9,
+	0x00FF, 0x00D6, 0x00DC, 0x00A2, 0x00A3, 0x00A5, 0x20A7, 0x0192,
+	0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA,
+	0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+	0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556,
+	0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+	0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F,
+	0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+	0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B,
+	0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+	0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4,
+	0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
+	0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248,
+	0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0
+};
+
+/// Characters of the code page 850 (OEM (Latin I)).
+const wchar_t cp850Table[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+	0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+	0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+	0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+	0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+	0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+	0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7,
+	0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5,
+	0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9,
+	0x00FF, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x00D7, 0x0192,
+	0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA,
+	0x00BF, 0x00AE, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+	0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x00C1, 0x00C2, 0x00C0,
+	0x00A9, 0x2563, 0x2551, 0x2557, 0x255D, 0x00A2, 0x00A5, 0x2510,
+	0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x00E3, 0x00C3,
+	0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4,
+	0x00F0, 0x00D0, 0x00CA, 0x00CB, 0x00C8, 0x0131, 0x00CD, 0x00CE,
+	0x00CF, 0x2518, 0x250C, 0x2588, 0x2584, 0x00A6, 0x00CC, 0x2580,
+	0x00D3, 0x00DF, 0x00D4, 0x00D2, 0x00F5, 0x00D5, 0x00B5, 0x00FE,
+	0x00DE, 0x00DA, 0x00DB, 0x00D9, 0x00FD, 0x00DD, 0x00AF, 0x00B4,
+	0x00AD, 0x00B1, 0x2017, 0x00BE, 0x00B6, 0x00A7, 0x00F7, 0x00B8,
+	0x00B0, 0x00A8, 0x00B7, 0x00B9, 0x00B3, 0x00B2, 0x25A0, 0x00A0
+};
+
+/// Characters of the code page 1252 (Windows 1252).
+const wchar_t cp1252Table[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+	0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+	0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+	0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+	0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+	0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+	0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+	0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+	0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+	0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178,
+	0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+	0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+	0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+	0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+	0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,
+	0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+	0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7,
+	0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+	0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+	0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+	0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+	0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF
+};
+
+/**
+** @brief Get the length of the run of 7 bit (ASCII) characters at the start of a byte sequence.
+*/
+size_t ascii_length( const char* pFrom, const char* pFromMax ) throw()
+{
+	const char* pNext = pFrom;
+
+#	ifdef SQTPP_SSE2
+	while ( pFromMax - pNext >= 16 ) {
+		const __m128i chunk = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pNext ) );
+		const int     mask  = _mm_movemask_epi8( chunk );
+		if ( mask != 0 ) {
+			unsigned long index;
+			_BitScanForward( &index, (unsigned long)mask );
+			return (pNext - pFrom) + index;
+		}
+		pNext+= 16;
+	}
+#	endif
+	while ( pNext < pFromMax && (unsigned char)*pNext < 0x80 ) {
+		++pNext;
+	}
+	return pNext - pFrom;
+}
+
+/**
+** @brief Copy a run of 7 bit (ASCII) characters into a wide character buffer.
+**
+** @returns The number of characters copied.
+*/
+size_t copy_ascii( const char* pFrom, const char* pFromMax, wchar_t* pTo, wchar_t* pToMax ) throw()
+{
+	const size_t fromLength = pFromMax - pFrom;
+	const size_t toLength   = pToMax - pTo;
+	const char*  pEnd       = pFrom + (fromLength < toLength ? fromLength : toLength);
+	const char*  pNext      = pFrom;
+	wchar_t*     pToNext    = pTo;
+
+#	ifdef SQTPP_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	while ( pEnd - pNext >= 16 ) {
+		const __m128i chunk = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pNext ) );
+		if ( _mm_movemask_epi8( chunk ) != 0 ) {
+			break;
+		}
+		_mm_storeu_si128( reinterpret_cast<__m128i*>( pToNext ), _mm_unpacklo_epi8( chunk, zero ) );
+		_mm_storeu_si128( reinterpret_cast<__m128i*>( pToNext + 8 ), _mm_unpackhi_epi8( chunk, zero ) );
+		pNext+= 16;
+		pToNext+= 16;
+	}
+#	endif
+	while ( pNext < pEnd && (unsigned char)*pNext < 0x80 ) {
+		*pToNext++ = wchar_t( *pNext++ );
+	}
+	return pNext - pFrom;
+}
+
+/**
+** @brief Copy a run of 7 bit (ASCII) characters into a byte buffer.
+**
+** @returns The number of characters copied.
+*/
+size_t copy_ascii( const wchar_t* pFrom, const wchar_t* pFromMax, char* pTo, char* pToMax ) throw()
+{
+	const size_t   fromLength = pFromMax - pFrom;
+	const size_t   toLength   = pToMax - pTo;
+	const wchar_t* pEnd       = pFrom + (fromLength < toLength ? fromLength : toLength);
+	const wchar_t* pNext      = pFrom;
+	char*          pToNext    = pTo;
+
+#	ifdef SQTPP_SSE2
+	const __m128i zero     = _mm_setzero_si128();
+	const __m128i nonAscii = _mm_set1_epi16( short( 0xFF80 ) );
+	while ( pEnd - pNext >= 16 ) {
+		const __m128i chunk1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pNext ) );
+		const __m128i chunk2 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pNext + 8 ) );
+		const __m128i high   = _mm_and_si128( _mm_or_si128( chunk1, chunk2 ), nonAscii );
+		if ( _mm_movemask_epi8( _mm_cmpeq_epi16( high, zero ) ) != 0xFFFF ) {
+			break;
+		}
+		_mm_storeu_si128( reinterpret_cast<__m128i*>( pToNext ), _mm_packus_epi16( chunk1, chunk2 ) );
+		pNext+= 16;
+		pToNext+= 16;
+	}
+#	endif
+	while ( pNext < pEnd && unsigned( *pNext ) < 0x80 ) {
+		*pToNext++ = char( *pNext++ );
+	}
+	return pNext - pFrom;
+}
+
+} // namespace
+
 // --------------------------------------------------------------------
 // SbcsConverter
 // --------------------------------------------------------------------
@@ -24,7 +236,16 @@ namespace sqtpp {
 SbcsConverter::SbcsConverter( unsigned int codePageId, size_t refCount )
 : base( refCount ) 
 , m_codePageId( codePageId )
+, m_pDecodeTable( getDecodeTable( codePageId ) )
 {
+	if ( m_pDecodeTable != NULL ) {
+		m_encodeTable.reserve( 128 );
+		for ( int i = 0x80; i < 0x100; ++i ) {
+			EncodeEntry entry = { m_pDecodeTable[i], char(i) };
+			m_encodeTable.push_back( entry );
+		}
+		std::sort( m_encodeTable.begin(), m_encodeTable.end() );
+	}
 }
 
 /**
@@ -34,6 +255,50 @@ SbcsConverter::~SbcsConverter()
 {
 }
 
+/**
+** @brief Get the table of the characters of a code page.
+**
+** @returns The 256 characters of the code page or NULL if the code 
+**          page has to be converted by the system.
+*/
+const wchar_t* SbcsConverter::getDecodeTable( unsigned int codePageId ) throw()
+{
+	switch ( codePageId ) {
+	case CPID_OEM_437:
+		return cp437Table;
+	case CPID_OEM_850:
+		return cp850Table;
+	case CPID_WINDOWS_1252:
+		return cp1252Table;
+	default:
+		return NULL;
+	}
+}
+
+/**
+** @brief Convert a non ASCII character.
+**
+** A character which is not part of the code page is converted by the
+** system to keep its best fit mapping (e.g. U+0100 to 'A').
+**
+** @returns The byte of the character or '?' if the character has no 
+**          best fit either.
+*/
+char SbcsConverter::encode( wchar_t wchar ) const throw()
+{
+	const EncodeEntry entry = { wchar, '\0' };
+	EncodeTable::const_iterator it = std::lower_bound( m_encodeTable.begin(), m_encodeTable.end(), entry );
+	if ( it != m_encodeTable.end() && it->wchar == wchar ) {
+		return it->byte;
+	}
+
+	char byte = '?';
+	if ( WideCharToMultiByte( getCodePageId(), 0, &wchar, 1, &byte, 1, NULL, NULL ) != 1 ) {
+		byte = '?';
+	}
+	return byte;
+}
+
 /**
 ** @brief See <a href="http://www.cplusplus.com/reference/std/locale/codecvt/in/">c++ documentation</a> for details.
 */
@@ -61,6 +326,19 @@ std::codecvt_base::result SbcsConverter::do_in( mbstate_t& state
 		return pFrom == pFromMax ? noconv : partial;
 	}
 
+	if ( m_pDecodeTable != NULL ) {
+		const char* pFromEnd = pFrom + fromLength;
+		while ( pFromNext < pFromEnd ) {
+			const size_t asciiCount = copy_ascii( pFromNext, pFromEnd, pToNext, pToMax );
+			pFromNext+= asciiCount;
+			pToNext+= asciiCount;
+			while ( pFromNext < pFromEnd && (unsigned char)*pFromNext >= 0x80 ) {
+				*pToNext++ = m_pDecodeTable[(unsigned char)*pFromNext++];
+			}
+		}
+		return pFromNext == pFromMax ? ok : partial;
+	}
+
 	// Set dwFlags (Windows Vista and later): 
 	// The function does not drop illegal code points if the application does not set this flag.
 	const DWORD dwFlags = MB_ERR_INVALID_CHARS;
@@ -102,6 +380,23 @@ std::codecvt_base::result SbcsConverter::do_out( mbstate_t& /* state */
 		return partial;
 	}
 
+	if ( m_pDecodeTable != NULL ) {
+		const wchar_t* pFromEnd = pFrom + (fromLength < toLength ? fromLength : toLength);
+		while ( pFromNext < pFromEnd ) {
+			const size_t asciiCount = copy_ascii( pFromNext, pFromEnd, pToNext, pToMax );
+			pFromNext+= asciiCount;
+			pToNext+= asciiCount;
+			while ( pFromNext < pFromEnd && unsigned( *pFromNext ) >= 0x80 ) {
+				*pToNext++ = encode( *pFromNext++ );
+				// The system replaces a surrogate pair by a single character.
+				if ( unsigned( pFromNext[-1] - 0xD800 ) < 0x400 && pFromNext < pFromEnd && unsigned( *pFromNext - 0xDC00 ) < 0x400 ) {
+					++pFromNext;
+				}
+			}
+		}
+		return pFromNext == pFromMax ? ok : partial;
+	}
+
 	// Set dwFlags (Windows Vista and later): 
 	// dwFlags must be set to either 0 or WC_ERR_INVALID_CHARS. 
 	const DWORD dwFlags = 0; // WC_ERR_INVALID_CHARS;
@@ -394,12 +689,75 @@ int Utf8Converter::sequence_length( char start )
 	return result;
 }
 
+/**
+** @brief Get the length of the valid UTF-8 characters at the start of a byte sequence.
+**
+** Overlong sequences, surrogates and code points above U+10FFFF are
+** not valid. Runs of ASCII characters are skipped in blocks.
+**
+** @param nAsciiCount Receives the length of the run of ASCII characters at the start.
+** @returns The number of bytes up to the first invalid or incomplete sequence.
+*/
+size_t Utf8Converter::valid_length( const char* pFrom, const char* pFromMax, size_t& nAsciiCount ) throw()
+{
+	const char* pNext = pFrom;
 
+	nAsciiCount = ascii_length( pFrom, pFromMax );
+	pNext+= nAsciiCount;
+	for ( ;; ) {
+		pNext+= ascii_length( pNext, pFromMax );
+		if ( pNext == pFromMax ) {
+			break;
+		}
+
+		const unsigned char lead = (unsigned char)pNext[0];
+		size_t              length;
+		if ( lead >= 0xC2 && lead <= 0xDF ) {
+			length = 2;
+		} else if ( lead >= 0xE0 && lead <= 0xEF ) {
+			length = 3;
+		} else if ( lead >= 0xF0 && lead <= 0xF4 ) {
+			length = 4;
+		} else {
+			break;
+		}
+		if ( size_t(pFromMax - pNext) < length ) {
+			break;
+		}
+
+		// The range of the second byte excludes overlong sequences, surrogates and
+		// code points above U+10FFFF.
+		unsigned char secondMin = 0x80;
+		unsigned char secondMax = 0xBF;
+		switch ( lead ) {
+			case 0xE0: secondMin = 0xA0; break;
+			case 0xED: secondMax = 0x9F; break;
+			case 0xF0: secondMin = 0x90; break;
+			case 0xF4: secondMax = 0x8F; break;
+		}
+		const unsigned char second = (unsigned char)pNext[1];
+		if ( second < secondMin || second > secondMax ) {
+			break;
+		}
+		size_t i = 2;
+		while ( i < length && ((unsigned char)pNext[i] & 0xC0) == 0x80 ) {
+			++i;
+		}
+		if ( i < length ) {
+			break;
+		}
+		pNext+= length;
+	}
+	return pNext - pFrom;
+}
 
 /**
 ** @brief See <a href="http://www.cplusplus.com/reference/std/locale/codecvt/in/">c++ documentation</a> for details.
+**
+** Runs of ASCII characters are copied directly. Only the multi byte 
+** sequences in between are converted by MultiByteToWideChar.
 */
-std::codecvt_base::result Utf8Converter::do_in( mbstate_t& state
+std::codecvt_base::result Utf8Converter::do_in( mbstate_t& /* state */
 , const char* pFrom , const char* pFromMax , const char*& pFromNext
 , wchar_t* pTo , wchar_t* pToMax, wchar_t*& pToNext ) const
 {
@@ -417,27 +775,62 @@ std::codecvt_base::result Utf8Converter::do_in( mbstate_t& state
 	if ( toLength == 0 )
 		return noconv;
 
-	const size_t fromLength = do_length( state, pFrom, pFromMax, toLength );
-
-	if ( fromLength == 0 ) {
-		return pFrom == pFromMax ? noconv : partial;
-	}
-
 	// Set dwFlags (Windows Vista and later): 
 	// The function does not drop illegal code points if the application does not set this flag.
 	const DWORD dwFlags = MB_ERR_INVALID_CHARS;
-	const int charCount = MultiByteToWideChar( CP_UTF8, dwFlags, pFrom, (int)fromLength, pTo, (int)toLength ) ; 
-	if ( charCount > 0 ) {
-		pFromNext = pFrom + fromLength;
-		pToNext   = pTo   + charCount;
-		return pFromNext == pFromMax ? ok : partial;
-	} else {
-		return error;
+
+	while ( pFromNext < pFromMax && pToNext < pToMax ) {
+		const size_t asciiCount = copy_ascii( pFromNext, pFromMax, pToNext, pToMax );
+		pFromNext+= asciiCount;
+		pToNext+= asciiCount;
+		if ( pFromNext == pFromMax || pToNext == pToMax ) {
+			break;
+		}
+
+		// Find the complete sequences up to the next ASCII character.
+		const char*  pSequenceMax = pFromNext;
+		const size_t maxCharCount = pToMax - pToNext;
+		size_t       charCount    = 0;
+		while ( pSequenceMax < pFromMax && (unsigned char)*pSequenceMax >= 0x80 ) {
+			const int    sequenceLength = sequence_length( *pSequenceMax );
+			// Sequences of 4 bytes are decoded to a surrogate pair.
+			const size_t wcharCount     = sequenceLength == 4 ? 2 : 1;
+			if ( pSequenceMax + sequenceLength > pFromMax || charCount + wcharCount > maxCharCount ) {
+				break;
+			}
+			pSequenceMax+= sequenceLength;
+			charCount+= wcharCount;
+		}
+
+		if ( pSequenceMax == pFromNext ) {
+			if ( sequence_length( *pFromNext ) > 4 && pFromNext == pFrom ) {
+				// Not a start byte of any sequence.
+				return error;
+			}
+			// Incomplete sequence at the end of the input.
+			break;
+		}
+		const int wcharCount = MultiByteToWideChar( CP_UTF8, dwFlags, pFromNext, int(pSequenceMax - pFromNext), pToNext, int(pToMax - pToNext) ) ; 
+		if ( wcharCount <= 0 ) {
+			pFromNext = pFrom;
+			pToNext = pTo;
+			return error;
+		}
+		pFromNext = pSequenceMax;
+		pToNext+= wcharCount;
 	}
+
+	if ( pFromNext == pFrom ) {
+		return partial;
+	}
+	return pFromNext == pFromMax ? ok : partial;
 }
 
 /**
 ** @brief See <a href="http://www.cplusplus.com/reference/std/locale/codecvt/out/">c++ documentation</a> for details.
+**
+** Runs of ASCII characters are copied directly. Only the other 
+** characters in between are converted by WideCharToMultiByte.
 */
 std::codecvt_base::result Utf8Converter::do_out( mbstate_t& /* state */
  , const wchar_t* pFrom , const wchar_t* pFromMax , const wchar_t*& pFromNext 
@@ -466,15 +859,37 @@ std::codecvt_base::result Utf8Converter::do_out( mbstate_t& /* state */
 	// Set dwFlags (Windows Vista and later): 
 	// dwFlags must be set to either 0 or WC_ERR_INVALID_CHARS. 
 	const DWORD dwFlags = 0; // WC_ERR_INVALID_CHARS;
-	const int charCount = WideCharToMultiByte( CP_UTF8, dwFlags, pFrom, (int)fromLength, pTo, (int)toLength, NULL, NULL ) ; 
-	if ( charCount > 0 ) {
-		pFromNext = pFrom + fromLength;
-		pToNext = pTo + charCount;
-		return ok;
-	} else {
-		DWORD dwErrorCode = ::GetLastError();
-		return dwErrorCode == ERROR_INSUFFICIENT_BUFFER ? partial : error;
+
+	while ( pFromNext < pFromMax ) {
+		const size_t asciiCount = copy_ascii( pFromNext, pFromMax, pToNext, pToMax );
+		pFromNext+= asciiCount;
+		pToNext+= asciiCount;
+		if ( pFromNext == pFromMax ) {
+			break;
+		}
+		if ( pToNext == pToMax ) {
+			return partial;
+		}
+
+		const wchar_t* pCharMax = pFromNext;
+		while ( pCharMax < pFromMax && unsigned( *pCharMax ) >= 0x80 ) {
+			++pCharMax;
+		}
+		const int charCount = WideCharToMultiByte( CP_UTF8, dwFlags, pFromNext, int(pCharMax - pFromNext), pToNext, int(pToMax - pToNext), NULL, NULL ) ; 
+		if ( charCount > 0 ) {
+			pFromNext = pCharMax;
+			pToNext+= charCount;
+		} else {
+			DWORD dwErrorCode = ::GetLastError();
+			if ( dwErrorCode == ERROR_INSUFFICIENT_BUFFER ) {
+				return partial;
+			}
+			pFromNext = pFrom;
+			pToNext = pTo;
+			return error;
+		}
 	}
+	return ok;
 }
 
 /**
@@ -495,17 +910,24 @@ int Utf8Converter::do_length( mbstate_t& /* state */, const char* pFrom, const c
 	assert( pFromMax > pFrom );
 
 	const char* pFromNext = pFrom;
-	int fromCount = 0;
 	size_t toCount   = 0;
 	while( pFromNext < pFromMax && toCount < toLength  ) {
+		if ( (unsigned char)*pFromNext < 0x80 ) {
+			// Skip a run of ASCII characters.
+			const size_t maxCount   = toLength - toCount;
+			const char*  pAsciiMax  = size_t(pFromMax - pFromNext) < maxCount ? pFromMax : pFromNext + maxCount;
+			const size_t asciiCount = ascii_length( pFromNext, pAsciiMax );
+			pFromNext+= asciiCount;
+			toCount+= asciiCount;
+			continue;
+		}
 		int sequenceLength = sequence_length( *pFromNext );
-		pFromNext+= sequenceLength;
-		if ( pFromNext > pFromMax ) 
+		if ( pFromNext + sequenceLength > pFromMax ) 
 			break;
-		fromCount+= sequenceLength;
+		pFromNext+= sequenceLength;
 		++toCount;
 	}
-	return fromCount;
+	return int(pFromNext - pFrom);
 }
 
 /**
@@ -645,6 +1067,52 @@ Utf16BeConverter::~Utf16BeConverter()
 {
 }
 
+/**
+** @brief Swap the bytes of big endian 16 bit characters.
+**
+** @param pFrom The big endian characters.
+** @param pTo The buffer receiving the characters.
+** @param count The number of characters to convert.
+*/
+void Utf16BeConverter::swap_bytes( const char* pFrom, wchar_t* pTo, size_t count ) throw()
+{
+	size_t i = 0;
+#	ifdef SQTPP_SSE2
+	for ( ; i + 8 <= count; i+= 8 ) {
+		const __m128i chunk = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pFrom + 2 * i ) );
+		_mm_storeu_si128( reinterpret_cast<__m128i*>( pTo + i ), _mm_or_si128( _mm_slli_epi16( chunk, 8 ), _mm_srli_epi16( chunk, 8 ) ) );
+	}
+#	endif
+	for ( ; i < count; ++i ) {
+		unsigned char loByte = (unsigned char)(pFrom[2 * i + 1]);
+		unsigned char hiByte = (unsigned char)(pFrom[2 * i]);
+		pTo[i] = wchar_t( hiByte << 8 | loByte );
+	}
+}
+
+/**
+** @brief Swap the bytes of 16 bit characters into big endian byte order.
+**
+** @param pFrom The characters.
+** @param pTo The buffer receiving the big endian characters.
+** @param count The number of characters to convert.
+*/
+void Utf16BeConverter::swap_bytes( const wchar_t* pFrom, char* pTo, size_t count ) throw()
+{
+	size_t i = 0;
+#	ifdef SQTPP_SSE2
+	for ( ; i + 8 <= count; i+= 8 ) {
+		const __m128i chunk = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pFrom + i ) );
+		_mm_storeu_si128( reinterpret_cast<__m128i*>( pTo + 2 * i ), _mm_or_si128( _mm_slli_epi16( chunk, 8 ), _mm_srli_epi16( chunk, 8 ) ) );
+	}
+#	endif
+	for ( ; i < count; ++i ) {
+		wchar_t c = pFrom[i];
+		pTo[2 * i]     = char((c & 0xFF00) >> 8);
+		pTo[2 * i + 1] = char(c & 0x00FF);
+	}
+}
+
 /**
 ** @brief See <a href="http://www.cplusplus.com/reference/std/locale/codecvt/in/">c++ documentation</a> for details.
 */
@@ -652,11 +1120,13 @@ std::codecvt_base::result Utf16BeConverter::do_in( mbstate_t& /*state*/
 , const char* pFrom , const char* pFromMax , const char*& pFromNext
 , wchar_t* pTo , wchar_t* pToMax, wchar_t*& pToNext ) const
 {
-	for ( pFromNext = pFrom, pToNext = pTo; pFromNext + 1 < pFromMax && pToNext < pToMax; pFromNext+=2, ++pToNext ) {
-		unsigned char loByte = unsigned char(pFromNext[1]);
-		unsigned char hiByte = unsigned char(pFromNext[0]);
-		*pToNext = wchar_t( hiByte << 8 | loByte );
+	size_t count = (pFromMax - pFrom) / 2;
+	if ( count > size_t(pToMax - pTo) ) {
+		count = pToMax - pTo;
 	}
+	swap_bytes( pFrom, pTo, count );
+	pFromNext = pFrom + 2 * count;
+	pToNext   = pTo + count;
 
 	return pFromNext == pFromMax ? ok : partial;
 }
@@ -668,13 +1138,13 @@ std::codecvt_base::result Utf16BeConverter::do_out( mbstate_t& /*state*/
  , const wchar_t* pFrom, const wchar_t* pFromMax, const wchar_t*& pFromNext 
  , char* pTo, char* pToMax, char*& pToNext ) const
 {
-	for ( pFromNext = pFrom, pToNext = pTo; pFromNext < pFromMax && pToNext + 1 < pToMax; ++pFromNext, pToNext+= 2 ) {
-		wchar_t c = *pFrom;
-		unsigned char loByte = unsigned char(c & 0x00FF);
-		unsigned char hiByte = unsigned char((c & 0xFF00) >> 8);
-		pToNext[0] = hiByte;
-		pToNext[1] = loByte;
+	size_t count = pFromMax - pFrom;
+	if ( count > size_t(pToMax - pTo) / 2 ) {
+		count = (pToMax - pTo) / 2;
 	}
+	swap_bytes( pFrom, pTo, count );
+	pFromNext = pFrom + count;
+	pToNext   = pTo + 2 * count;
 
 	return pFromNext == pFromMax ? ok : partial;
 }
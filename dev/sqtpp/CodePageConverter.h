@@ -13,14 +13,41 @@ typedef std::codecvt<wchar_t , char, mbstate_t> CodePageConverter;
 
 /**
 ** @brief Converter for single byte coded string streams.
+**
+** The code pages 437, 850 and 1252 are converted using the tables of
+** their characters. Other code pages are still converted by the Win32
+** functions MultiByteToWideChar and WideCharToMultiByte and therefore
+** are available on Windows only.
 */
 class SbcsConverter : public CodePageConverter
 {
 private:
 	typedef CodePageConverter base;
 
+	/**
+	** @brief An entry of the table used to encode the non ASCII characters.
+	*/
+	struct EncodeEntry
+	{
+		wchar_t wchar;
+		char    byte;
+
+		bool operator< ( const EncodeEntry& that ) const throw()
+		{
+			return wchar < that.wchar;
+		}
+	};
+
+	typedef std::vector<EncodeEntry> EncodeTable;
+
 	unsigned int m_codePageId;
 
+	// The characters of the code page (NULL if the code page is converted by the system).
+	const wchar_t* m_pDecodeTable;
+
+	// The non ASCII characters of the code page ordered by their unicode value.
+	EncodeTable m_encodeTable;
+
 public:
 	explicit SbcsConverter( unsigned int codePageId, size_t refCount = 0 );
 	virtual ~SbcsConverter();
@@ -31,6 +58,13 @@ public:
 		return m_codePageId;
 	}
 
+private:
+	// Get the table of the characters of a code page.
+	static const wchar_t* getDecodeTable( unsigned int codePageId ) throw();
+
+	// Convert a non ASCII character.
+	char encode( wchar_t wchar ) const throw();
+
 protected:
     virtual result do_in( mbstate_t& state
 	                    , const char* pFrom , const char* pFromMax , const char*& pFromNext
@@ -105,6 +139,8 @@ public:
 	/// Get the length of the sequence defined by the first byte of a UTF-8 character.
 	static int sequence_length( char start );
 
+	/// Get the length of the valid UTF-8 characters at the start of a byte sequence.
+	static size_t valid_length( const char* pFrom, const char* pFromMax, size_t& nAsciiCount ) throw();
 
 protected:
     virtual result do_in( mbstate_t& state
@@ -179,6 +215,12 @@ public:
 
 	virtual ~Utf16BeConverter();
 
+	/// Swap the bytes of big endian 16 bit characters.
+	static void swap_bytes( const char* pFrom, wchar_t* pTo, size_t count ) throw();
+
+	/// Swap the bytes of 16 bit characters into big endian byte order.
+	static void swap_bytes( const wchar_t* pFrom, char* pTo, size_t count ) throw();
+
 protected:
     virtual result do_in( mbstate_t& state
 	                    , const char* pFrom , const char* pFromMax , const char*& pFromNext
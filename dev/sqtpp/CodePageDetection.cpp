@@ -10,6 +10,7 @@
 #include "stdafx.h"
 #include "Error.h"
 #include "CodePage.h"
+#include "CodePageConverter.h"
 #include "CodePageDetection.h"
 
 namespace sqtpp {
@@ -20,56 +21,65 @@ namespace sqtpp {
 **
 ** @param fileName The path of the file to open.
 ** @param defaultCodePageId The default code page if no unique clue to a file code page was found.
+** @param nProbeSize The number of bytes examined for UTF-8 sequences.
 */
-const CodePageInfo* CodePageDetection::detectCodePage( const std::wstring& fileName, const CodePageId defaultCodePageId )
+const CodePageInfo* CodePageDetection::detectCodePage( const std::wstring& fileName, const CodePageId defaultCodePageId, size_t nProbeSize )
 {
-	const CodePageInfo* const pDefaultCodePage = CodePageInfo::findCodePageInfo( defaultCodePageId );
-	if ( pDefaultCodePage == NULL ) {
-		throw error::C1205( defaultCodePageId );
-	}
-	const CodePageInfo* const pCodePage = detectCodePage( fileName, pDefaultCodePage );
-	return pCodePage;
+	std::ifstream     ifs;
+	// Read the rest of a sequence which starts at the end of the probe, too.
+	std::vector<char> fileStart( nProbeSize + UTF8_MAX_SEQUENCE_LENGTH - 1 );
+
+	ifs.open( fileName.c_str(), ios::in | ios::binary, _SH_DENYWR  );
+	ifs.read( &fileStart[0], fileStart.size() );
+	size_t bytesRead = (size_t)ifs.gcount();
+	ifs.close();
+
+	return detectCodePage( &fileStart[0], bytesRead, defaultCodePageId, nProbeSize );
 }
 
 /**
-** @brief Auto detect the character set of the file.
+** @brief Auto detect the character set of a file content already read into memory.
 **
-** @param fileName The path of the file to open.
+** Used to detect the code page of a file without opening it twice.
+**
+** @param pBytes The first bytes of the file.
+** @param nByteCount The number of bytes available.
+** @param defaultCodePageId The default code page if no unique clue to a file code page was found.
+** @param nProbeSize The number of bytes examined for UTF-8 sequences.
 **
-** @todo Determine code page of non unicode files.
+** Files without byte order mark are UTF-8 files if their first bytes 
+** contain non ASCII characters which all are valid UTF-8 sequences.
+**
+** @todo Determine code page of other non unicode files.
 */
-const CodePageInfo* CodePageDetection::detectCodePage( const std::wstring& fileName, const CodePageInfo* pDefaultCodePage  )
+const CodePageInfo* CodePageDetection::detectCodePage( const char* pBytes, size_t nByteCount, const CodePageId defaultCodePageId, size_t nProbeSize )
 {
-	std::ifstream ifs;
+	const CodePageInfo* pCodePageInfo = detectCodePageByBom( pBytes, nByteCount );
+	if ( pCodePageInfo == NULL && isUtf8( pBytes, nByteCount, nProbeSize ) ) {
+		pCodePageInfo = CodePageInfo::findCodePageInfo( CPID_UTF8 );
+	}
 
-	ifs.open( fileName.c_str(), ios::in | ios::binary, _SH_DENYWR  );
-	const CodePageInfo* pCodePageInfo = detectCodePageByBom( ifs );
-	ifs.close();
+	return pCodePageInfo == NULL ? getDefaultCodePage( defaultCodePageId ) : pCodePageInfo ;
+}
 
-	if ( pCodePageInfo == NULL && pDefaultCodePage == NULL ) {
-		// TODO: detect code page of non unicode files.
+/**
+** @brief Get the code page info of the default code page.
+*/
+const CodePageInfo* CodePageDetection::getDefaultCodePage( const CodePageId defaultCodePageId )
+{
+	const CodePageInfo* const pDefaultCodePage = CodePageInfo::findCodePageInfo( defaultCodePageId );
+	if ( pDefaultCodePage == NULL ) {
+		throw error::C1205( defaultCodePageId );
 	}
-
-	return pCodePageInfo == NULL ? pDefaultCodePage : pCodePageInfo ;
+	return pDefaultCodePage;
 }
 
 /**
-** @brief Read the first bytes of a file and try to determine it's encoding
-** by examinig the first bytes of the file.
+** @brief Try to determine the encoding of a file by examinig the first bytes of the file.
 */
-const CodePageInfo* CodePageDetection::detectCodePageByBom( std::ifstream& fileStream )
+const CodePageInfo* CodePageDetection::detectCodePageByBom( const char* pBytes, size_t nByteCount )
 {
 	const CodePageInfo** codePageInfos = CodePageInfo::getCodePages();
-	char  fileStart[512];
-
-	fileStream.seekg( ios_base::beg );
-	fileStream.read( fileStart, sizeof( fileStart ) );
-	size_t bytesRead = (size_t)fileStream.gcount();
-	if ( bytesRead < sizeof(fileStart) ) {
-		fileStart[bytesRead] = '\0';
-	} else {
-		fileStart[bytesRead-1] = '\0';
-	}
 
 	for ( const CodePageInfo* const* ppCodePageInfo = codePageInfos; *ppCodePageInfo != NULL; ppCodePageInfo++ ) {
 		const CodePageInfo& cpInfo = **ppCodePageInfo;
@@ -77,11 +87,35 @@ const CodePageInfo* CodePageDetection::detectCodePageByBom( std::ifstream& fileS
 		if ( cpBom == NULL )
 			continue;
 		size_t length = strlen( cpBom );
-		if ( strncmp( cpBom, fileStart, min( length, bytesRead ) ) == 0 )
+		if ( length <= nByteCount && strncmp( cpBom, pBytes, length ) == 0 )
 			return *ppCodePageInfo;
 	}
 	return NULL;
 }
 
+/**
+** @brief Check if the first bytes of a file without byte order mark are UTF-8 encoded.
+**
+** Only the first nProbeSize bytes are examined. A sequence which starts
+** within the probe is validated completely, including the bytes behind
+** the end of the probe.
+**
+** @returns <code>true</code> if there are non ASCII characters and all
+**          of them are valid UTF-8 sequences.
+*/
+bool CodePageDetection::isUtf8( const char* pBytes, size_t nByteCount, size_t nProbeSize )
+{
+	const size_t nProbeCount = min( nByteCount, nProbeSize );
+	const char*  pProbeEnd   = pBytes + min( nByteCount, nProbeCount + UTF8_MAX_SEQUENCE_LENGTH - 1 );
+	size_t       nAsciiCount;
+
+	const size_t nValidCount = Utf8Converter::valid_length( pBytes, pProbeEnd, nAsciiCount );
+	if ( nAsciiCount >= nProbeCount ) {
+		// ASCII only: No clue to a code page.
+		return false;
+	}
+	return nValidCount >= nProbeCount;
+}
+
 
 } // namespace
@@ -19,17 +19,28 @@ class CodePageInfo;
 
 class CodePageDetection
 {
+public:
+	/// Number of bytes examined by default to detect UTF-8 files without byte order mark.
+	enum { UTF8_PROBE_SIZE = 0x100000 };
+
 private:
+	/// Maximal length of an UTF-8 character sequence.
+	enum { UTF8_MAX_SEQUENCE_LENGTH = 4 };
+
 	/// Private constructor because this class defines static service methods only.
 	CodePageDetection();
 
 public:
 
 	/// Auto detect the character set of the file.
-	static const CodePageInfo* detectCodePage( const std::wstring& fileName, const CodePageId defaultCodePageId );
+	static const CodePageInfo* detectCodePage( const std::wstring& fileName, const CodePageId defaultCodePageId, size_t nProbeSize = UTF8_PROBE_SIZE );
+
+	/// Auto detect the character set of a file content already read into memory.
+	static const CodePageInfo* detectCodePage( const char* pBytes, size_t nByteCount, const CodePageId defaultCodePageId, size_t nProbeSize = UTF8_PROBE_SIZE );
 private:
-	static const CodePageInfo* detectCodePage( const std::wstring& fileName, const CodePageInfo* pDefaultCodePage );
-	static const CodePageInfo* detectCodePageByBom( std::ifstream& fileStream );
+	static const CodePageInfo* getDefaultCodePage( const CodePageId defaultCodePageId );
+	static const CodePageInfo* detectCodePageByBom( const char* pBytes, size_t nByteCount );
+	static bool isUtf8( const char* pBytes, size_t nByteCount, size_t nProbeSize );
 
 	static size_t min( size_t a, size_t b )
 	{
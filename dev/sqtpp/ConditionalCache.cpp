@@ -0,0 +1,193 @@
+#include "stdafx.h"
+#include "Context.h"
+#include "Token.h"
+#include "Macro.h"
+#include "ConditionalCache.h"
+
+namespace sqtpp {
+
+/**
+** @brief Constructor.
+*/
+ConditionalCache::ConditionalCache()
+: m_skipStart( 0, CTX_UNDEFINED )
+, m_nSkipLineCount( 0 )
+, m_bSkipRecording( false )
+{
+}
+
+/**
+** @brief Get the version of the macro with the given identifier.
+**
+** @returns 0 if no such macro is defined.
+*/
+size_t ConditionalCache::getVersion( const MacroSet& macros, const std::wstring& identifier )
+{
+	MacroSet::const_iterator itMacro = macros.find( identifier );
+	if ( itMacro == macros.end() ) {
+		return 0;
+	} else {
+		const Macro& macro = itMacro->second;
+		return macro.getVersion();
+	}
+}
+
+/**
+** @brief Look up the result of the expression at the given location.
+**
+** @param sFilePath The file containing the expression.
+** @param nLine The line of the directive within the file.
+** @param macros The currently defined macros.
+** @param bValue Receives the cached result if one was found.
+** @returns true if a valid entry was found.
+*/
+bool ConditionalCache::lookup( const std::wstring& sFilePath, size_t nLine, const MacroSet& macros, bool& bValue ) const
+{
+	FileMap::const_iterator itFile = m_files.find( sFilePath );
+	if ( itFile == m_files.end() ) {
+		return false;
+	}
+
+	const LineMap& lines = itFile->second;
+	LineMap::const_iterator itEntry = lines.find( nLine );
+	if ( itEntry == lines.end() ) {
+		return false;
+	}
+
+	const Entry& entry = itEntry->second;
+	for ( VersionMap::const_iterator it = entry.versions.begin(); it != entry.versions.end(); ++it ) {
+		if ( getVersion( macros, it->first ) != it->second ) {
+			return false;
+		}
+	}
+	bValue = entry.bValue;
+	return true;
+}
+
+/**
+** @brief Store the result of the expression at the given location.
+**
+** Besides the identifiers found in the expression itself all identifiers 
+** of the definitions of the referenced macros are recorded because they 
+** take part in the expansion. The result is not cached at all if one of
+** these macros is volatile (like __LINE__) or uses the token pasting 
+** operator which may create identifiers that are not known in advance.
+**
+** @param sFilePath The file containing the expression.
+** @param nLine The line of the directive within the file.
+** @param identifiers The identifiers found while scanning the expression.
+** @param macros The currently defined macros.
+** @param bValue The result of the expression.
+*/
+void ConditionalCache::insert( const std::wstring& sFilePath, size_t nLine, const StringSet& identifiers, const MacroSet& macros, bool bValue )
+{
+	Entry       entry;
+	StringSet   visited;
+	StringArray pending( identifiers.begin(), identifiers.end() );
+
+	entry.bValue = bValue;
+	while ( !pending.empty() ) {
+		const wstring identifier = pending.back();
+		pending.pop_back();
+		if ( !visited.insert( identifier ).second ) {
+			continue;
+		}
+
+		MacroSet::const_iterator itMacro = macros.find( identifier );
+		if ( itMacro == macros.end() ) {
+			entry.versions[identifier] = 0;
+			continue;
+		}
+
+		const Macro& macro = itMacro->second;
+		if ( macro.isVolatile() ) {
+			return;
+		}
+		entry.versions[identifier] = macro.getVersion();
+
+		const TokenExpressions& tokens = macro.getTokens();
+		for ( TokenExpressions::const_iterator itToken = tokens.begin(); itToken != tokens.end(); ++itToken ) {
+			const TokenExpression& tokenExpression = *itToken;
+			switch ( tokenExpression.getToken() ) {
+				case TOK_SHARP_SHARP:
+					return;
+				case TOK_IDENTIFIER:
+					pending.push_back( tokenExpression.getIdentifier() );
+					break;
+				default:
+					break;
+			}
+		}
+	}
+	m_files[sFilePath][nLine] = entry;
+}
+
+/**
+** @brief Look up the number of lines of a skipped block.
+**
+** @param sFilePath The file containing the block.
+** @param nLine The line in which the block starts.
+** @param context The scanner context of the block (CTX_CONDITIONAL_FALSE or CTX_CONDITIONAL_DONE).
+** @param nLineCount Receives the number of new lines up to the matching directive.
+** @returns true if the block has been skipped before.
+*/
+bool ConditionalCache::lookupSkip( const std::wstring& sFilePath, size_t nLine, Context context, size_t& nLineCount ) const
+{
+	SkipFileMap::const_iterator itFile = m_skips.find( sFilePath );
+	if ( itFile == m_skips.end() ) {
+		return false;
+	}
+
+	const SkipMap& skips = itFile->second;
+	SkipMap::const_iterator itSkip = skips.find( SkipStart( nLine, context ) );
+	if ( itSkip == skips.end() ) {
+		return false;
+	}
+	nLineCount = itSkip->second;
+	return true;
+}
+
+/**
+** @brief Start recording a skipped block.
+**
+** The lines are counted by #countSkippedLine until the matching directive
+** is found and #endSkip is called.
+*/
+void ConditionalCache::beginSkip( const std::wstring& sFilePath, size_t nLine, Context context )
+{
+	m_sSkipFilePath  = sFilePath;
+	m_skipStart      = SkipStart( nLine, context );
+	m_nSkipLineCount = 0;
+	m_bSkipRecording = true;
+}
+
+/**
+** @brief Store the skipped block currently recorded (if any).
+*/
+void ConditionalCache::endSkip()
+{
+	if ( m_bSkipRecording ) {
+		m_skips[m_sSkipFilePath][m_skipStart] = m_nSkipLineCount;
+		m_bSkipRecording = false;
+	}
+}
+
+/**
+** @brief Discard the skipped block currently recorded.
+*/
+void ConditionalCache::cancelSkip() throw()
+{
+	m_bSkipRecording = false;
+}
+
+/**
+** @brief Remove all entries.
+*/
+void ConditionalCache::clear()
+{
+	m_files.clear();
+	m_skips.clear();
+	m_bSkipRecording = false;
+}
+
+} // namespace
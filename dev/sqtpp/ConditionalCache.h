@@ -0,0 +1,119 @@
+/**
+** @file
+** @author Ralf Seidel
+** @brief Declaration of the #sqtpp::ConditionalCache class.
+**
+**  2004-2006 by Heinrich und Seidel GbR Wuppertal.
+*/
+#ifndef SQTPP_CONDITIONALCACHE_H
+#define SQTPP_CONDITIONALCACHE_H
+#if _MSC_VER > 10
+#pragma once
+#endif
+
+namespace sqtpp {
+
+enum Context;
+class MacroSet;
+
+/**
+** @brief Cache for the results of \#if and \#elif expressions.
+**
+** Headers which are included many times usually evaluate the same
+** conditional expressions with the same macro definitions again and
+** again. The cache remembers the result of an expression together 
+** with the version numbers of all macros the expression may depend 
+** on. The entries are keyed by the file and the line of the directive.
+** (The file position is not suitable because the processor does not
+** count the characters of skipped conditional blocks.) An entry is 
+** valid as long as none of these macros has been redefined or undefined.
+**
+** Additionally the cache records the number of lines of each skipped
+** conditional block (the distance to the matching \#elif, \#else or
+** \#endif). If the block has to be skipped again the scanner just
+** reads the lines without looking for nested directives.
+*/
+class ConditionalCache
+{
+private:
+	/// Versions of the referenced macros by identifier (0 = not defined).
+	typedef std::map<std::wstring, size_t> VersionMap;
+
+	/// A cached expression result.
+	struct Entry
+	{
+		/// The result of the expression.
+		bool       bValue;
+		/// The macros the result depends on.
+		VersionMap versions;
+	};
+
+	/// Entries of one file by line of the directive.
+	typedef std::map<size_t, Entry>             LineMap;
+
+	/// Entries by file path.
+	typedef std::map<std::wstring, LineMap>     FileMap;
+
+	/// Start of a skipped block (line and scanner context).
+	typedef std::pair<size_t, Context>          SkipStart;
+
+	/// Number of lines of the skipped blocks of one file.
+	typedef std::map<SkipStart, size_t>         SkipMap;
+
+	/// Skipped blocks by file path.
+	typedef std::map<std::wstring, SkipMap>     SkipFileMap;
+
+	/// The cached entries.
+	FileMap      m_files;
+
+	/// The skipped blocks.
+	SkipFileMap  m_skips;
+
+	/// The file of the skipped block currently recorded.
+	std::wstring m_sSkipFilePath;
+
+	/// The start of the skipped block currently recorded.
+	SkipStart    m_skipStart;
+
+	/// Number of lines of the skipped block counted so far.
+	size_t       m_nSkipLineCount;
+
+	/// Flag indicating that a skipped block is being recorded.
+	bool         m_bSkipRecording;
+
+private:
+	// Get the version of a macro (0 if undefined).
+	static size_t getVersion( const MacroSet& macros, const std::wstring& identifier );
+
+public:
+	// Constructor.
+	ConditionalCache();
+
+	// Look up the result of the expression at the given location.
+	bool lookup( const std::wstring& sFilePath, size_t nLine, const MacroSet& macros, bool& bValue ) const;
+
+	// Store the result of the expression at the given location.
+	void insert( const std::wstring& sFilePath, size_t nLine, const StringSet& identifiers, const MacroSet& macros, bool bValue );
+
+	// Look up the number of lines of a skipped block.
+	bool lookupSkip( const std::wstring& sFilePath, size_t nLine, Context context, size_t& nLineCount ) const;
+
+	// Start recording a skipped block.
+	void beginSkip( const std::wstring& sFilePath, size_t nLine, Context context );
+
+	/// Count a line of the skipped block currently recorded.
+	void countSkippedLine() throw() { ++m_nSkipLineCount; }
+
+	// Store the skipped block currently recorded.
+	void endSkip();
+
+	// Discard the skipped block currently recorded.
+	void cancelSkip() throw();
+
+	// Remove all entries.
+	void clear();
+};
+
+} // namespace
+
+#endif // SQTPP_CONDITIONALCACHE_H
@@ -9,98 +9,98 @@
 namespace sqtpp {
 
 // --------------------------------------------------------------------
-// Expression::NodeType
+// Expression::Instruction
 // --------------------------------------------------------------------
 
 /**
-** @brief Type of a node in the expression tree.
+** @brief An instruction of the compiled expression.
 */
-enum  Expression::NodeType
+struct Expression::Instruction
 {
-	/// Undefined / Initial value.
-	NTP_UNDEFINED,
-	/// A node holding an operator,
-	NTP_OPERATOR,
-	/// A raw value node.
-	NTP_VALUE
+	/**
+	** @brief The operation codes.
+	*/
+	enum OpCode 
+	{
+		/// Push the operand onto the value stack.
+		OPC_PUSH,
+		/// Push 1 if the identifier with the index given by the operand is a defined macro, 0 otherwise.
+		OPC_DEFINED,
+		/// Push the constant value of the macro with the index given by the operand (0 if there is no such macro).
+		OPC_IDENTIFIER,
+		/// Apply the unary operator to the top of the stack.
+		OPC_UNARY,
+		/// Apply the binary operator to the two top most values of the stack.
+		OPC_BINARY,
+		/// If the top of the stack is zero jump to the operand. Otherwise pop the value.
+		OPC_JUMP_IF_FALSE,
+		/// If the top of the stack isn't zero replace it with 1 and jump to the operand. Otherwise pop the value.
+		OPC_JUMP_IF_TRUE,
+		/// Convert the top of the stack into a boolean value (0 or 1).
+		OPC_BOOL
+	};
+
+	/// The operation code.
+	OpCode        m_opCode;
+	/// The operator token of unary and binary operations.
+	Token         m_token;
+	/// The value, identifier index or jump target.
+	long long int m_operand;
+
+	Instruction( OpCode opCode, Token token, long long int operand )
+	: m_opCode( opCode )
+	, m_token( token )
+	, m_operand( operand )
+	{
+	}
 };
 
 
-
 // --------------------------------------------------------------------
-// Expression::Node
+// Expression::Program
 // --------------------------------------------------------------------
 
 /**
-** @brief A node in the expression tree.
+** @brief The compiled expression.
 */
-struct Expression::Node
+class Expression::Program : public std::vector<Expression::Instruction>
 {
-	NodeType m_type;
-	Node*    m_pLeft;
-	Node*    m_pRight;
-	Node*    m_pParent;
-	Token    m_token;
-	Value    m_value;
-
-	Node();
-	Node( Node* pParent );
-	~Node();
-
-	const Value& evaluate( const MacroSet* pMacros );
-};
+public:
+	/// The identifiers referenced by the defined operator or as operands.
+	StringArray              m_identifiers;
 
+	/// The evaluation stack (sized by the compiler).
+	std::vector<long long>   m_stack;
 
-Expression::Node::Node()
-{
-	memset( this, 0, sizeof( *this ) );
-}
-
-Expression::Node::~Node()
-{
-	delete m_pLeft;
-	delete m_pRight;
-}
+	/// The current stack depth while compiling.
+	size_t                   m_nDepth;
 
+	Program() : m_nDepth( 0 ) {}
 
-/**
-** @brief Evaluate the expression sub tree.
-*/
-const Expression::Value& Expression::Node::evaluate( const MacroSet* pMacros )
-{
-	const TokenInfo& tokenInfo = TokenInfo::getTokenInfo( m_token );
-	
-
-	switch ( this->m_type ) {
-		case Expression::NTP_OPERATOR:
-
-			if ( this->m_pLeft != NULL && this->m_pRight != NULL ) {
-				assert( tokenInfo.isBinaryOperator() );
-				const Value& lValue = this->m_pLeft->evaluate( pMacros );
-				const Value& rValue = this->m_pRight->evaluate( pMacros );
-				this->m_value.evaluate( lValue, rValue, m_token );
-			} else if ( this->m_pRight != NULL ) {
-				assert( tokenInfo.isUnaryOperator() || m_token == TOK_RIGHT_PARENTHESIS );
-				const Value& rValue = this->m_pRight->evaluate( pMacros );
-
-				if ( this->m_token == TOK_OP_DEFINED ) {
-					this->m_value.evaluateDefined( rValue, pMacros );
-				} else {
-					this->m_value.evaluate( rValue, m_token );
-				}
-			} else {
-				// Operator without operands!
-				assert( false );
-			}
-			break;
-		case Expression::NTP_VALUE:
-			break;
-		default:
-			throw UnexpectedSwitchError();
+	/// Append an instruction and track the stack size required.
+	size_t emit( Instruction::OpCode opCode, Token token = TOK_UNDEFINED, long long int operand = 0 )
+	{
+		switch ( opCode ) {
+			case Instruction::OPC_PUSH:
+			case Instruction::OPC_DEFINED:
+			case Instruction::OPC_IDENTIFIER:
+				++m_nDepth;
+				break;
+			case Instruction::OPC_BINARY:
+			case Instruction::OPC_JUMP_IF_FALSE:
+			case Instruction::OPC_JUMP_IF_TRUE:
+				--m_nDepth;
+				break;
+			default:
+				break;
+		}
+		if ( m_nDepth > m_stack.size() ) {
+			m_stack.resize( m_nDepth );
+		}
+		push_back( Instruction( opCode, token, operand ) );
+		return size() - 1;
 	}
-	return m_value;
-}
-
+};
 
 
 
@@ -209,37 +209,58 @@ Expression::Value::Value( Expression::Type type, const wstring& value )
 	}
 }
 
+
+
+// --------------------------------------------------------------------
+// Expression
+// --------------------------------------------------------------------
 /**
-** @brief Evaluate binary operation.
-**
-** This methode will be called when evaluation expressions like
-** @code
-** 3 + 4
-** @endcode
+** @brief Default contructor.
+*/
+Expression::Expression()
+: m_pProgram( NULL )
+{
+}
+
+/**
+** @brief Initialising constructor. Immediatly parses and evaluates the given expression.
+*/
+Expression::Expression( const TokenExpressions& expressions )
+: m_pProgram( NULL )
+{
+	build( expressions );
+	evaluate();
+}
+
+Expression::~Expression()
+{
+	delete m_pProgram;
+}
+
+
+/**
+** @brief Get the evaluated value.
+*/
+const Expression::Value& Expression::getValue() const 
+{ 
+	assert( m_value.getType() != Expression::TYPE_UNDEFINED );
+	return m_value; 
+}
+
+
+/**
+** @brief Evaluate an unary or binary operator.
 **
-** or
+** For unary operators the left value is ignored.
 **
-** @code
-** 3 | 4
-** @endcode
-** 
-** @param lValue The left value.
-** @param rValue The right value.
+** @param lInteger The left value.
+** @param rInteger The right value.
 ** @param opToken The operator token.
 */
-void Expression::Value::evaluate( const Value& lValue, const Value& rValue, Token opToken )
+long long int Expression::evaluateOperator( long long int lInteger, long long int rInteger, Token opToken )
 {
-	long long int lInteger = lValue.getInteger();
-	long long int rInteger = rValue.getInteger();
 	long long int result;
 
-	const TokenInfo& tokenInfo = TokenInfo::getTokenInfo( opToken );
-	if ( &lValue == &m_zero ) {
-		assert( tokenInfo.isUnaryOperator() || opToken == TOK_RIGHT_PARENTHESIS );
-	} else {
-		assert( tokenInfo.isBinaryOperator() );
-	}
-
 	switch ( opToken ) {
 	case TOK_OP_COMMA:
 		result = rInteger;
@@ -334,182 +355,81 @@ void Expression::Value::evaluate( const Value& lValue, const Value& rValue, Toke
 	case TOK_OP_BIT_NOT:
 		result = ~rInteger;
 		break;
-	case TOK_RIGHT_PARENTHESIS:
-		result = +rInteger;
-		this->m_identifier = rValue.getIdentifier();
+	case TOK_OP_DEFINED:
+		// defined applied to something else than an identifier.
+		result = 0;
 		break;
 	default:
 		assert( false );
 		throw UnexpectedSwitchError();
 	}
 
-	this->m_type = rValue.getType();
-	this->m_integer = result;
+	return result;
 }
 
 
 /**
-** @brief Evaluate unary operation.
-**
-** The evaluation of an unary operations is handled in the binary
-** operation evaluator. This methode is only implemented to make
-** evaluation a bit clearer.
-*/
-void Expression::Value::evaluate( const Value& value, Token opToken )
-{
-	evaluate( m_zero, value, opToken );
-}
-
-
-/**
-** @brief Evaluate the defined operator.
-*/
-void Expression::Value::evaluateDefined( const Value& value, const MacroSet* pMacros )
-{
-	if ( pMacros == NULL || value.getType() != Expression::TYPE_IDENTIFIER ) {
-		*this = m_zero;
-	} else {
-		const wstring& identifier = value.getIdentifier();
-		this->m_type    = Expression::TYPE_INTEGER;
-		this->m_integer = pMacros->count( identifier ) != 0;
-	}
-}
-
-
-
-// --------------------------------------------------------------------
-// Expression
-// --------------------------------------------------------------------
-/**
-** @brief Default contructor.
-*/
-Expression::Expression()
-: m_pRoot( NULL )
-{
-}
-
-/**
-** @brief Initialising constructor. Immediatly parses and evaluates the given expression.
-*/
-Expression::Expression( const TokenExpressions& expressions )
-: m_pRoot( NULL )
-{
-	build( expressions );
-	evaluate();
-}
-
-Expression::~Expression()
-{
-	delete m_pRoot;
-}
-
-
-/**
-** @brief Get the evaluated value.
-*/
-const Expression::Value& Expression::getValue() const 
-{ 
-	assert( m_value.getType() != Expression::TYPE_UNDEFINED );
-	return m_value; 
-}
-
-
-/**
-** @brief Build up the expression tree.
-**
-**          root: value 
-**
-**          root: unary operator
-**                       right: value 
-**
-**          root: binary operator
-**     left: value       right: value
+** @brief Compile the expression.
 **
+** The infix token list is translated into a postfix program (shunting yard 
+** algorithm). For the && and || operators a conditional jump is emitted
+** after the left operand which skips the right operand if the result is
+** already known.
 */
 void Expression::build( const TokenExpressions& expressions )
 {
+	/// An operator waiting for its right operand.
+	struct PendingOperator {
+		/// The operator token (or the left parenthesis).
+		Token  m_token;
+		/// The precedence of the operator.
+		int    m_nPrecedence;
+		/// Index of the short circuit jump instruction (&& and || only).
+		size_t m_nJump;
+	};
+
 	// Local functions
-	struct InsertUnaryNode_ {
-	// Insert a value or group
-	// The value will be inserted at the most outer right operator node.
-	void operator()( Node** ppNode, Node* pValue )
+	struct EmitOperator_ {
+	// Emit the instruction(s) for an operator taken from the operator stack.
+	void operator()( Program& program, const PendingOperator& op )
 	{
-		for (;;) {
-			Node* pNode = *ppNode;
-			if ( pNode == NULL ) {
-				// The place has been found.
-				*ppNode = pValue;
-				if ( pValue->m_pParent != NULL ) {
-					assert( pValue->m_pParent->m_pRight == pValue );
-				}
-				break;
-			} else if ( pNode->m_type == NTP_OPERATOR ) {
-				pValue->m_pParent = pNode;
-				ppNode = &pNode->m_pRight;
-			} else {
-				// Right node already is a value. That means it has been populated in the 
-				// previous step i.e. the next token expected is a (binary) operator.
-				// Unexcpeted token found while parseing expression. Expected binary operator or end of expression.
-				throw sqtpp::error::C4067B();
-			}
+		if ( op.m_token == TOK_OP_LOGICAL_AND || op.m_token == TOK_OP_LOGICAL_OR ) {
+			program.emit( Instruction::OPC_BOOL );
+			program[op.m_nJump].m_operand = program.size();
+		} else if ( TokenInfo::getTokenInfo( op.m_token ).isBinaryOperator() ) {
+			program.emit( Instruction::OPC_BINARY, op.m_token );
+		} else {
+			program.emit( Instruction::OPC_UNARY, op.m_token );
 		}
-	}} insertUnaryNode;
+	}} emitOperator;
 
-	struct InsertBinaryNode_ {
-	// Insert a operator.
-	void operator()( Node** ppNode, Node* pOperator )
+	// Skip white space and comment tokens.
+	struct SkipSpace_ {
+	TokenExpressions::const_iterator operator()( TokenExpressions::const_iterator it, TokenExpressions::const_iterator end )
 	{
-		Token token                  = pOperator->m_token;
-		const TokenInfo&  tokenInfo  = TokenInfo::getTokenInfo( token );
-		const int         precedence = tokenInfo.getOperatorPrecedence();
-		for ( ;; ) {
-			Node* pNode = *ppNode;
-
-			if ( pNode == NULL ) {
-				// If iteration end at a null node the operator has to be unary.
-				// Otherwise a value or group has to be inserted first.
-				if ( !tokenInfo.isUnaryOperator() ) {
-					// Invalid expression: missing left operand for operator {1}.
-					throw sqtpp::error::C1017B( wstring() );
-				}
-				*ppNode = pOperator;
-				if ( pOperator->m_pParent != NULL ) {
-					assert( pOperator->m_pParent->m_pRight == NULL );
-					pOperator->m_pParent->m_pRight = pOperator;
-				}
+		while ( it != end ) {
+			const Token token = it->getToken();
+			if ( token != TOK_SPACE && token != TOK_BLOCK_COMMENT && token != TOK_LINE_COMMENT && token != TOK_NEW_LINE ) 
 				break;
-			} else if ( pNode->m_type != NTP_OPERATOR ) {
-				pNode->m_pParent   = pOperator;
-				pOperator->m_pLeft = pNode;
-				*ppNode = pOperator;
-				break;
-			} else {
-				Token nodeToken           = pNode->m_token;
-				const TokenInfo& nodeInfo = TokenInfo::getTokenInfo( nodeToken );
-				const int        nodePred = nodeInfo.getOperatorPrecedence();
-				if ( precedence >= nodePred ) {
-					pNode->m_pParent   = pOperator;
-					pOperator->m_pLeft = pNode;
-					*ppNode            = pOperator;
-					break;
-				} else {
-					ppNode = &pNode->m_pRight;
-				}
-			}
+			++it;
 		}
-	}} insertBinaryNode;
+		return it;
+	}} skipSpace;
 
 
 	// Methode body
 
-	std::stack<Node*> nodeStack;
+	std::vector<PendingOperator> operators;
+	Program*                     pProgram           = new Program();
+	Program&                     program            = *pProgram;
+	bool                         bExpectOperator    = false;
+	bool                         bIsDefinedOperator = false;
+	const TokenExpressions::const_iterator itEnd    = expressions.end();
 
-	delete m_pRoot;
-	m_pRoot = NULL;
-	try {
-		bool bExpectOperator    = false;
-		bool bIsDefinedOperator = false;
+	delete m_pProgram;
+	m_pProgram = NULL;
 
+	try {
 		if ( expressions.size() > 0 ) {
 			// Check if this is a "#ifdef or #if defined()" expression
 			// This check is only done to suppress the warning "found identifier in calculated expression"
@@ -522,14 +442,13 @@ void Expression::build( const TokenExpressions& expressions )
 			}
 		}
 
-		for ( TokenExpressions::const_iterator  it = expressions.begin(); it != expressions.end(); ++it ) {
+		for ( TokenExpressions::const_iterator  it = expressions.begin(); it != itEnd; ++it ) {
 			const TokenExpression& tokenExpression = *it;
 			const wstring&         tokenText       = tokenExpression.getText();
 			Token                  token           = tokenExpression.getToken();
 			const TokenInfo&       tokenInfo       = TokenInfo::getTokenInfo( token );
 			bool   bIsOperator     = tokenInfo.isOperator();
 			size_t nTextLength     = tokenText.length();
-			Node*  pNode           = NULL;
 
 			if ( bIsOperator ) {
 				bool  bIsUnaryOperator  = tokenInfo.isUnaryOperator();
@@ -558,14 +477,56 @@ void Expression::build( const TokenExpressions& expressions )
 						throw error::C1017B( tokenExpression.getText() );
 					} 
 				}
-				pNode = new Node();
-				pNode->m_type      = NTP_OPERATOR;
-				pNode->m_token     = token;
+
+				if ( token == TOK_OP_DEFINED ) {
+					// defined identifier or defined( identifier ) (the identifier may be enclosed in any number of parentheses)
+					TokenExpressions::const_iterator itNext = skipSpace( it + 1, itEnd );
+					size_t nParentheses = 0;
+					while ( itNext != itEnd && itNext->getToken() == TOK_LEFT_PARENTHESIS ) {
+						++nParentheses;
+						itNext = skipSpace( itNext + 1, itEnd );
+					}
+					if ( itNext != itEnd && itNext->getToken() == TOK_IDENTIFIER ) {
+						TokenExpressions::const_iterator itLast   = itNext;
+						size_t                           nClosed  = 0;
+						while ( nClosed < nParentheses ) {
+							TokenExpressions::const_iterator itClose = skipSpace( itLast + 1, itEnd );
+							if ( itClose == itEnd || itClose->getToken() != TOK_RIGHT_PARENTHESIS ) 
+								break;
+							itLast = itClose;
+							++nClosed;
+						}
+						if ( nClosed == nParentheses ) {
+							program.m_identifiers.push_back( itNext->getText() );
+							program.emit( Instruction::OPC_DEFINED, token, program.m_identifiers.size() - 1 );
+							bExpectOperator = true;
+							it = itLast;
+							continue;
+						}
+					}
+				}
+
+				PendingOperator op;
+				op.m_token       = token;
+				op.m_nPrecedence = TokenInfo::getTokenInfo( token ).getOperatorPrecedence();
+				op.m_nJump       = 0;
+
 				if ( bIsBinaryOperator ) {
-					insertBinaryNode( &m_pRoot, pNode );
-				} else {
-					insertUnaryNode( &m_pRoot, pNode );
+					// Emit all operators binding at least as strong as this one (left associative).
+					while ( operators.size() > 0 ) {
+						const PendingOperator& top = operators.back();
+						if ( top.m_token == TOK_LEFT_PARENTHESIS || top.m_nPrecedence > op.m_nPrecedence ) 
+							break;
+						emitOperator( program, top );
+						operators.pop_back();
+					}
+					if ( token == TOK_OP_LOGICAL_AND ) {
+						op.m_nJump = program.emit( Instruction::OPC_JUMP_IF_FALSE );
+					} else if ( token == TOK_OP_LOGICAL_OR ) {
+						op.m_nJump = program.emit( Instruction::OPC_JUMP_IF_TRUE );
+					}
 				}
+				operators.push_back( op );
 			} else {
 				switch ( token ) {
 				case TOK_SPACE:
@@ -575,21 +536,17 @@ void Expression::build( const TokenExpressions& expressions )
 					// ignore
 					break;
 				case TOK_IDENTIFIER:
-					if ( !bIsDefinedOperator ) {
-						wclog << L"Warning: found identifier " << tokenExpression.getText() 
-						      << L" in calculated expression." << endl;
-					}
-
 					if ( bExpectOperator ) {
 						// Unexcpeted token found while parseing expression. Expected operator or end of expression.
 						throw error::C4067B();
 					}
-					pNode = new Node();
-					pNode->m_type    = Expression::NTP_VALUE;
-					pNode->m_token   = token;
-					//pNode->m_value   = Value( Expression::TYPE_IDENTIFIER, wstring() );
-					pNode->m_value   = Value( Expression::TYPE_IDENTIFIER, tokenExpression.getText() );
-					insertUnaryNode( &m_pRoot, pNode );
+					if ( bIsDefinedOperator ) {
+						program.emit( Instruction::OPC_PUSH, token, 0 );
+					} else {
+						// Integer constant macros are resolved when evaluating the expression.
+						program.m_identifiers.push_back( tokenText );
+						program.emit( Instruction::OPC_IDENTIFIER, token, program.m_identifiers.size() - 1 );
+					}
 					bExpectOperator = true;
 					break;
 				case TOK_NUMBER:
@@ -597,41 +554,45 @@ void Expression::build( const TokenExpressions& expressions )
 						// Unexcpeted token found while parseing expression. Expected operator or end of expression.
 						throw error::C4067B();
 					}
-					pNode = new Node();
-					pNode->m_type    = Expression::NTP_VALUE;
-					pNode->m_token   = token;
-					pNode->m_value   = Value( Expression::TYPE_INTEGER, tokenExpression.getText() );
-					pNode->m_pParent = m_pRoot;
-					insertUnaryNode( &m_pRoot, pNode );
+					program.emit( Instruction::OPC_PUSH, token, Value( Expression::TYPE_INTEGER, tokenText ).getInteger() );
 					bExpectOperator = true;
 					break;
 				case TOK_LEFT_PARENTHESIS:
-					nodeStack.push( m_pRoot );
-					m_pRoot = NULL;
+					if ( bExpectOperator ) {
+						// Unexcpeted token found while parseing expression. Expected operator or end of expression.
+						throw error::C4067B();
+					} else {
+						PendingOperator op;
+						op.m_token       = token;
+						op.m_nPrecedence = 0;
+						op.m_nJump       = 0;
+						operators.push_back( op );
+					}
 					break;
 				case TOK_RIGHT_PARENTHESIS:
-					if ( nodeStack.size() > 0 ) {
-						pNode   = m_pRoot;
-						if ( pNode == NULL ) {
-							// Expression is empty.
-							throw error::C1017C();
+					for (;;) {
+						if ( operators.size() == 0 ) {
+							// Unmatched parenthesis.
+							throw error::C1012();
 						}
-						m_pRoot = nodeStack.top();
-						nodeStack.pop();
-						Node* pGroup = new Node();
-						pGroup->m_type   = Expression::NTP_OPERATOR;
-						pGroup->m_token  = token;
-						pGroup->m_pRight = pNode;
-
-						pNode->m_pParent = pGroup;
-						insertUnaryNode( &m_pRoot, pGroup );
-						bExpectOperator = true;
-					} else {
-						// Unmatched parenthesis.
-						throw error::C1012();
+						const PendingOperator& top = operators.back();
+						if ( top.m_token == TOK_LEFT_PARENTHESIS ) {
+							operators.pop_back();
+							break;
+						}
+						emitOperator( program, top );
+						operators.pop_back();
+					}
+					if ( !bExpectOperator ) {
+						// Expression is empty.
+						throw error::C1017C();
 					}
 					break;
 				case TOK_STRING:
+					if ( bExpectOperator ) {
+						// Unexcpeted token found while parseing expression. Expected operator or end of expression.
+						throw error::C4067B();
+					}
 					// Translate string to integer (Byte wise)
 					if ( nTextLength > 6 ) {
 						throw error::C2015( tokenExpression.getText() );
@@ -642,17 +603,12 @@ void Expression::build( const TokenExpressions& expressions )
 							value = value << 16;
 							value = value | (unsigned short)wc;
 						}
-						pNode = new Node();
-						pNode->m_type    = Expression::NTP_VALUE;
-						pNode->m_token   = token;
-						pNode->m_value   = Value( value );
-						pNode->m_pParent = m_pRoot;
-						insertUnaryNode( &m_pRoot, pNode );
+						program.emit( Instruction::OPC_PUSH, token, value );
 						bExpectOperator = true;
 					}
 					break;
 				default:
- 					if ( bExpectOperator ) {
+	 				if ( bExpectOperator ) {
 						// Unexcpeted token found while parseing expression. Expected operator or end of expression.
 						throw error::C4067B();
 					} else {
@@ -663,32 +619,117 @@ void Expression::build( const TokenExpressions& expressions )
 			}
 		}
 
-		if ( nodeStack.size() > 0 ) {
-			// Unmatched parenthesis.
-			throw error::C1012();
+		while ( operators.size() > 0 ) {
+			const PendingOperator& top = operators.back();
+			if ( top.m_token == TOK_LEFT_PARENTHESIS ) {
+				// Unmatched parenthesis.
+				throw error::C1012();
+			}
+			emitOperator( program, top );
+			operators.pop_back();
+		}
+
+		if ( program.size() > 0 && !bExpectOperator ) {
+			// Operator without (right) operand.
+			throw error::C1017C();
 		}
+
 	}
 	catch ( ... ) {
-		while ( nodeStack.size() > 0 ) {
-			Node* pTopNode = nodeStack.top();
-			delete pTopNode;
-			nodeStack.pop();
-		}
+		delete pProgram;
 		throw;
 	}
+
+	m_pProgram = pProgram;
 }
 
 
 /**
-** @brief Evaluate the expression tree.
+** @brief Get the value of an identifier found in the expression.
+**
+** @returns The value of the macro if it is an integer constant macro. Zero otherwise
+**          (undefined identifiers evaluate to zero).
+*/
+long long int Expression::evaluateIdentifier( const std::wstring& identifier, const MacroSet* pMacros )
+{
+	if ( pMacros != NULL ) {
+		MacroSet::const_iterator itMacro = pMacros->find( identifier );
+		if ( itMacro != pMacros->end() && itMacro->second.hasConstantValue() ) {
+			const Macro& macro = itMacro->second;
+			return macro.getConstantValue();
+		}
+	}
+	wclog << L"Warning: found identifier " << identifier
+	      << L" in calculated expression." << endl;
+	return 0;
+}
+
+/**
+** @brief Evaluate the compiled expression.
 */
 const Expression::Value& Expression::evaluate( const MacroSet* pMacros /* = NULL */ )
 {
-	if ( m_pRoot != NULL ) {
-		m_value = m_pRoot->evaluate( pMacros );
-	} else {
+	if ( m_pProgram == NULL || m_pProgram->size() == 0 ) {
 		m_value = Value();
+		return m_value;
+	}
+
+	const Program&     program = *m_pProgram;
+	const size_t       nSize   = program.size();
+	long long int*     pStack  = &m_pProgram->m_stack[0];
+	size_t             nTop    = 0;
+	size_t             nNext   = 0;
+
+	while ( nNext < nSize ) {
+		const Instruction& instruction = program[nNext++];
+
+		switch ( instruction.m_opCode ) {
+			case Instruction::OPC_PUSH:
+				pStack[nTop++] = instruction.m_operand;
+				break;
+			case Instruction::OPC_DEFINED:
+				if ( pMacros == NULL ) {
+					pStack[nTop++] = 0;
+				} else {
+					const wstring& identifier = program.m_identifiers[(size_t)instruction.m_operand];
+					pStack[nTop++] = pMacros->count( identifier ) != 0;
+				}
+				break;
+			case Instruction::OPC_IDENTIFIER:
+				pStack[nTop++] = evaluateIdentifier( program.m_identifiers[(size_t)instruction.m_operand], pMacros );
+				break;
+			case Instruction::OPC_UNARY:
+				pStack[nTop - 1] = evaluateOperator( 0, pStack[nTop - 1], instruction.m_token );
+				break;
+			case Instruction::OPC_BINARY:
+				--nTop;
+				pStack[nTop - 1] = evaluateOperator( pStack[nTop - 1], pStack[nTop], instruction.m_token );
+				break;
+			case Instruction::OPC_JUMP_IF_FALSE:
+				if ( pStack[nTop - 1] == 0 ) {
+					nNext = (size_t)instruction.m_operand;
+				} else {
+					--nTop;
+				}
+				break;
+			case Instruction::OPC_JUMP_IF_TRUE:
+				if ( pStack[nTop - 1] != 0 ) {
+					pStack[nTop - 1] = 1;
+					nNext = (size_t)instruction.m_operand;
+				} else {
+					--nTop;
+				}
+				break;
+			case Instruction::OPC_BOOL:
+				pStack[nTop - 1] = pStack[nTop - 1] != 0;
+				break;
+			default:
+				throw UnexpectedSwitchError();
+		}
 	}
+	assert( nTop == 1 );
+
+	m_value = Value( pStack[0] );
 
 	return m_value;
 }
@@ -19,6 +19,14 @@ class MacroSet;
 class TokenExpression;
 class TokenExpressions;
 
+/**
+** @brief Parser and evaluator of integer expressions (\#if, \#elif and __EVAL).
+**
+** The token list is compiled into a flat postfix program which is 
+** evaluated on a simple value stack. The logical operators && and || 
+** are evaluated short circuit i.e. the right operand is not evaluated
+** if the result is already determined by the left operand.
+*/
 class Expression
 {
 public:
@@ -64,24 +72,28 @@ public:
 		Expression::Type    getType() const throw()       { return m_type; }
 		long long int       getInteger() const throw()    { return m_integer; }
 		const wstring&      getIdentifier() const throw() { return m_identifier; }
-
-		void                evaluate( const Value& value,  Token opToken );
-		void                evaluate( const Value& lValue, const Value& rValue, Token opToken );
-		void                evaluateDefined( const Value& value, const MacroSet* pMacros );
 	};
 
 private:
-	enum   NodeType;
-	struct Node;
+	struct Instruction;
+	class  Program;
 
-	/// The root node of the expression tree.
-	Node* m_pRoot;
+	/// The compiled (postfix) expression.
+	Program* m_pProgram;
 
 	/// Once evaluated the expression value.
 	Value m_value;
 
-	/// Evaluate the expression tree.
-	const Value& evaluateNode( Node* ) const;
+	// Evaluate an unary or binary operator.
+	static long long int evaluateOperator( long long int lInteger, long long int rInteger, Token opToken );
+
+	// Get the value of an identifier (integer constant macro).
+	static long long int evaluateIdentifier( const std::wstring& identifier, const MacroSet* pMacros );
+
+	// Copy constructor (not implemented).
+	Expression( const Expression& that );
+	// Assignment operator (not implemented).
+	Expression& operator=( const Expression& that );
 
 public:
 	// Default constructor.
@@ -94,10 +106,10 @@ public:
 	// Get the evaluated value.
 	const Value& getValue() const;
 
-	// Build up the expression tree 
+	// Compile the expression.
 	void build( const TokenExpressions& expressions );
 
-	// Evaluate the expression tree.
+	// Evaluate the compiled expression.
 	const Value& evaluate( const MacroSet* pMacros = NULL );
 };
 
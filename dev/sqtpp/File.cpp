@@ -14,6 +14,7 @@
 #include "Util.h"
 #include "Range.h"
 #include "File.h"
+#include "FilePrefetcher.h"
 #include "Windows.h"
 
 namespace sqtpp 
@@ -41,6 +42,9 @@ struct File::Data {
 	/// The full qualified path of the input file.
 	std::wstring    m_absolutePath;
 
+	/// The path formatted as string literal (expansion of __FILE__).
+	std::wstring    m_pathLiteral;
+
 	/// The default new line characters in this file.
 	std::wstring    m_sDefaultNewline;
 
@@ -79,6 +83,10 @@ struct File::Data {
 	Token           m_fourthToken;
 	/// The last (non white space) token encountered in this file.
 	Token           m_lastToken;
+	/// The identifier of the second token (the macro tested by an include guard).
+	wstring         m_sSecondIdentifier;
+	/// The identifier of the fourth token (the macro defined by an include guard).
+	wstring         m_sFourthIdentifier;
 
 	/// Construtor.
 	Data()
@@ -236,6 +244,27 @@ const wstring& File::getPath() const throw()
 }
 
 
+/**
+** @brief Get the file path formatted as string literal.
+**
+** The literal is empty until it has been set by the first expansion 
+** of the __FILE__ macro.
+*/
+const wstring& File::getPathLiteral() const throw()
+{
+	return m_pData->m_pathLiteral;
+}
+
+
+/**
+** @brief Set the file path formatted as string literal.
+*/
+void File::setPathLiteral( const wstring& sPathLiteral ) const
+{
+	m_pData->m_pathLiteral = sPathLiteral;
+}
+
+
 /**
 ** @brief Get the default new line charactes.
 */
@@ -315,6 +344,15 @@ void File::incLine()
 	m_pData->m_nLineColumn = 1;
 }
 
+/**
+** @brief Set the current line number (resetting the column to one).
+*/
+void File::setLine( size_t nLine ) throw()
+{
+	m_pData->m_nLineNumber = nLine;
+	m_pData->m_nLineColumn = 1;
+}
+
 /**
 ** @brief Get the current column.
 */
@@ -341,11 +379,27 @@ int File::getNextCounter() const throw()
 	return cntr;
 }
 
+/**
+** @brief Get the value the __COUNTER__ macro expands to next.
+*/
+int File::getCounter() const throw()
+{
+	return m_pData->m_nCounter;
+}
+
+/**
+** @brief Set the value the __COUNTER__ macro expands to next.
+*/
+void File::setCounter( int nCounter ) throw()
+{
+	m_pData->m_nCounter = nCounter;
+}
+
 
 /**
 ** @brief Set the last (non white space) token found by the processor.
 */
-void File::setLastToken( Token token, const Range& tokenRange )
+void File::setLastToken( Token token, const Range& tokenRange, const wstring& sIdentifier )
 {
 	bool isWhite = token == TOK_BLOCK_COMMENT
 		|| token == TOK_LINE_COMMENT
@@ -360,10 +414,12 @@ void File::setLastToken( Token token, const Range& tokenRange )
 			m_pData->m_firstToken = token;
 		} else if ( m_pData->m_secondToken == TOK_UNDEFINED ) {
 			m_pData->m_secondToken = token;
+			m_pData->m_sSecondIdentifier = sIdentifier;
 		} else if ( m_pData->m_thirdToken == TOK_UNDEFINED ) {
 			m_pData->m_thirdToken = token;
 		} else if ( m_pData->m_fourthToken == TOK_UNDEFINED ) {
 			m_pData->m_fourthToken = token;
+			m_pData->m_sFourthIdentifier = sIdentifier;
 		}
 		m_pData->m_lastToken = token;
 	}
@@ -385,6 +441,23 @@ bool File::isAutoIncludedOnce()
 		&& m_pData->m_lastToken   == TOK_DIR_ENDIF;
 }
 
+/**
+** @brief Get the include guard macro of a file recognized by #isAutoIncludedOnce.
+**
+** @returns The identifier of the macro tested by \#ifndef and defined by \#define
+** or an empty string if the file has no include guard.
+*/
+const wstring& File::getIncludeGuard()
+{
+	static const wstring sNoGuard;
+
+	if ( isAutoIncludedOnce() && m_pData->m_sSecondIdentifier == m_pData->m_sFourthIdentifier ) {
+		return m_pData->m_sSecondIdentifier;
+	} else {
+		return sNoGuard;
+	}
+}
+
 
 
 /**
@@ -586,8 +659,9 @@ const wstring File::checkFile( const wstring& filePath ) /* throw( Error ) */
 ** 
 ** @param fileName The file path.
 ** @param defaultCodePageId The default code page for files having no bom at their beginning.
+** @param pPrefetcher If not NULL the file content is fetched from the prefetcher.
 */
-std::wistream& File::open( const std::wstring& fileName )
+std::wistream& File::open( const std::wstring& fileName, FilePrefetcher* pPrefetcher )
 {
 	if ( m_pData->m_pExternalStream ) {
 		throw LogicError( "File already open" );
@@ -596,39 +670,29 @@ std::wistream& File::open( const std::wstring& fileName )
 	// Check if the exists and is accessable.
 	wstring sFullPath = checkFile( fileName );
 
+	// Read the file once: The code page is detected by the byte order mark
+	// in the memory read and the same bytes are decoded.
 	const CodePageId defaultCodePageId = CodePageInfo::getDefaultCodePageId();
-	const CodePageInfo* const pCodePage = CodePageDetection::detectCodePage( fileName, defaultCodePageId );
-	const CodePageId codePageId = pCodePage->getCodePageId();
+	FileContentStream* pInnerStream = new FileContentStream();
+	const CodePageInfo* const pCodePage = pPrefetcher != NULL 
+	                                    ? pPrefetcher->fetch( sFullPath, *pInnerStream ) 
+	                                    : pInnerStream->open( fileName, defaultCodePageId );
+	if ( pCodePage == NULL ) {
+		delete pInnerStream;
+		// Unable to open file {1}.
+		throw error::C1068( sFullPath );
+	}
 
+	const CodePageId codePageId = pCodePage->getCodePageId();
 	if ( codePageId == CPID_UTF32 || codePageId == CPID_UTF32BE ) {
+		delete pInnerStream;
 		//throw NotSupportedError( "The code page is not supported" );
 		throw NotSupportedError();
 	}
 
-	std::wifstream* pInnerStream = new std::wifstream();
-	const locale& fileLocale = pCodePage->getLocale();
-	pInnerStream->imbue( fileLocale ) ;
-	pInnerStream->open( fileName.c_str(), std::ios_base::in | std::ios_base::binary, _SH_DENYWR );
-	if ( pInnerStream->fail() ) {
-		// Unable to open file {1}.
-		throw error::C1068( sFullPath );
-	}
-
-	const char* fileBom = pCodePage->getFileBom();
-	if ( fileBom != NULL ) {
-		size_t bomLength = strlen( fileBom );
-		pInnerStream->rdbuf()->pubseekpos( bomLength );
-	}
 	attach( *pInnerStream );
 
 
-#	ifdef _DEBUG
-	const locale locCheck = pInnerStream->rdbuf()->getloc();
-	const string locName = locCheck.name();
-	assert( locName == fileLocale.name() );
-#	endif
-
-
 	m_pData->m_relativePath = fileName;
 	m_pData->m_absolutePath = sFullPath;
 	m_pData->m_isAttached   = false;
@@ -647,6 +711,40 @@ std::wistream& File::getStream()
 	return *m_pData->m_pExternalStream;
 }
 
+/**
+** @brief Read the remaining content of the file at once.
+**
+** @param content Receives the characters read.
+*/
+void File::readContent( std::wstring& content )
+{
+	std::wstreambuf* pBuffer = getStream().rdbuf();
+	wchar_t          buffer[0x1000];
+
+	content.clear();
+	for ( std::streamsize nCount = pBuffer->sgetn( buffer, 0x1000 ); nCount > 0; nCount = pBuffer->sgetn( buffer, 0x1000 ) ) {
+		content.append( buffer, size_t( nCount ) );
+	}
+}
+
+/**
+** @brief Replace the remaining content of the file.
+**
+** Used to continue reading a file whose content has been read in 
+** advance (see #readContent).
+**
+** @param content The characters to be read next. The content is swapped 
+**        into the file stream and the string passed is emptied.
+*/
+void File::setContent( std::wstring& content )
+{
+	FileContentStream* pStream = dynamic_cast<FileContentStream*>( m_pData->m_pExternalStream );
+	if ( pStream == NULL ) {
+		throw std::logic_error( "The file has not been opened." );
+	}
+	pStream->attach( content );
+}
+
 
 
 } // namespace
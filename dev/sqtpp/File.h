@@ -15,6 +15,7 @@ namespace sqtpp {
 
 class Error;
 class CodePageInfo;
+class FilePrefetcher;
 struct Range;
 enum Token;
 enum CodePageId;
@@ -66,7 +67,7 @@ public:
 	static const wstring checkFile( const wstring& filePath ) /* throw( Error ) */;
 
 	// Open the file.
-	std::wistream& open( const std::wstring& fileName );
+	std::wistream& open( const std::wstring& fileName, FilePrefetcher* pPrefetcher = NULL );
 
 	// Attach to the given wistream
 	std::wistream& attach( std::wistream& is );
@@ -77,6 +78,12 @@ public:
 	// Get the file input stream.
 	std::wistream& getStream();
 
+	// Read the remaining content of the file at once.
+	void readContent( std::wstring& content );
+
+	// Replace the remaining content of the file.
+	void setContent( std::wstring& content );
+
 	// Get the instance id
 	int getInstanceId() const throw();
 
@@ -104,6 +111,12 @@ public:
 	// Get the file path.
 	const wstring& getPath() const throw();
 
+	// Get the file path formatted as string literal (cached for the __FILE__ macro).
+	const wstring& getPathLiteral() const throw();
+
+	// Set the file path formatted as string literal.
+	void setPathLiteral( const wstring& sPathLiteral ) const;
+
 	// Get the file locale (code page).
 	const locale& getLocale() const throw();
 
@@ -122,6 +135,9 @@ public:
 	// Increment the current line number.
 	void incLine();
 
+	// Set the current line number.
+	void setLine( size_t nLine ) throw();
+
 	// Get the current column.
 	size_t getColumn() const throw();
 
@@ -131,12 +147,21 @@ public:
 	// Get the file counter (for the __COUNTER__ macro).
 	int  getNextCounter() const throw();
 
+	// Get the file counter without incrementing it.
+	int  getCounter() const throw();
+
+	// Set the file counter.
+	void setCounter( int nCounter ) throw();
+
 	// Set the last (non white space) token found by the processor.
-	void setLastToken( Token token, const Range& tokenRange );
+	void setLastToken( Token token, const Range& tokenRange, const wstring& sIdentifier );
 
 	// Check if the first, second and last (non white space) token found is a #ifndef, #define / #endif pair.
 	bool isAutoIncludedOnce();
 
+	// Get the include guard macro of a file recognized by isAutoIncludedOnce.
+	const wstring& getIncludeGuard();
+
 };
 
 /**
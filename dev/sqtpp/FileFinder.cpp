@@ -6,38 +6,202 @@
 **  2010 by SQL Service GmbH Wuppertal
 */
 #include "StdAfx.h"
+#ifdef _WIN32
+#include <Windows.h>
+#endif
 #include "File.h"
 #include "FileFinder.h"
 
 namespace sqtpp {
 
+/**
+** @brief The lock of the cache.
+*/
+struct FileFinderCache::Mutex
+{
+#ifdef _WIN32
+	/// The critical section.
+	CRITICAL_SECTION m_cs;
+#endif
+};
+
+/**
+** @brief Holds the lock of the cache for the lifetime of the instance.
+*/
+class FileFinderCache::Lock
+{
+private:
+	Mutex& m_mutex;
+
+	// Copy constructor (not implemented).
+	Lock( const Lock& that );
+	// Assignment operator (not implemented).
+	Lock& operator= ( const Lock& that );
+public:
+#ifdef _WIN32
+	Lock( Mutex& mutex ) : m_mutex( mutex ) { ::EnterCriticalSection( &m_mutex.m_cs ); }
+	~Lock() { ::LeaveCriticalSection( &m_mutex.m_cs ); }
+#else
+	Lock( Mutex& mutex ) : m_mutex( mutex ) {}
+#endif
+};
+
+
+/**
+** @brief Constructor.
+*/
+FileFinderCache::FileFinderCache()
+: m_nLookupCount( 0 )
+, m_nProbeCount( 0 )
+, m_pMutex( new Mutex() )
+{
+#ifdef _WIN32
+	::InitializeCriticalSection( &m_pMutex->m_cs );
+#endif
+}
+
+/**
+** @brief Destructor.
+*/
+FileFinderCache::~FileFinderCache() throw()
+{
+#ifdef _WIN32
+	::DeleteCriticalSection( &m_pMutex->m_cs );
+#endif
+	delete m_pMutex;
+}
+
+/**
+** @brief Remove all cached search results and reset the counters.
+*/
+void FileFinderCache::clear()
+{
+	Lock lock( *m_pMutex );
+	m_resolvedPaths.clear();
+	m_nLookupCount = 0;
+	m_nProbeCount  = 0;
+}
+
+/**
+** @brief Get the number of calls of FileFinder::findFile.
+*/
+size_t FileFinderCache::getLookupCount() const throw()
+{
+	Lock lock( *m_pMutex );
+	return m_nLookupCount;
+}
+
+/**
+** @brief Get the number of file system probes.
+*/
+size_t FileFinderCache::getProbeCount() const throw()
+{
+	Lock lock( *m_pMutex );
+	return m_nProbeCount;
+}
+
+/**
+** @brief Get the result of a previous search and count the lookup.
+**
+** @returns <code>true</code> if the key has been searched before.
+*/
+bool FileFinderCache::lookup( const std::wstring& sKey, std::wstring& sFullPath )
+{
+	Lock lock( *m_pMutex );
+	++m_nLookupCount;
+	StringDictionary::const_iterator itPath = m_resolvedPaths.find( sKey );
+	if ( itPath == m_resolvedPaths.end() ) {
+		return false;
+	}
+	sFullPath = itPath->second;
+	return true;
+}
+
+/**
+** @brief Store the result of a search.
+*/
+void FileFinderCache::store( const std::wstring& sKey, const std::wstring& sFullPath, size_t nProbeCount )
+{
+	Lock lock( *m_pMutex );
+	m_resolvedPaths[sKey] = sFullPath;
+	m_nProbeCount+= nProbeCount;
+}
+
 
-FileFinder::FileFinder( const std::vector<wstring>& includeDirectories )
+FileFinder::FileFinder( const std::vector<wstring>& includeDirectories, FileFinderCache* pCache /* = NULL */ )
 : includeDirectories( includeDirectories )
 , bFindInCurrentDirectory( false )
+, pCache( pCache )
 {
 }
 
-FileFinder::FileFinder( const std::vector<wstring>& includeDirectories, const std::wstring& currentFilePath )
+FileFinder::FileFinder( const std::vector<wstring>& includeDirectories, const std::wstring& currentFilePath, FileFinderCache* pCache /* = NULL */ )
 : includeDirectories( includeDirectories )
 , currentFileDirectory( File::getDirectory( currentFilePath ) )
 , bFindInCurrentDirectory( true )
+, pCache( pCache )
 {
 }
 
+/**
+** @brief Find the specified file and return it's full path.
+**
+** If the finder has a cache the result of a search (including the failure
+** to find the file) is stored in the cache. The cache key is built from
+** the directory of the current file, the include directories and the 
+** requested file path.
+**
+** @returns The full path of the file or an empty string if the file wasn't found.
+*/
 std::wstring FileFinder::findFile( const wstring& filePath )
+{
+	if ( pCache == NULL ) {
+		size_t nProbeCount = 0;
+		return searchFile( filePath, nProbeCount );
+	}
+
+	wstring sKey = bFindInCurrentDirectory ? currentFileDirectory : L"<>";
+	for ( vector<wstring>::const_iterator it = includeDirectories.begin(); it != includeDirectories.end(); ++it ) {
+		sKey+= L'|';
+		sKey+= *it;
+	}
+	sKey+= L'|';
+	sKey+= filePath;
+
+	wstring sFullPath;
+	if ( pCache->lookup( sKey, sFullPath ) ) {
+		return sFullPath;
+	}
+
+	// The file system is searched without holding the lock of the cache.
+	size_t nProbeCount = 0;
+	sFullPath = searchFile( filePath, nProbeCount );
+	pCache->store( sKey, sFullPath, nProbeCount );
+	return sFullPath;
+}
+
+/**
+** @brief Search the file in the file system without using the cache.
+**
+** This method doesn't touch the cache.
+**
+** @param filePath The requested file path.
+** @param nProbeCount Incremented for each file system probe.
+** @returns The full path of the file or an empty string if the file wasn't found.
+*/
+std::wstring FileFinder::searchFile( const wstring& filePath, size_t& nProbeCount ) const
 {
 	if ( bFindInCurrentDirectory ) {
 		// Lookup relative to the directory of the current file.
 		if ( !currentFileDirectory.empty()  ) {
 			wstring sFullPath = File::getFullPath( currentFileDirectory, filePath );
-			if ( File::isFile( sFullPath ) ){
+			if ( probeFile( sFullPath, nProbeCount ) ){
 				return sFullPath;
 			}
 		}
 
 		// Lookup relative to the current working directory.
-		if ( File::isFile( filePath ) ) {
+		if ( probeFile( filePath, nProbeCount ) ) {
 			wstring sFullPath = File::getFullPath( filePath );
 			return sFullPath;
 		}
@@ -46,7 +210,7 @@ std::wstring FileFinder::findFile( const wstring& filePath )
 	for ( vector<wstring>::const_iterator it = includeDirectories.begin(); it != includeDirectories.end(); ++it ) {
 		const wstring& sDirectory = *it; 
 		const wstring  sFullPath = File::getFullPath( sDirectory, filePath );
-		if ( File::isFile( sFullPath ) ){
+		if ( probeFile( sFullPath, nProbeCount ) ){
 			return sFullPath;
 		}
 	}
@@ -54,6 +218,13 @@ std::wstring FileFinder::findFile( const wstring& filePath )
 	return wstring();
 }
 
-
+/**
+** @brief Check if a file exists and count the probe.
+*/
+bool FileFinder::probeFile( const wstring& filePath, size_t& nProbeCount )
+{
+	++nProbeCount;
+	return File::isFile( filePath );
+}
 
 }
\ No newline at end of file
@@ -13,6 +13,71 @@
 
 namespace sqtpp {
 
+class FileFinder;
+
+/**
+** @brief The results of the include file searches of one processor.
+**
+** The result of a search (including the failure to find the file) is 
+** kept until the cache is cleared. The processor clears it at the start
+** of each run because files may have been created or removed since the
+** last run. The cache is shared with the background thread of the
+** #FilePrefetcher and therefore synchronized.
+*/
+class FileFinderCache
+{
+private:
+	/// Structure of the lock of the cache.
+	struct Mutex;
+
+	/// Holds the lock of the cache for the lifetime of the instance.
+	class Lock;
+
+	/// The paths found (or empty strings for files not found) by search key.
+	StringDictionary m_resolvedPaths;
+
+	/// Number of calls of FileFinder::findFile.
+	size_t           m_nLookupCount;
+
+	/// Number of file system probes (File::isFile) done by FileFinder::findFile.
+	size_t           m_nProbeCount;
+
+	/// The lock of the members above.
+	Mutex*           m_pMutex;
+
+private:
+	/// Not implemented copy constructor.
+	FileFinderCache( const FileFinderCache& );
+	/// Not implemented assignment operator.
+	FileFinderCache& operator= ( const FileFinderCache& );
+
+public:
+	// Constructor.
+	FileFinderCache();
+
+	// Destructor.
+	~FileFinderCache() throw();
+
+	// Remove all cached search results and reset the counters.
+	void clear();
+
+	// Get the number of calls of FileFinder::findFile.
+	size_t getLookupCount() const throw();
+
+	// Get the number of file system probes.
+	size_t getProbeCount() const throw();
+
+private:
+	// Get the result of a previous search.
+	bool lookup( const std::wstring& sKey, std::wstring& sFullPath );
+
+	// Store the result of a search.
+	void store( const std::wstring& sKey, const std::wstring& sFullPath, size_t nProbeCount );
+
+friend class FileFinder;
+};
+
+
 class FileFinder
 {
 private:
@@ -26,7 +91,13 @@ private:
 	/// or in the include directories only.
 	bool bFindInCurrentDirectory;
 
+	/// The cache of the search results (NULL to search always).
+	FileFinderCache* pCache;
+
 private:
+	// Check if a file exists.
+	static bool probeFile( const std::wstring& filePath, size_t& nProbeCount );
+
 	/// Not implemented copy constructor.
 	FileFinder( const FileFinder& );
 	/// Not implemented assignment operator.
@@ -34,13 +105,17 @@ private:
 public:
 
 	/// Find files in the include directory.
-	FileFinder( const std::vector<std::wstring>& includeDirectories );
+	FileFinder( const std::vector<std::wstring>& includeDirectories, FileFinderCache* pCache = NULL );
 
 	/// File files in the include directory and additionally in the directory of the current file.
-	FileFinder( const std::vector<std::wstring>& includeDirectories, const std::wstring& currentFilePath );
+	FileFinder( const std::vector<std::wstring>& includeDirectories, const std::wstring& currentFilePath, FileFinderCache* pCache = NULL );
 
 	// Find the specified file and return it's full path.
 	std::wstring findFile( const std::wstring& filePath );
+
+private:
+	// Search the file in the file system without using the cache.
+	std::wstring searchFile( const std::wstring& filePath, size_t& nProbeCount ) const;
 };
 
 
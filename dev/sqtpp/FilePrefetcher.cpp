@@ -0,0 +1,550 @@
+/**
+** @file
+** @author Ralf Seidel
+** @brief Implementation of the #sqtpp::FilePrefetcher.
+**
+**  2010 by SQL Service GmbH Wuppertal
+*/
+#include "StdAfx.h"
+#ifdef _WIN32
+#include <Windows.h>
+#include <process.h>
+#endif
+#include "CodePage.h"
+#include "Options.h"
+#include "Streams.h"
+#include "File.h"
+#include "FileFinder.h"
+#include "FilePrefetcher.h"
+
+namespace sqtpp {
+
+/**
+** @brief The background thread and the files requested.
+*/
+struct FilePrefetcher::Data
+{
+	/// The processing state of a file requested.
+	enum State {
+		/// The file waits to be read.
+		FS_QUEUED,
+		/// The file is read by the background thread.
+		FS_LOADING,
+		/// The file content is available.
+		FS_READY,
+		/// The file content has been fetched by the processor.
+		FS_FETCHED
+	};
+
+	/**
+	** @brief A file requested.
+	*/
+	struct Entry
+	{
+		/// The processing state.
+		State               m_state;
+
+		/// Flag indicating if the processor waits for the file.
+		bool                m_bWanted;
+
+		/// The code page of the file or NULL if the file couldn't be read.
+		const CodePageInfo* m_pCodePage;
+
+		/// The decoded content.
+		std::wstring        m_content;
+
+		/// Constructor.
+		Entry()
+		: m_state( FS_QUEUED )
+		, m_bWanted( false )
+		, m_pCodePage( NULL )
+		{
+		}
+	};
+
+	/// Type definition of the files requested by full path.
+	typedef std::map<std::wstring, Entry> EntryMap;
+
+	/// The include directories.
+	const StringArray    m_includeDirectories;
+
+	/// Flag to scan for the AdSalesNG --[MODPROC] directive.
+	const bool           m_bSupportAdSalesNG;
+
+	/// The include file search results shared with the processor.
+	FileFinderCache&     m_fileFinderCache;
+
+	/// All files requested (by full path).
+	EntryMap             m_entries;
+
+	/// The paths of the files waiting to be read.
+	std::list<wstring>   m_queue;
+
+	/// The file whose includes are prefetched but which is not read in advance.
+	std::wstring         m_sRootPath;
+
+	/// The number of characters of the files ready but not yet fetched.
+	size_t               m_nContentSize;
+
+	/// Number of files read by the background thread.
+	size_t               m_nPrefetchCount;
+
+	/// Number of files whose prefetched content was fetched.
+	size_t               m_nFetchCount;
+
+	/// Number of files which were ready when fetched.
+	size_t               m_nHitCount;
+
+	/// Flag to stop the background thread.
+	bool                 m_bStop;
+
+#ifdef _WIN32
+	/// Lock of all members above.
+	CRITICAL_SECTION     m_lock;
+
+	/// Signaled whenever a file is requested, read or fetched.
+	CONDITION_VARIABLE   m_changed;
+
+	/// The background thread.
+	HANDLE               m_hThread;
+#endif
+
+	/// Constructor.
+	Data( const Options& options, FileFinderCache& fileFinderCache )
+	: m_includeDirectories( options.getIncludeDirectories() )
+	, m_bSupportAdSalesNG( options.supportAdSalesNG() )
+	, m_fileFinderCache( fileFinderCache )
+	, m_nContentSize( 0 )
+	, m_nPrefetchCount( 0 )
+	, m_nFetchCount( 0 )
+	, m_nHitCount( 0 )
+	, m_bStop( false )
+	{
+	}
+};
+
+#ifdef _WIN32
+namespace {
+
+/**
+** @brief Holds a critical section for the lifetime of the instance.
+*/
+class Lock
+{
+private:
+	CRITICAL_SECTION& m_cs;
+
+	// Copy constructor (not implemented).
+	Lock( const Lock& that );
+	// Assignment operator (not implemented).
+	Lock& operator= ( const Lock& that );
+public:
+	Lock( CRITICAL_SECTION& cs ) : m_cs( cs ) { ::EnterCriticalSection( &m_cs ); }
+	~Lock() { ::LeaveCriticalSection( &m_cs ); }
+};
+
+} // namespace
+#endif
+
+/**
+** @brief Constructor: Start the background thread.
+**
+** The include files are searched like the processor does: With the
+** include directories and the AdSalesNG option of the processor options
+** and through the search cache of the processor. The searches of the 
+** prefetcher therefore don't have to be repeated by the processor.
+**
+** @param options The processor options.
+** @param fileFinderCache The include file search cache of the processor.
+*/
+FilePrefetcher::FilePrefetcher( const Options& options, FileFinderCache& fileFinderCache )
+: m_pData( new Data( options, fileFinderCache ) )
+{
+#ifdef _WIN32
+	::InitializeCriticalSection( &m_pData->m_lock );
+	::InitializeConditionVariable( &m_pData->m_changed );
+	// Without a thread the files are read when fetched.
+	m_pData->m_hThread = (HANDLE)_beginthreadex( NULL, 0, &FilePrefetcher::threadProc, this, 0, NULL );
+#endif
+}
+
+/**
+** @brief Destructor: Stop the background thread and release the files not fetched.
+*/
+FilePrefetcher::~FilePrefetcher() throw()
+{
+#ifdef _WIN32
+	if ( m_pData->m_hThread != NULL ) {
+		{
+			Lock lock( m_pData->m_lock );
+			m_pData->m_bStop = true;
+			::WakeAllConditionVariable( &m_pData->m_changed );
+		}
+		::WaitForSingleObject( m_pData->m_hThread, INFINITE );
+		::CloseHandle( m_pData->m_hThread );
+	}
+	::DeleteCriticalSection( &m_pData->m_lock );
+#endif
+	delete m_pData;
+}
+
+/**
+** @brief Get the content of a file.
+**
+** If the file has been requested and read in advance the decoded content
+** is attached to the stream. If the file is still waiting or being read
+** it is moved to the front of the queue and the method waits for it.
+** Otherwise (e.g. if a file is included again) the stream reads the file
+** itself.
+**
+** @param sFullPath The full path of the file.
+** @param stream The stream which should read the file content.
+** @returns The code page of the file or NULL if the file cannot be read.
+*/
+const CodePageInfo* FilePrefetcher::fetch( const std::wstring& sFullPath, FileContentStream& stream )
+{
+#ifdef _WIN32
+	Data&               data      = *m_pData;
+	const CodePageInfo* pCodePage = NULL;
+	std::wstring        content;
+	bool                bFetched  = false;
+
+	if ( data.m_hThread != NULL ) {
+		Lock lock( data.m_lock );
+
+		Data::EntryMap::iterator itEntry = data.m_entries.find( sFullPath );
+		if ( itEntry == data.m_entries.end() ) {
+			itEntry = data.m_entries.insert( Data::EntryMap::value_type( sFullPath, Data::Entry() ) ).first;
+			data.m_queue.push_front( sFullPath );
+		} else if ( itEntry->second.m_state == Data::FS_QUEUED ) {
+			data.m_queue.remove( sFullPath );
+			data.m_queue.push_front( sFullPath );
+		}
+
+		Data::Entry& entry = itEntry->second;
+		if ( entry.m_state == Data::FS_READY ) {
+			++data.m_nHitCount;
+		} else if ( entry.m_state != Data::FS_FETCHED ) {
+			entry.m_bWanted = true;
+			::WakeAllConditionVariable( &data.m_changed );
+			while ( entry.m_state != Data::FS_READY ) {
+				::SleepConditionVariableCS( &data.m_changed, &data.m_lock, INFINITE );
+			}
+		}
+
+		if ( entry.m_state == Data::FS_READY ) {
+			content.swap( entry.m_content );
+			pCodePage            = entry.m_pCodePage;
+			entry.m_state        = Data::FS_FETCHED;
+			data.m_nContentSize -= content.size();
+			bFetched             = true;
+			++data.m_nFetchCount;
+			::WakeAllConditionVariable( &data.m_changed );
+		}
+	}
+
+	if ( bFetched && pCodePage != NULL ) {
+		stream.attach( content );
+		return pCodePage;
+	}
+#endif
+	// Not prefetched or the file couldn't be read: Read the file
+	// (again) to report errors the usual way.
+	return stream.open( sFullPath, CodePageInfo::getDefaultCodePageId() );
+}
+
+/**
+** @brief Prefetch the includes of a file read by the processor itself.
+**
+** The file is scanned by the background thread whenever no include file
+** is waiting to be read. Its content is decoded block by block and
+** dropped after scanning so the processor doesn't wait for the file
+** and the file isn't held in memory twice.
+**
+** @param sFullPath The full path of the file.
+*/
+void FilePrefetcher::prefetchIncludes( const std::wstring& sFullPath )
+{
+#ifdef _WIN32
+	Data& data = *m_pData;
+
+	if ( data.m_hThread != NULL ) {
+		Lock lock( data.m_lock );
+		data.m_sRootPath = sFullPath;
+		::WakeAllConditionVariable( &data.m_changed );
+	}
+#endif
+}
+
+/**
+** @brief Get the number of files read by the background thread.
+*/
+size_t FilePrefetcher::getPrefetchCount() const throw()
+{
+#ifdef _WIN32
+	Lock lock( m_pData->m_lock );
+#endif
+	return m_pData->m_nPrefetchCount;
+}
+
+/**
+** @brief Get the number of files whose prefetched content was fetched by the processor.
+*/
+size_t FilePrefetcher::getFetchCount() const throw()
+{
+#ifdef _WIN32
+	Lock lock( m_pData->m_lock );
+#endif
+	return m_pData->m_nFetchCount;
+}
+
+/**
+** @brief Get the number of files which were ready when the processor fetched them.
+*/
+size_t FilePrefetcher::getHitCount() const throw()
+{
+#ifdef _WIN32
+	Lock lock( m_pData->m_lock );
+#endif
+	return m_pData->m_nHitCount;
+}
+
+/**
+** @brief The background thread procedure.
+*/
+unsigned __stdcall FilePrefetcher::threadProc( void* pPrefetcher )
+{
+	static_cast<FilePrefetcher*>( pPrefetcher )->run();
+	return 0;
+}
+
+/**
+** @brief Read the files requested until the prefetcher is stopped.
+**
+** The files are read in the order of the queue. The includes found in a
+** file are put in front of the queue because the processor will need them
+** before the files requested earlier. Files not wanted yet are not read
+** if the content of the files not yet fetched exceeds PREFETCH_LIMIT.
+** The root file is scanned for the next block of includes whenever the
+** queue is empty.
+*/
+void FilePrefetcher::run()
+{
+#ifdef _WIN32
+	Data& data = *m_pData;
+
+	// The root file scanned and the stream decoding it.
+	std::wstring       sRootPath;
+	FileContentBuffer  rootBuffer;
+	std::wistream      rootStream( &rootBuffer );
+
+	for ( ;; ) {
+		Data::Entry* pEntry    = NULL;
+		bool         bScanRoot = false;
+		std::wstring sFilePath;
+		{
+			Lock lock( data.m_lock );
+			for ( ;; ) {
+				if ( data.m_bStop ) {
+					return;
+				}
+				if ( !data.m_queue.empty() ) {
+					pEntry = &data.m_entries[data.m_queue.front()];
+					if ( pEntry->m_bWanted || data.m_nContentSize < PREFETCH_LIMIT ) {
+						break;
+					}
+				} else if ( !data.m_sRootPath.empty() ) {
+					bScanRoot = true;
+					break;
+				}
+				::SleepConditionVariableCS( &data.m_changed, &data.m_lock, INFINITE );
+			}
+			if ( bScanRoot ) {
+				sFilePath = data.m_sRootPath;
+			} else {
+				sFilePath = data.m_queue.front();
+				data.m_queue.pop_front();
+				pEntry->m_state = Data::FS_LOADING;
+			}
+		}
+
+		std::wstring content;
+		StringArray  includeFiles;
+		if ( bScanRoot ) {
+			// Scan the next block of complete lines of the root file.
+			bool bDone = true;
+			try {
+				if ( sFilePath != sRootPath ) {
+					sRootPath = sFilePath;
+					rootStream.clear();
+					if ( rootBuffer.open( sRootPath.c_str(), CodePageInfo::getDefaultCodePageId() ) == NULL ) {
+						rootStream.setstate( std::ios_base::failbit );
+					}
+				}
+				std::wstring line;
+				while ( content.length() < SCAN_BLOCK_SIZE && std::getline( rootStream, line ) ) {
+					content+= line;
+					content+= L'\n';
+				}
+				scan( sRootPath, content, includeFiles );
+				bDone = !rootStream.good();
+			}
+			catch ( ... ) {
+				// Just don't prefetch the remaining includes.
+			}
+			if ( bDone ) {
+				rootBuffer.close();
+			}
+
+			Lock lock( data.m_lock );
+			for ( StringArray::const_iterator it = includeFiles.begin(); it != includeFiles.end(); ++it ) {
+				const wstring& sIncludePath = *it;
+				if ( data.m_entries.count( sIncludePath ) == 0 ) {
+					data.m_entries[sIncludePath] = Data::Entry();
+					data.m_queue.push_back( sIncludePath );
+				}
+			}
+			if ( bDone && data.m_sRootPath == sRootPath ) {
+				data.m_sRootPath.clear();
+			}
+			::WakeAllConditionVariable( &data.m_changed );
+			continue;
+		}
+
+		const CodePageInfo* pCodePage = load( sFilePath, content );
+		if ( pCodePage != NULL ) {
+			try {
+				scan( sFilePath, content, includeFiles );
+			}
+			catch ( ... ) {
+				// Just don't prefetch the includes.
+			}
+		}
+
+		{
+			Lock lock( data.m_lock );
+			pEntry->m_content.swap( content );
+			pEntry->m_pCodePage  = pCodePage;
+			pEntry->m_state      = Data::FS_READY;
+			data.m_nContentSize += pEntry->m_content.size();
+			++data.m_nPrefetchCount;
+
+			std::list<wstring>::iterator itPos = data.m_queue.begin();
+			for ( StringArray::const_iterator it = includeFiles.begin(); it != includeFiles.end(); ++it ) {
+				const wstring& sIncludePath = *it;
+				if ( data.m_entries.count( sIncludePath ) == 0 ) {
+					data.m_entries[sIncludePath] = Data::Entry();
+					data.m_queue.insert( itPos, sIncludePath );
+				}
+			}
+			::WakeAllConditionVariable( &data.m_changed );
+		}
+	}
+#endif
+}
+
+/**
+** @brief Read and decode a file.
+**
+** @param sFullPath The full path of the file.
+** @param content Receives the decoded content.
+** @returns The code page of the file or NULL if the file couldn't be read or decoded.
+*/
+const CodePageInfo* FilePrefetcher::load( const std::wstring& sFullPath, std::wstring& content ) throw()
+{
+	try {
+		FileContentBuffer   buffer;
+		const CodePageInfo* pCodePage = buffer.open( sFullPath.c_str(), CodePageInfo::getDefaultCodePageId() );
+		if ( pCodePage != NULL ) {
+			buffer.decodeAll( content );
+		}
+		return pCodePage;
+	}
+	catch ( ... ) {
+		content.clear();
+		return NULL;
+	}
+}
+
+/**
+** @brief Scan the content of a file for include directives and resolve the files.
+**
+** Only directives at the beginning of a line (after blanks) are recognized:
+** <code>\#include "file"</code>, <code>\#include &lt;file&gt;</code> and
+** <code>--[MODPROC] name</code> (if AdSalesNG is supported).
+**
+** @param sFilePath The full path of the file scanned.
+** @param content The decoded content of the file.
+** @param includeFiles Receives the full paths of the files found.
+*/
+void FilePrefetcher::scan( const std::wstring& sFilePath, const std::wstring& content, StringArray& includeFiles ) const
+{
+	const StringArray& includeDirectories = m_pData->m_includeDirectories;
+	FileFinder         localFileFinder( includeDirectories, sFilePath, &m_pData->m_fileFinderCache );
+	FileFinder         sysFileFinder( includeDirectories, &m_pData->m_fileFinderCache );
+
+	// The content is terminated by a null character.
+	const wchar_t* p    = content.c_str();
+	const wchar_t* pEnd = p + content.length();
+	while ( p < pEnd ) {
+		while ( *p == L' ' || *p == L'\t' ) {
+			++p;
+		}
+
+		wstring sIncludePath;
+		bool    bIsSysInclude = false;
+		if ( *p == L'#' ) {
+			++p;
+			while ( *p == L' ' || *p == L'\t' ) {
+				++p;
+			}
+			if ( wcsncmp( p, L"include", 7 ) == 0 ) {
+				p+= 7;
+				while ( *p == L' ' || *p == L'\t' ) {
+					++p;
+				}
+				if ( *p == L'"' || *p == L'<' ) {
+					const wchar_t  chClose = *p == L'"' ? L'"' : L'>';
+					const wchar_t* pName = ++p;
+					while ( *p != chClose && *p != L'\n' && *p != L'\r' && *p != L'\0' ) {
+						++p;
+					}
+					if ( *p == chClose && p > pName ) {
+						sIncludePath.assign( pName, p );
+						bIsSysInclude = chClose == L'>';
+					}
+				}
+			}
+		} else if ( m_pData->m_bSupportAdSalesNG && wcsncmp( p, L"--[MODPROC]", 11 ) == 0 ) {
+			p+= 11;
+			while ( *p == L' ' || *p == L'\t' ) {
+				++p;
+			}
+			const wchar_t* pName = p;
+			while ( iswalnum( *p ) || *p == L'_' ) {
+				++p;
+			}
+			if ( p > pName ) {
+				sIncludePath.assign( pName, p );
+				sIncludePath+= L".syb";
+			}
+		}
+
+		if ( !sIncludePath.empty() ) {
+			FileFinder& fileFinder = bIsSysInclude ? sysFileFinder : localFileFinder;
+			wstring sFullPath = fileFinder.findFile( sIncludePath );
+			if ( !sFullPath.empty() ) {
+				// The processor fetches the files by the path returned by File::checkFile.
+				includeFiles.push_back( File::getFullPath( sFullPath ) );
+			}
+		}
+
+		// Continue with the next line.
+		while ( p < pEnd && *p != L'\n' ) {
+			++p;
+		}
+		++p;
+	}
+}
+
+} // namespace sqtpp
@@ -0,0 +1,93 @@
+/**
+** @file
+** @author Ralf Seidel
+** @brief Declaration of the #sqtpp::FilePrefetcher.
+**
+**  2010 by SQL Service GmbH Wuppertal
+*/
+#ifndef SQTPP_FILE_PREFETCHER_H
+#define SQTPP_FILE_PREFETCHER_H
+#if _MSC_VER > 10
+#pragma once
+#endif
+
+namespace sqtpp {
+
+class CodePageInfo;
+class FileContentStream;
+class FileFinderCache;
+class Options;
+
+/**
+** @brief Reads and decodes include files on a background thread.
+**
+** The content of each file read is scanned for \#include and
+** --[MODPROC] directives at the beginning of a line. The files
+** found are read and decoded on the background thread so they
+** are (hopefully) ready when the processor reaches the directive.
+** The root file is read by the processor itself: The background
+** thread only scans it block by block without keeping its content.
+** The scan is cheap: Directives within comments, skipped blocks
+** or with macro arguments are not recognized or prefetched in vain.
+*/
+class FilePrefetcher
+{
+private:
+	// Structure of the prefetcher data (the background thread and the files requested).
+	struct Data;
+
+	// The prefetcher data.
+	Data* m_pData;
+
+	// The maximal number of characters kept for files which are not yet fetched.
+	enum { PREFETCH_LIMIT = 0x1000000 };
+
+	// The number of characters of the root file scanned at once.
+	enum { SCAN_BLOCK_SIZE = 0x4000 };
+
+private:
+	// Copy constructor (not implemented).
+	FilePrefetcher( const FilePrefetcher& that );
+
+	// Assignment operator (not implemented).
+	FilePrefetcher& operator= ( const FilePrefetcher& that );
+
+public:
+	// Constructor.
+	FilePrefetcher( const Options& options, FileFinderCache& fileFinderCache );
+
+	// Destructor.
+	~FilePrefetcher() throw();
+
+	// Get the content of a file.
+	const CodePageInfo* fetch( const std::wstring& sFullPath, FileContentStream& stream );
+
+	// Prefetch the includes of a file read by the processor itself.
+	void prefetchIncludes( const std::wstring& sFullPath );
+
+	// Get the number of files read by the background thread.
+	size_t getPrefetchCount() const throw();
+
+	// Get the number of files whose prefetched content was fetched by the processor.
+	size_t getFetchCount() const throw();
+
+	// Get the number of files prefetched which were ready when fetched by the processor.
+	size_t getHitCount() const throw();
+
+private:
+	// The background thread procedure.
+	static unsigned __stdcall threadProc( void* pData );
+
+	// Read the files requested until the prefetcher is stopped.
+	void run();
+
+	// Read and decode a file.
+	static const CodePageInfo* load( const std::wstring& sFullPath, std::wstring& content ) throw();
+
+	// Scan the content of a file for include directives and resolve the files.
+	void scan( const std::wstring& sFilePath, const std::wstring& content, StringArray& includeFiles ) const;
+};
+
+} // namespace sqtpp
+
+#endif // SQTPP_FILE_PREFETCHER_H
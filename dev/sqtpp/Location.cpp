@@ -19,6 +19,15 @@ Location::Location( const File& file )
 	} 
 }
 
+/**
+** @brief Initialize the location with the given file path and line.
+*/
+Location::Location( const wstring& sFile, size_t nLine )
+: m_nLine( nLine )
+, m_sFile( sFile )
+{
+}
+
 
 
 } // namespace
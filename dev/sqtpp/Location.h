@@ -18,6 +18,7 @@ private:
 	wstring m_sFile;
 public:
 	Location( const File& file );
+	Location( const wstring& sFile, size_t nLine );
 
 	size_t getLine() const throw()         { return m_nLine; }
 	const wstring& getFile() const throw() { return m_sFile; }
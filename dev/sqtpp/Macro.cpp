@@ -4,6 +4,7 @@
 #include "Util.h"
 #include "Processor.h"
 #include "Error.h"
+#include "Expression.h"
 #include "Macro.h"
 
 namespace sqtpp {
@@ -285,7 +286,7 @@ void MacroExpander::expand( const Macro& macro, const Processor& processor, cons
 						int            nArgumentIndex = macroArguments.getArgumentIndex( identifier );
 						if ( nArgumentIndex >= 0 ) {
 							const TokenExpressions& argumentExpressions = argumentValues[nArgumentIndex];
-							const wstring stringizedTokens = argumentExpressions.stringize( delimiter, escape );
+							const wstring stringizedTokens = argumentExpressions.stringize( delimiter, escape, options.collapseBlanks() );
 							TokenExpression replacement( TOK_STRING, tokenExpression.getContext(), stringizedTokens );
 							interimResult.push_back( replacement );
 							bOperandFound  = true;
@@ -399,6 +400,9 @@ Macro::Macro()
 , m_isMultiLine( false )
 , m_isExpanding( false )
 , m_pMacroExpander( NULL )
+, m_nVersion( 0 )
+, m_hasConstantValue( false )
+, m_nConstantValue( 0 )
 {
 }
 
@@ -412,6 +416,9 @@ Macro::Macro( const wchar_t* identifier, MacroExpander* pMacroExpander )
 , m_isMultiLine( false )
 , m_isExpanding( false )
 , m_pMacroExpander( pMacroExpander )
+, m_nVersion( 0 )
+, m_hasConstantValue( false )
+, m_nConstantValue( 0 )
 {
 }
 
@@ -425,6 +432,9 @@ Macro::Macro( const wstring& identifier, const wstring& file, const size_t line
 , m_isMultiLine( false )
 , m_isExpanding( false )
 , m_pMacroExpander( &MacroExpander::m_instance )
+, m_nVersion( 0 )
+, m_hasConstantValue( false )
+, m_nConstantValue( 0 )
 {
 }
 
@@ -435,6 +445,7 @@ void Macro::setArguments( const MacroArguments& arguments )
 {
 	m_arguments = arguments;
 	m_hasArgs  = true;
+	m_hasConstantValue = false;
 }
 
 /**
@@ -456,6 +467,83 @@ void Macro::setExpression( const TokenExpressions& tokens, const wstring& expres
 			break;
 		}
 	}
+	evaluateConstantValue();
+}
+
+/**
+** @brief Check if the macro expression is a closed integer constant expression 
+** and if so compute its value.
+**
+** Closed means that the expression is either a single number or is enclosed in
+** parenthesis and consists of numbers and operators only. Otherwise the value
+** might depend on the operators surrounding the macro when it is expanded. 
+** The value is used when evaluating \#if expressions to avoid the expansion
+** and parsing of the macro expression.
+*/
+void Macro::evaluateConstantValue()
+{
+	TokenExpressions expressions;
+
+	m_hasConstantValue = false;
+	m_nConstantValue   = 0;
+	if ( m_hasArgs || m_pMacroExpander != &MacroExpander::m_instance ) {
+		return;
+	}
+
+	// Collect the numbers, operators and parenthesis.
+	for ( TokenExpressions::const_iterator it = m_tokens.begin(); it != m_tokens.end(); ++it ) {
+		const TokenExpression& tokex = *it;
+		const Token            token = tokex.getToken();
+		switch ( token ) {
+			case TOK_SPACE:
+			case TOK_BLOCK_COMMENT:
+				break;
+			case TOK_NUMBER:
+			case TOK_LEFT_PARENTHESIS:
+			case TOK_RIGHT_PARENTHESIS:
+				expressions.push_back( tokex );
+				break;
+			default:
+				if ( token == TOK_OP_DEFINED || !TokenInfo::getTokenInfo( token ).isOperator() ) {
+					return;
+				}
+				expressions.push_back( tokex );
+				break;
+		}
+	}
+
+	// Check if the expression is a single number or enclosed in parenthesis.
+	if ( expressions.size() == 1 ) {
+		if ( expressions.front().getToken() != TOK_NUMBER ) {
+			return;
+		}
+	} else if ( expressions.size() > 1 ) {
+		int nParenthesis = 0;
+		for ( size_t i = 0; i < expressions.size(); ++i ) {
+			const Token token = expressions[i].getToken();
+			if ( token == TOK_LEFT_PARENTHESIS ) {
+				++nParenthesis;
+			} else if ( token == TOK_RIGHT_PARENTHESIS ) {
+				--nParenthesis;
+			}
+			if ( nParenthesis == 0 && i + 1 < expressions.size() ) {
+				return;
+			}
+		}
+	} else {
+		return;
+	}
+
+	try {
+		Expression evaluator;
+		evaluator.build( expressions );
+		const Expression::Value& value = evaluator.evaluate();
+		m_nConstantValue   = value.getInteger();
+		m_hasConstantValue = true;
+	} catch ( const std::exception& ) {
+		// Not a valid expression (e.g. "(1 +)" or "(1 / 0)"). The macro
+		// will be expanded as usual and the error reported when used.
+	}
 }
 
 /**
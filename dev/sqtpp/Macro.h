@@ -134,6 +134,15 @@ private:
 	/// The object responsible for expanding the macro.
 	MacroExpander*   m_pMacroExpander;
 
+	/// Version number assigned by the processor whenever the macro is (re)defined.
+	size_t           m_nVersion;
+
+	/// Is the macro expression a closed integer constant expression?
+	bool             m_hasConstantValue;
+
+	/// The value of the expression if #m_hasConstantValue is set.
+	long long int    m_nConstantValue;
+
 public:
 	// The default constructor.
 	Macro();
@@ -145,6 +154,10 @@ protected:
 	// The constructor for buildin macros.
 	Macro( const wchar_t* identifier, MacroExpander* pMacroExpander );
 
+private:
+	// Compute the value of closed integer constant expressions.
+	void evaluateConstantValue();
+
 public:
 
 	// The copy constructor.
@@ -195,6 +208,21 @@ public:
 	/// Set flag indication that the processor is currently expanding this macro.
 	void setExpanding( bool bSet ) throw() { m_isExpanding = bSet; }
 
+	/// Can the expansion change without the macro being redefined (like __LINE__ or __COUNTER__)?
+	bool isVolatile() const throw()   { return m_pMacroExpander != &MacroExpander::getInstance(); }
+
+	/// Get the version number of the macro definition.
+	size_t getVersion() const throw() { return m_nVersion; }
+
+	/// Set the version number of the macro definition.
+	void setVersion( size_t nVersion ) throw() { m_nVersion = nVersion; }
+
+	/// Is the macro expression an integer constant expression (like 3 or (2 * 8 + 1))?
+	bool hasConstantValue() const throw() { return m_hasConstantValue; }
+
+	/// Get the value of an integer constant macro expression.
+	long long int getConstantValue() const throw() { return m_nConstantValue; }
+
 	/// Set the argument list.
 	void setArguments( const MacroArguments& arguments );
 
@@ -45,16 +45,22 @@ Options::Options()
 	m_bExpandMacroArguments    = false;
 	m_bTrimLeadingBlanks       = false;
 	m_bTrimTrailingBlanks      = false;
+	m_bCollapseBlanks          = false;
+	m_bKeepHints               = false;
+	m_bStripSqlComments        = false;
 	m_bEliminateEmptyLines     = false;
 	m_bIgnoreCWD               = false;
 	m_bUndefAllBuildin         = false;
 	m_bVerbose                 = false;
 	m_bWriteErrorsToOutput     = false;
 	m_bSupportAdSalesNG        = true;
+	m_bFrameBatches            = false;
 
 	m_nInputCodePage           = 0;
 	m_nOutputCodePage          = 0;
 
+	m_batchSeparators.push_back( L"GO" );
+
 	setLanguageDefaults();
 }
 
@@ -208,6 +214,25 @@ void Options::keepComments( bool bKeep ) throw()
 	keepSqlComments( bKeep );
 }
 
+/*
+** @brief Set all options for a minified output.
+**
+** Comments (except optimizer hints), \#line directives, empty lines
+** and redundant blanks are removed. The line structure is kept so
+** batch separators still stand on a line of their own.
+*/
+void Options::minify() throw()
+{
+	keepComments( false );
+	keepHints( true );
+	stripSqlComments( true );
+	emitLine( false );
+	eliminateEmptyLines( true );
+	trimLeadingBlanks( true );
+	trimTrailingBlanks( true );
+	collapseBlanks( true );
+}
+
 /*
 ** @brief Add one or more included directories.
 */
@@ -413,6 +413,33 @@ private:
 	*/
 	bool     m_bTrimTrailingBlanks;
 
+	/**
+	** @brief Replace each run of blanks by a single blank.
+	**
+	** Comments removed from the output are replaced by a blank too
+	** so they still separate the tokens they surrounded. Blanks within
+	** string literals of the input are never touched but the blanks of
+	** macro arguments stringized by the \# operator are. Default is false.
+	*/
+	bool     m_bCollapseBlanks;
+
+	/**
+	** @brief Keep optimizer hints even if comments are removed?
+	**
+	** Hints are block comments starting with <tt>/\*+</tt> or <tt>/\*!</tt>
+	** and SQL line comments starting with <tt>--+</tt>. Default is false.
+	*/
+	bool     m_bKeepHints;
+
+	/**
+	** @brief Remove SQL line comments from the output?
+	**
+	** SQL line comments are part of the output unless this option is set.
+	** (#m_bKeepSqlComments only decides if they are scanned as comments.)
+	** Set by #minify. Default is false.
+	*/
+	bool     m_bStripSqlComments;
+
 	/**
 	** @brief Ignore the current working directory when searching for include files?
 	**
@@ -450,7 +477,7 @@ private:
 	** @brief Option to let sqtpp write all error messages
 	** to the normal output. 
 	** This option is used to support test scenarios than expect all 
-	** output in a single file 
+	** output in a single file. It is ignored if the output is framed.
 	*/
 	bool     m_bWriteErrorsToOutput;
 
@@ -495,6 +522,14 @@ private:
 	*/
 	wstring m_sOutputFile;
 
+	/**
+	** @brief The file to which the source map should be written (default is "" / none).
+	** 
+	** If a file is specified no \#line directives are emitted. The origin of the
+	** output lines is written to the source map instead (see #sqtpp::SourceMap).
+	*/
+	wstring m_sSourceMapFile;
+
 	/**
 	** @brief Include directories specified as command line parameter.
 	**
@@ -522,6 +557,36 @@ private:
 	*/
 	StringArray       m_macroUndefines;
 
+	/**
+	** @brief The lines separating the batches (default is GO).
+	**
+	** The separators are compared case insensitive to the trimmed output lines.
+	*/
+	StringArray       m_batchSeparators;
+
+	/**
+	** @brief Write the output as a sequence of batch frames (see #sqtpp::Processor::writeFrame)?
+	**
+	** Error messages are never written into a framed output (see
+	** #m_bWriteErrorsToOutput). Default is false.
+	*/
+	bool              m_bFrameBatches;
+
+	/**
+	** @brief The file to which the batch manifest should be written (default is "" / none).
+	**
+	** The manifest lists the hash value of each batch (see #sqtpp::BatchManifest).
+	*/
+	wstring           m_sManifestFile;
+
+	/**
+	** @brief The file in which the checkpoints of the root file are cached (default is "" / none).
+	**
+	** With an output range the processing resumes at the last valid checkpoint
+	** preceding the range (see #sqtpp::CheckpointCache).
+	*/
+	wstring           m_sCheckpointFile;
+
 	/**
 	** @brief Format string to be used when emmitting the __DATE__ macro.
 	**
@@ -594,6 +659,11 @@ public:
 	/// Set the path of the file to which the output should be written.
 	void setOutputFile( const wstring& sPath ) throw()   { m_sOutputFile = sPath; }
 
+	/// Get the path of the file to which the source map should be written.
+	const wstring& getSourceMapFile() const throw()      { return m_sSourceMapFile; }
+	/// Set the path of the file to which the source map should be written.
+	void setSourceMapFile( const wstring& sPath ) throw() { m_sSourceMapFile = sPath; }
+
 	/// Get some information about the given language.
 	static const LanguageInfo& getLanguageInfo( Language language ) throw();
 
@@ -691,9 +761,31 @@ public:
 
 	/// Check if leading blanks should be suppressed.
 	bool trimLeadingBlanks() const throw()            { return m_bTrimLeadingBlanks; }
+	/// Set if leading blanks should be suppressed.
+	void trimLeadingBlanks( bool bTrim ) throw()      { m_bTrimLeadingBlanks = bTrim; }
 
 	/// Check if trailing blanks should be suppressed.
 	bool trimTrailingBlanks() const throw()           { return m_bTrimTrailingBlanks; }
+	/// Set if trailing blanks should be suppressed.
+	void trimTrailingBlanks( bool bTrim ) throw()     { m_bTrimTrailingBlanks = bTrim; }
+
+	/// Check if runs of blanks should be replaced by a single blank.
+	bool collapseBlanks() const throw()               { return m_bCollapseBlanks; }
+	/// Set if runs of blanks should be replaced by a single blank.
+	void collapseBlanks( bool bCollapse ) throw()     { m_bCollapseBlanks = bCollapse; }
+
+	/// Check if optimizer hints should be emitted even if comments are not.
+	bool keepHints() const throw()                    { return m_bKeepHints; }
+	/// Set if optimizer hints should be emitted even if comments are not.
+	void keepHints( bool bKeep ) throw()              { m_bKeepHints = bKeep; }
+
+	/// Check if SQL line comments should be removed from the output.
+	bool stripSqlComments() const throw()             { return m_bStripSqlComments; }
+	/// Set if SQL line comments should be removed from the output.
+	void stripSqlComments( bool bStrip ) throw()      { m_bStripSqlComments = bStrip; }
+
+	/// Set all options for a minified output.
+	void minify() throw();
 
 	/// Check if empty line should be suppressed.
 	bool eliminateEmptyLines() const throw()          { return m_bEliminateEmptyLines; }
@@ -718,6 +810,26 @@ public:
 	/// Get macros to be defined before first file is processed (passed at the command line).
 	const StringDictionary& getDefines() const throw() { return m_macroDefines; }
 
+	/// Get the lines separating the batches.
+	const StringArray& getBatchSeparators() const throw() { return m_batchSeparators; }
+	/// Set the lines separating the batches.
+	void setBatchSeparators( const StringArray& separators ) { m_batchSeparators = separators; }
+
+	/// Check if the output is written as a sequence of batch frames.
+	bool frameBatches() const throw()                 { return m_bFrameBatches; }
+	/// Set if the output is written as a sequence of batch frames.
+	void frameBatches( bool bFrame ) throw()          { m_bFrameBatches = bFrame; }
+
+	/// Get the path of the file to which the batch manifest should be written.
+	const wstring& getManifestFile() const throw()    { return m_sManifestFile; }
+	/// Set the path of the file to which the batch manifest should be written.
+	void setManifestFile( const wstring& sPath ) throw() { m_sManifestFile = sPath; }
+
+	/// Get the path of the file in which the checkpoints are cached.
+	const wstring& getCheckpointFile() const throw()  { return m_sCheckpointFile; }
+	/// Set the path of the file in which the checkpoints are cached.
+	void setCheckpointFile( const wstring& sPath ) throw() { m_sCheckpointFile = sPath; }
+
 private:
 	/// Set the default options for the source code language.
 	void setLanguageDefaults();
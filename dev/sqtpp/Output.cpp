@@ -3,6 +3,7 @@
 #include "CodePage.h"
 #include "CodePageDetection.h"
 #include "Error.h"
+#include "Streams.h"
 #include "Output.h"
 namespace sqtpp {
 
@@ -13,10 +14,10 @@ namespace sqtpp {
 class FileOutput : public Output
 {
 private:
-	std::wofstream* m_pFileStream;
+	FileOutputStream* m_pFileStream;
 
 public:
-	FileOutput( std::wofstream* pFileStream )
+	FileOutput( FileOutputStream* pFileStream )
 	: Output( *pFileStream )
 	, m_pFileStream( pFileStream )
 	{
@@ -34,6 +35,14 @@ public:
 	{
 		m_pFileStream->close();
 	}
+
+	/**
+	** @brief Check if the output file has been kept because the content was the same.
+	*/
+	virtual bool isUnchanged() const
+	{
+		return m_pFileStream->isUnchanged();
+	}
 };
 
 /**
@@ -92,6 +101,7 @@ Output::Output( std::wostream& outStream )
 : m_outStream( outStream )
 , m_pErrStream( &std::wcerr )
 , m_pLogStream( &std::wclog )
+, m_pCodePage( NULL )
 {
 }
 
@@ -117,23 +127,21 @@ Output* Output::createOutput( const Options& options, const wstring& mainInputFi
 		wcout.imbue( codePageLocale );
 		pOutput = new ConsoleOutput();
 	} else {
-		const wchar_t* pszOpenMode = L"wbS";
-		FILE* file = _wfopen( sOutputFile.c_str(), pszOpenMode );
-		if ( file == NULL ) {
+		// The characters are encoded directly into the output file (including the byte order mark).
+		FileOutputStream* pOutStream = new FileOutputStream();
+		if ( !pOutStream->open( sOutputFile, codePageInfo ) ) {
+			delete pOutStream;
 			throw error::C1083( sOutputFile );
 		}
-		std::wofstream* pOutStream = new std::wofstream( file );
-		pOutStream->imbue( codePageLocale );
-
-		pOutStream->exceptions( wofstream::failbit | wofstream::badbit );
+		pOutStream->exceptions( wostream::failbit | wostream::badbit );
 
 		pOutput = new FileOutput( pOutStream );
-		if ( codePageInfo.getFileBom() != NULL ) {
-			fputs( codePageInfo.getFileBom(), file );
-		}
 	}
 
-	if ( options.writeErrorsToOutput() ) {
+	pOutput->m_pCodePage = &codePageInfo;
+
+	// Messages would end up between the frames of a framed output.
+	if ( options.writeErrorsToOutput() && !options.frameBatches() ) {
 		pOutput->m_pErrStream = &pOutput->m_outStream;
 		pOutput->m_pLogStream = &pOutput->m_outStream;
 	}
@@ -151,6 +159,44 @@ Output* Output::createOutput( std::wostream& stream )
 }
 
 
+/**
+** @brief Get the number of bytes the characters are encoded to.
+**
+** If the characters are not encoded (stream passed by a unit test) the
+** number of characters is returned.
+*/
+size_t Output::getEncodedLength( const wchar_t* pChars, size_t nCharCount ) const
+{
+	typedef std::codecvt<wchar_t, char, mbstate_t> Converter;
+
+	if ( m_pCodePage == NULL ) {
+		return nCharCount;
+	}
+	const Converter& converter = use_facet<Converter>( m_pCodePage->getLocale() );
+	if ( converter.always_noconv() ) {
+		return nCharCount * sizeof( wchar_t );
+	}
+
+	char           bytes[0x1000];
+	mbstate_t      state      = mbstate_t();
+	const wchar_t* pFrom      = pChars;
+	const wchar_t* pFromMax   = pChars + nCharCount;
+	size_t         nByteCount = 0;
+	while ( pFrom < pFromMax ) {
+		const wchar_t* pFromNext = pFrom;
+		char*          pToNext   = bytes;
+		codecvt_base::result result = converter.out( state, pFrom, pFromMax, pFromNext, bytes, bytes + sizeof( bytes ), pToNext );
+		nByteCount+= pToNext - bytes;
+		if ( result == codecvt_base::error || pFromNext == pFrom ) {
+			// The stream cannot write the rest either.
+			break;
+		}
+		pFrom = pFromNext;
+	}
+	return nByteCount;
+}
+
+
 /**
 ** @brief Gets the output code page either from the option or - if not specified - 
 ** by determining the code page of the main input file.
@@ -167,6 +213,9 @@ CodePageId Output::getOutputCodePage( const Options& options, const wstring& mai
 	if ( codePageId != CPID_UNDEFINED )
 		return codePageId;
 
+	// Probe as many bytes as the input file is examined with when it is
+	// processed: Otherwise an UTF-8 file whose first non ASCII character 
+	// follows later would be written in the default code page.
 	const CodePageInfo* pCodePage = CodePageDetection::detectCodePage( mainInputFile, CodePageInfo::getDefaultCodePageId() );
 	assert( pCodePage != NULL );
 	codePageId = pCodePage->getCodePageId();
@@ -12,6 +12,7 @@
 #endif
 
 namespace sqtpp {
+	class CodePageInfo;
 	class Options;
 	enum CodePageId;
 }
@@ -31,6 +32,9 @@ private:
 	/// The log out stream (wclog by default).
 	std::wostream* m_pLogStream;
 
+	/// The code page the characters written are encoded to (NULL if not encoded).
+	const CodePageInfo* m_pCodePage;
+
 protected:
 	Output( std::wostream& outStream );
 public:
@@ -38,6 +42,12 @@ public:
 
 	virtual void close() = NULL;
 
+	/// Check if the output file has been kept because the content was the same.
+	virtual bool isUnchanged() const
+	{
+		return false;
+	}
+
 	std::wostream& getStream()
 	{
 		return m_outStream;
@@ -53,6 +63,9 @@ public:
 		return *m_pLogStream;;
 	}
 
+	// Get the number of bytes the characters are encoded to.
+	size_t getEncodedLength( const wchar_t* pChars, size_t nCharCount ) const;
+
 private:
 	/// Private copy constructor - not implemented.
 	Output( const Output& );
@@ -9,9 +9,11 @@
 #include "Directive.h"
 #include "File.h"
 #include "FileFinder.h"
+#include "FilePrefetcher.h"
 #include "Output.h"
 #include "Exceptions.h"
 #include "Expression.h"
+#include "ConditionalCache.h"
 #include "Error.h"
 #include "Macro.h"
 #include "Buildin.h"
@@ -19,6 +21,10 @@
 #include "Context.h"
 #include "Util.h"
 #include "Scanner.h"
+#include "SourceMap.h"
+#include "BatchManifest.h"
+#include "CheckpointCache.h"
+#include "Streams.h"
 #include "CodePage.h"
 #include "CodePageConverter.h"
 #include "Processor.h"
@@ -74,10 +80,16 @@ Processor::Processor( Options& options )
 , m_pScanner( NULL )
 , m_fileStack( *new FileStack() )
 , m_includeOnceFiles( *new StringSet() )
+, m_includeGuards( *new StringDictionary() )
+, m_guardedIncludes( *new StringDictionary() )
 , m_macros( *new MacroSet() )
 , m_tokenExpression( *new TokenExpression() )
 , m_tokenStreamStack( *new TokenStreamStack() )
 , m_conditionalStack( *new LocationStack() )
+, m_conditionalCache( *new ConditionalCache() )
+, m_fileFinderCache( *new FileFinderCache() )
+, m_nMacroVersion( 0 )
+, m_pReferencedIdentifiers( NULL )
 , m_nProcessedLines( 0 )
 , m_nProcessedTokenId( 0 )
 , m_eMaxMsgSeverity( error::Error::SEV_UNDEFINED )
@@ -86,9 +98,22 @@ Processor::Processor( Options& options )
 , m_nOutputLineNumber( 1 )
 , m_nSkippedLineCount( 0 )
 , m_pTokenStream( NULL )
+, m_nOutputLineStart( 0 )
+, m_bOutputRangeRestricted( false )
 , m_pOutput( NULL )
+, m_pPrefetcher( NULL )
+, m_pSourceMap( NULL )
+, m_pManifest( NULL )
+, m_pCheckpoints( NULL )
+, m_nRootLineCount( 0 )
+, m_nNextCheckpointLine( 0 )
+, m_nCheckpointMacroVersion( 0 )
+, m_nOutputLineCount( 0 )
+, m_nFrameCount( 0 )
+, m_nFrameLine( 0 )
 , m_bExternalOutput( false )
 , m_pTestTimestamp( NULL )
+, m_bTimestampValid( false )
 //, m_pIStream( NULL )
 {
 	//m_pOutStream->
@@ -101,11 +126,19 @@ Processor::~Processor()
 {
 	if ( !m_bExternalOutput )
 		delete m_pOutput;
+	delete m_pPrefetcher;
+	delete m_pSourceMap;
+	delete m_pManifest;
+	delete m_pCheckpoints;
 	delete m_pScanner;
+	delete &m_fileFinderCache;
+	delete &m_conditionalCache;
 	delete &m_conditionalStack;
 	delete &m_tokenStreamStack;
 	delete &m_tokenExpression;
 	delete &m_macros;
+	delete &m_guardedIncludes;
+	delete &m_includeGuards;
 	delete &m_includeOnceFiles;
 	delete &m_fileStack;
 	delete &m_logger;
@@ -117,7 +150,45 @@ Processor::~Processor()
 void Processor::close()
 {
 	if ( m_pOutput != NULL ) {
+		if ( m_options.frameBatches() ) {
+			// The rest is the last batch.
+			writeFrame( m_outputArena.length() );
+		}
+		flushOutput();
 		m_pOutput->close();
+
+		// The log cannot be written into the output once it is closed.
+		std::wostream& logStream = m_pOutput->getLogStream();
+		if ( m_options.verbose() && m_pOutput->isUnchanged() && &logStream != &m_pOutput->getStream() ) {
+			logStream << L"output file unchanged: " << m_options.getOutputFile() << endl;
+		}
+	}
+
+	if ( m_pSourceMap != NULL ) {
+		const wstring& sSourceMapFile = m_options.getSourceMapFile();
+		const CodePageInfo& codePage = CodePageInfo::getCodePageInfo( CPID_UTF8 );
+		FileOutputStream stream;
+		if ( !stream.open( sSourceMapFile, codePage ) ) {
+			throw error::C1083( sSourceMapFile );
+		}
+		stream.exceptions( wostream::failbit | wostream::badbit );
+		m_pSourceMap->write( stream );
+		stream.close();
+	}
+
+	if ( m_pManifest != NULL ) {
+		// The rest is the last batch.
+		m_pManifest->endBatch();
+
+		const wstring& sManifestFile = m_options.getManifestFile();
+		const CodePageInfo& codePage = CodePageInfo::getCodePageInfo( CPID_UTF8 );
+		FileOutputStream stream;
+		if ( !stream.open( sManifestFile, codePage ) ) {
+			throw error::C1083( sManifestFile );
+		}
+		stream.exceptions( wostream::failbit | wostream::badbit );
+		m_pManifest->write( stream );
+		stream.close();
 	}
 }
 
@@ -159,15 +230,61 @@ Context Processor::getContext() const throw()
 }
 
 /**
-** @brief Get the current file we are processing.
+** @brief Get the timestamp of this run.
 */
 void Processor::getTimestamp( tm& timestamp ) const
 {
 	if ( m_pTestTimestamp != NULL ) {
 		timestamp = *m_pTestTimestamp;
 	} else {
-		Util::getLocalTime( timestamp );
+		if ( !m_bTimestampValid ) {
+			Util::getLocalTime( m_timestamp );
+			m_bTimestampValid = true;
+		}
+		timestamp = m_timestamp;
+	}
+}
+
+/**
+** @brief For testing only: override the default timestamp to make test deterministic.
+*/
+void Processor::setTimestamp( const tm* pTimestamp )
+{
+	m_pTestTimestamp = pTimestamp;
+	m_formattedTimestamps.clear();
+}
+
+/**
+** @brief Get the timestamp of this run formatted with the given format.
+**
+** The timestamp is taken only once per run. So all expansions of __DATE__, 
+** __TIME__ and __TIMESTAMP__ are consistent and have to be formatted only 
+** once.
+**
+** @param sFormat Format string for wcsftime.
+*/
+const std::wstring& Processor::formatTimestamp( const std::wstring& sFormat ) const
+{
+	StringDictionary::const_iterator it = m_formattedTimestamps.find( sFormat );
+	if ( it != m_formattedTimestamps.end() ) {
+		return it->second;
+	}
+
+	wchar_t wcBuffer[128];
+	tm      localTime;
+
+	getTimestamp( localTime );
+
+	// Convert date to string.
+	size_t length = wcsftime( wcBuffer, sizeof(wcBuffer) / sizeof( wchar_t ), sFormat.c_str(), &localTime );
+	if ( length == 0 ) {
+		throw RuntimeError( "The time format is to long." );
 	}
+
+	wstring& sTimestamp = m_formattedTimestamps[sFormat];
+	sTimestamp.assign( wcBuffer, length );
+
+	return sTimestamp;
 }
 
 /**
@@ -226,12 +343,12 @@ bool Processor::isBuildinMacro( const wstring& identifier ) const
 ** #line n "filename"
 ** @endcode
 */
-void Processor::emitLineDirective( std::wostream& output )
+void Processor::emitLineDirective( std::wstring& output )
 {
 	// #line n "filename"
 	const File&    file     = getCurrentFile();
-	const wstring  fileName = file.getPath();
-	const wstring  sNewLine = file.getDefaultNewLine(); 
+	const wstring& fileName = file.getPath();
+	const wstring& sNewLine = file.getDefaultNewLine(); 
 	const size_t   line     = file.getLine();
 	const wchar_t  quote    = m_options.getStringDelimiter() == Options::STRD_DOUBLE ? L'"' : '\'';
 
@@ -241,7 +358,10 @@ void Processor::emitLineDirective( std::wostream& output )
 	wchar_t lineBuffer[20];
 	_itow( (int)line, lineBuffer, 10 );
 
-	output << L"#line " << lineBuffer << L' ' << quote;
+	output+= L"#line ";
+	output+= lineBuffer;
+	output+= L' ';
+	output+= quote;
 
 	if ( m_options.getStringQuoting() == Options::QUOT_ESCAPE ) {
 		// Replace backslash in file name with double backshlash.
@@ -249,52 +369,52 @@ void Processor::emitLineDirective( std::wostream& output )
 		while ( it != fileName.end() ) {
 			const wchar_t ch = *it;
 			if ( ch == L'\\' ) {
-				output << ch;
+				output+= ch;
 			}
-			output << ch;
+			output+= ch;
 			++it;
 		}
 	} else {
-		output << fileName;
+		output+= fileName;
 	}
-	output << quote;
-
-	emitLineFeed( output, sNewLine );
+	output+= quote;
+	output+= getLineFeed( sNewLine );
 }
 
 /**
-** @brief Emit a line feed.
+** @brief Get the line feed to emit.
 **
 ** @param sNewLine The line feed found in the input.
 */
-void Processor::emitLineFeed( std::wostream& output, const wstring& sNewLine ) const
+const wchar_t* Processor::getLineFeed( const wstring& sNewLine ) const
 {
 	switch ( m_options.getNewLineOutput() ) {
 		case Options::NLO_AS_IS:
-			if ( sNewLine.empty() ) {
-				output << endl;
-			} else {
-				output << sNewLine;
-			}
-			break;
+			return sNewLine.empty() ? L"\n" : sNewLine.c_str();
 		case Options::NLO_OS_DEFAULT:
-			output << m_options.getOsDefaultNewLine();
-			break;
+			return m_options.getOsDefaultNewLine();
 		case Options::NLO_LF:
-			output << L'\n';
-			break;
+			return L"\n";
 		case Options::NLO_CR:
-			output << L'\r';
-			break;
+			return L"\r";
 		case Options::NLO_CRLF:
-			output << L"\r\n";
-			break;
+			return L"\r\n";
 		default:
 			throw UnexpectedSwitchError();
 			//throw UnexpectedSwitchError( "NewLineOutput" );
 	}
 }
 
+/**
+** @brief Emit a line feed.
+**
+** @param sNewLine The line feed found in the input.
+*/
+void Processor::emitLineFeed( std::wostream& output, const wstring& sNewLine ) const
+{
+	output << getLineFeed( sNewLine );
+}
+
 /**
 ** @brief Emit a message, warning or error.
 */
@@ -305,6 +425,9 @@ void Processor::emitMessage( error::Error& error ) const
 		error.setFileInfo( file );
 	}
 
+	// The error stream may be the output stream.
+	flushOutput();
+
 	std::wostream& errorStream = m_pOutput->getErrStream();
 	errorStream << error;
 	emitLineFeed( errorStream, m_options.getOsDefaultNewLine() );
@@ -318,42 +441,103 @@ void Processor::emitMessage( error::Error& error ) const
 }
 
 /**
-** @brief Emit the current output buffer.
+** @brief Write the completed lines collected to the output stream.
 **
-** @param output The output stream to emit to.
-** @returns Number of characters written.
+** The current (incomplete) line is kept in the arena. If the output
+** is framed nothing is written: The lines are kept until the batch
+** is complete (see #writeFrame).
 */
-size_t Processor::emitBuffer( wostream& output )
+void Processor::flushOutput() const
 {
-	size_t  nCount = 0;
-	wstring line   = m_outputBuffer.str();
-	bool    bEmit  = true;
-
-	if ( m_options.trimTrailingBlanks() ) {
-		//line = line.trimLeft();
-	}
-	if ( m_options.trimLeadingBlanks() ) {
-		//line = line.trimRight();
+	if ( m_nOutputLineStart > 0 && !m_options.frameBatches() ) {
+		std::wostream& output = m_pOutput->getStream();
+		output.write( m_outputArena.data(), m_nOutputLineStart );
+		output.clear();
+		// Erasing keeps the capacity of the arena.
+		m_outputArena.erase( 0, m_nOutputLineStart );
+		m_nOutputLineStart = 0;
 	}
+}
+
 
-	// Optionaly skip empty lines (if not in the middle of a string).
-	if ( getContext() != CTX_DQUOTE_STRING && getContext() != CTX_SQUOTE_STRING ) {
-		if ( m_options.eliminateEmptyLines() && line == L""  ) {
-			bEmit = false;
+/**
+** @brief Check if the current output line is a batch separator.
+**
+** The line is compared case insensitive to the separators defined
+** ignoring leading and trailing blanks.
+*/
+bool Processor::isBatchSeparator() const
+{
+	size_t nStart = m_nOutputLineStart;
+	size_t nEnd   = m_outputArena.length();
+	while ( nStart < nEnd && Util::isBlank( m_outputArena[nStart] ) ) {
+		++nStart;
+	}
+	while ( nEnd > nStart && Util::isBlank( m_outputArena[nEnd - 1] ) ) {
+		--nEnd;
+	}
+
+	const wchar_t* pwcLine = m_outputArena.data() + nStart;
+	const size_t   nLength = nEnd - nStart;
+	const StringArray& separators = m_options.getBatchSeparators();
+	for ( StringArray::const_iterator it = separators.begin(); it != separators.end(); ++it ) {
+		const wstring& separator = *it;
+		if ( separator.length() == nLength && _wcsnicmp( separator.c_str(), pwcLine, nLength ) == 0 ) {
+			return true;
 		}
 	}
+	return false;
+}
+
+
+/**
+** @brief Write the output collected as a batch frame.
+**
+** Each frame consists of a header line followed by the text of the batch:
+** @code
+** #batch ordinal length line file
+** text
+** @endcode
+** The length is the number of bytes the text is encoded to in the code
+** page of the output (the number of characters if the stream passed to
+** #setOutStream is written). Line and file denote the first non empty line of the batch. The header
+** line is terminated by a single line feed. Batches containing blanks and
+** line feeds only are skipped. The output is flushed after each frame so
+** a consumer can execute the batch while the next one is processed.
+**
+** @param nLength The number of characters at the start of the output 
+** arena which make up the batch. They are removed from the arena.
+*/
+void Processor::writeFrame( size_t nLength )
+{
+	assert( nLength <= m_outputArena.length() );
+
+	const size_t nFirstText = m_outputArena.find_first_not_of( L" \t\r\n" );
+	if ( nFirstText < nLength ) {
+		std::wostream& output = m_pOutput->getStream();
 
-	if ( bEmit ) {
-		if ( line.length() > 0 ) {
-			output << line;
-			nCount = line.length();
+		if ( m_nFrameLine == 0 && !m_fileStack.empty() ) {
+			// The batch consists of an incomplete last line only.
+			const File& file = getCurrentFile();
+			m_sFrameFile = file.getPath();
+			m_nFrameLine = file.getLine();
 		}
-		m_prevLine = line;
-	}
-	m_outputBuffer.str( wstring() );
-	m_outputBuffer.clear();
 
-	return nCount;
+		++m_nFrameCount;
+		output << L"#batch ";
+		Util::writeNumber( output, m_nFrameCount );
+		output << L' ';
+		Util::writeNumber( output, m_pOutput->getEncodedLength( m_outputArena.data(), nLength ) );
+		output << L' ';
+		Util::writeNumber( output, m_nFrameLine );
+		output << L' ' << m_sFrameFile << L'\n';
+		output.write( m_outputArena.data(), nLength );
+		output.flush();
+	}
+
+	m_outputArena.erase( 0, nLength );
+	m_nOutputLineStart = m_nOutputLineStart > nLength ? m_nOutputLineStart - nLength : 0;
+	m_nFrameLine = 0;
 }
 
 
@@ -390,10 +574,16 @@ void Processor::processStream( std::wistream& input )
 		m_nOutputLineNumber = 1;
 
 		processInput();
-		emitBuffer( m_pOutput->getStream() );
+		// Emit the rest of the last line.
+		if ( m_options.frameBatches() ) {
+			writeFrame( m_outputArena.length() );
+		}
+		m_nOutputLineStart = m_outputArena.length();
+		flushOutput();
 		m_fileStack.pop();
 	} catch ( error::Error& error ) {
 		m_fileStack.pop();
+		flushOutput();
 
 		if ( error.getFilePath().empty() ) {
 			error.setFileInfo( file );
@@ -406,6 +596,7 @@ void Processor::processStream( std::wistream& input )
 		wstring message = Convert::str2wcs( ex.what() );
 		error::C1001 error( message );
 		error.setFileInfo( file );
+		flushOutput();
 		m_pOutput->getErrStream() << error;
 		if ( !m_fileStack.empty() ) {
 			throw error;
@@ -419,31 +610,71 @@ void Processor::processStream( std::wistream& input )
 */
 void Processor::processFile( const std::wstring& fileName )
 {
+	if ( m_fileStack.empty() ) {
+		// Stop the prefetcher of the last run before its search results
+		// are cleared: Files may have been created or removed since.
+		delete m_pPrefetcher;
+		m_pPrefetcher = NULL;
+		m_fileFinderCache.clear();
+
+		// Start reading the include files in advance.
+		m_pPrefetcher = new FilePrefetcher( m_options, m_fileFinderCache );
+
+		// The source map replaces the #line directives. It covers
+		// the output of all files processed.
+		if ( m_pSourceMap == NULL && !m_options.getSourceMapFile().empty() ) {
+			m_pSourceMap = new SourceMap();
+		}
+		if ( m_pManifest == NULL && !m_options.getManifestFile().empty() ) {
+			m_pManifest = new BatchManifest();
+		}
+
+		// The recorded line counts of the skipped blocks are not valid
+		// any more if the files have been modified since the last run.
+		m_conditionalCache.clear();
+	}
+
 	File file;
 	file.setIncludeLevel( m_fileStack.size() );
 	m_fileStack.push( file );
 
 	try {
-		wistream& input = file.open( fileName );
+		// The root file is read block by block: Only its includes are
+		// read in advance.
+		const bool bIsRootFile = m_fileStack.size() == 1;
+		wistream& input = file.open( fileName, bIsRootFile ? NULL : m_pPrefetcher );
 
 		if ( !input.good() ) {
 			// Unable to open file 
 			throw error::C1068( fileName );
 		}
+		if ( bIsRootFile ) {
+			m_pPrefetcher->prefetchIncludes( file.getPath() );
+		} else if ( m_pCheckpoints != NULL ) {
+			m_pCheckpoints->addIncludeFile( file.getPath() );
+		}
 
 		// Reset the output line number counter to force emitting
 		// the #line directive for the next non empty line.
 		m_nOutputLineNumber = 0;
-		processInput();
+		const size_t conditionalStackSize = m_conditionalStack.size();
+		if ( m_fileStack.size() == 1 && !m_options.getCheckpointFile().empty() ) {
+			restoreCheckpoint( file );
+		}
+		processInput( conditionalStackSize );
 
 		// If an include file doesn't end with an empty line 
 		// emit the remaining part.
-		if ( m_outputBuffer.tellp() > 0 ) {
+		if ( m_outputArena.length() > m_nOutputLineStart ) {
 			const wstring* psNewLine = m_fileStack.size() > 1 ? &file.getDefaultNewLine() : NULL;
 			processNewLine( psNewLine );
 		}
 
-		if ( file.isAutoIncludedOnce() ) {
+		const wstring& sIncludeGuard = file.getIncludeGuard();
+		if ( !sIncludeGuard.empty() ) {
+			// Include again only if the guard macro is undefined.
+			m_includeGuards[file.getPath()] = sIncludeGuard;
+		} else if ( file.isAutoIncludedOnce() ) {
 			file.setIncludeOnce( true );
 		}
 		if ( file.isIncludeOnce() ) {
@@ -451,8 +682,22 @@ void Processor::processFile( const std::wstring& fileName )
 		}
 		m_fileStack.pop();
 		m_nOutputLineNumber = 0;
+
+		if ( m_fileStack.empty() ) {
+			flushOutput();
+			if ( m_pCheckpoints != NULL ) {
+				saveCheckpoints();
+			}
+			if ( m_options.verbose() ) {
+				m_pOutput->getLogStream() << L"include file lookups: " << m_fileFinderCache.getLookupCount()
+					<< L", file probes: " << m_fileFinderCache.getProbeCount() 
+					<< L", files prefetched: " << m_pPrefetcher->getPrefetchCount()
+					<< L" (" << m_pPrefetcher->getHitCount() << L" ready when included)" << endl;
+			}
+		}
 	} catch ( error::Error& error ) {
 		m_fileStack.pop();
+		flushOutput();
 
 		if ( error.getFilePath().empty() ) {
 			error.setFileInfo( file );
@@ -462,6 +707,8 @@ void Processor::processFile( const std::wstring& fileName )
 			throw;
 		}
 	} catch ( const std::exception& ex ) {
+		// The error may be reported by the caller: Emit the lines completed so far.
+		flushOutput();
 		wstring message = Convert::str2wcs( ex.what() );
 		error::C1001 error( message );
 		error.setFileInfo( file );
@@ -491,12 +738,22 @@ Token Processor::getNextToken( TokenExpression& tokenExpression )
 	tokenExpression.setTokenId( ++m_nProcessedTokenId );
 	token = m_pTokenStream->getNextToken( fileStream, tokenExpression );
 
-	size_t   nNewPosition = nOldPosition + tokenExpression.getTokenLength();
+	// The tokens of an expanded macro don't move the position in the file.
+	size_t   nNewPosition = nOldPosition;
+	if ( m_pTokenStream == m_pScanner ) {
+		nNewPosition+= tokenExpression.getTokenLength();
+		if ( token == TOK_NEW_LINE && m_fileStack.size() == 1 ) {
+			++m_nRootLineCount;
+		}
+	}
 	tokenExpression.setTokenRange( nOldPosition, nNewPosition );
 	currentFile.setPosition( nNewPosition );
 
 	if ( bSetFileToken ) {
-		currentFile.setLastToken( token, tokenExpression.getTokenRange() );
+		currentFile.setLastToken( token, tokenExpression.getTokenRange(), tokenExpression.getIdentifier() );
+	}
+	if ( token == TOK_IDENTIFIER && m_pReferencedIdentifiers != NULL ) {
+		m_pReferencedIdentifiers->insert( tokenExpression.getIdentifier() );
 	}
 	return token;
 }
@@ -568,6 +825,8 @@ void Processor::applyOptions()
 	assert( m_bOptionsApplied == false );
 	m_bOptionsApplied = true;
 
+	m_bOutputRangeRestricted = !m_options.getOutputRange().isEmpty();
+
 	m_pScanner     = Scanner::createScanner( m_options );
 	m_pTokenStream = m_pScanner;
 
@@ -580,6 +839,10 @@ void Processor::applyOptions()
 	// Add buildin macros.
 	if ( !m_options.undefAllBuildin() ) {
 		BuildinMacro::addBuildinMacros( m_options, m_macros );
+		for ( MacroSet::iterator itMacro = m_macros.begin(); itMacro != m_macros.end(); ++itMacro ) {
+			Macro& macro = itMacro->second;
+			macro.setVersion( ++m_nMacroVersion );
+		}
 	}
 
 	const StringArray& undefs = m_options.getUndefines();
@@ -598,31 +861,354 @@ void Processor::applyOptions()
 		const wstring& identifier = itDefine->first;
 		const wstring& expression = itDefine->second;
 
-		wstring       code = wstring(L"#define ") + identifier + L" " + expression;
-		wstringstream input(code);
 		// Trace( L"processing macro definition found at command line:" << code );
-		bool bEmitLineBackup  = m_options.emitLine();
-		bool bEmtyLinesBackup = m_options.eliminateEmptyLines();
-		m_options.emitLine( false );
-		m_options.eliminateEmptyLines( true );
-		processStream( input );
-		m_options.eliminateEmptyLines( bEmtyLinesBackup );
-		m_options.emitLine( bEmitLineBackup );
+		processDefinition( identifier + L" " + expression );
 	}
 }
 
 
+/**
+** @brief Process a macro definition given as text.
+**
+** @param sDefinition The text following \#define.
+*/
+void Processor::processDefinition( const std::wstring& sDefinition )
+{
+	wstring       code = wstring(L"#define ") + sDefinition;
+	wstringstream input(code);
+	bool bEmitLineBackup  = m_options.emitLine();
+	bool bEmtyLinesBackup = m_options.eliminateEmptyLines();
+	m_options.emitLine( false );
+	m_options.eliminateEmptyLines( true );
+	processStream( input );
+	m_options.eliminateEmptyLines( bEmtyLinesBackup );
+	m_options.emitLine( bEmitLineBackup );
+}
+
+
+/**
+** @brief Resume processing the root file at the last valid checkpoint preceding the output range.
+**
+** The checkpoints are read from the checkpoint file. If one of them is 
+** valid for the current text of the root file the macros, the conditional
+** directives and the files included are restored and the lines preceding 
+** the checkpoint are skipped. Otherwise the file is processed from the
+** first line. In both cases the checkpoints preceding the output range 
+** are recorded (see #addCheckpoint). The macros are restored by applying
+** the changes recorded up to the checkpoint to the macros defined by the
+** options.
+**
+** The line feeds of the skipped lines are written as if the lines have 
+** been processed. This is only possible if they don't depend on the new 
+** line characters of the input. Messages (warnings) are not repeated.
+**
+** @param file The root file (opened but not read yet).
+*/
+void Processor::restoreCheckpoint( File& file )
+{
+	if ( !m_bOptionsApplied ) {
+		applyOptions();
+	}
+
+	delete m_pCheckpoints;
+	m_pCheckpoints        = NULL;
+	m_nRootLineCount      = 0;
+	m_nNextCheckpointLine = CHECKPOINT_INTERVAL;
+
+	if ( !m_bOutputRangeRestricted ) {
+		return;
+	}
+	if ( m_options.getNewLineOutput() == Options::NLO_AS_IS && !m_options.eliminateEmptyLines() ) {
+		return;
+	}
+
+	const wstring& sCheckpointFile = m_options.getCheckpointFile();
+	m_pCheckpoints = new CheckpointCache( file.getPath(), CheckpointCache::hashOptions( m_options ) );
+	if ( File::isFile( sCheckpointFile ) ) {
+		File cacheFile;
+		m_pCheckpoints->read( cacheFile.open( sCheckpointFile ) );
+		m_pCheckpoints->checkIncludeFiles();
+	}
+
+	// The root file is read once: The checkpoints are verified by the text
+	// in memory and the processor continues with the text following the
+	// checkpoint restored.
+	wstring sRootText;
+	file.readContent( sRootText );
+	m_pCheckpoints->setRootText( sRootText );
+
+	const CheckpointCache::Checkpoint* pCheckpoint = m_pCheckpoints->find( m_options.getOutputRange().getStartIndex() );
+	if ( pCheckpoint != NULL ) {
+		sRootText.erase( 0, m_pCheckpoints->getLineOffset( pCheckpoint->nLineCount ) );
+		m_pCheckpoints->restoreMacros( *pCheckpoint, m_macros, m_nMacroVersion );
+	}
+	file.setContent( sRootText );
+
+	// The macro changes of the next checkpoint are relative to these macros.
+	m_checkpointMacros.clear();
+	for ( MacroSet::const_iterator itMacro = m_macros.begin(); itMacro != m_macros.end(); ++itMacro ) {
+		if ( !itMacro->second.isBuildin() ) {
+			m_checkpointMacros.insert( itMacro->first );
+		}
+	}
+	m_nCheckpointMacroVersion = m_nMacroVersion;
+	if ( pCheckpoint == NULL ) {
+		return;
+	}
+	const CheckpointCache::Checkpoint& checkpoint = *pCheckpoint;
+
+	m_includeOnceFiles = checkpoint.includeOnceFiles;
+	m_includeGuards    = checkpoint.includeGuards;
+	m_guardedIncludes  = checkpoint.guardedIncludes;
+	typedef CheckpointCache::LocationArray LocationArray;
+	for ( LocationArray::const_iterator itLocation = checkpoint.conditionals.begin(); itLocation != checkpoint.conditionals.end(); ++itLocation ) {
+		m_conditionalStack.push( *itLocation );
+	}
+
+	// The line feeds of the lines skipped.
+	file.setDefaultNewLine( checkpoint.sNewLine );
+	for ( size_t nLine = 0; nLine < checkpoint.nOutputLineCount; ++nLine ) {
+		processNewLine( &checkpoint.sNewLine );
+	}
+
+	file.setPosition( checkpoint.nPosition );
+	file.setLine( checkpoint.nLine );
+	file.setCounter( checkpoint.nCounter );
+	m_nOutputLineNumber   = checkpoint.nOutputLineNumber;
+	m_nRootLineCount      = checkpoint.nLineCount;
+	m_nNextCheckpointLine = m_nRootLineCount + CHECKPOINT_INTERVAL;
+
+	if ( m_options.verbose() ) {
+		m_pOutput->getLogStream() << L"resumed at checkpoint: " << file.getPath() 
+			<< L" (" << (unsigned int)checkpoint.nLine << L')' << endl;
+	}
+}
+
+
+/**
+** @brief Record the state at the current line boundary of the root file.
+**
+** Called after a line break of the root file preceding the output range.
+** Checkpoints are taken between lines of active code only i.e. not 
+** within a comment, a string or a skipped conditional block. After an
+** error no more checkpoints are taken because the error would not be 
+** reported by a run resuming at the checkpoint.
+*/
+void Processor::addCheckpoint()
+{
+	if ( m_pScanner->getContext() != CTX_DEFAULT || m_pScanner->getContextDepth() != 0 ) {
+		return;
+	}
+	if ( m_eMaxMsgSeverity >= error::Error::SEV_ERROR ) {
+		return;
+	}
+
+	const File& file = getRootFile();
+	CheckpointCache::Checkpoint& checkpoint = m_pCheckpoints->addCheckpoint( m_nRootLineCount );
+
+	checkpoint.nPosition         = file.getPosition();
+	checkpoint.nLine             = file.getLine();
+	checkpoint.nCounter          = file.getCounter();
+	checkpoint.sNewLine          = file.getDefaultNewLine();
+	checkpoint.nOutputLineCount  = m_nOutputLineCount;
+	checkpoint.nOutputLineNumber = m_nOutputLineNumber;
+
+	// Only the changes of the macros since the last checkpoint are recorded.
+	StringSet macros;
+	for ( MacroSet::const_iterator itMacro = m_macros.begin(); itMacro != m_macros.end(); ++itMacro ) {
+		const Macro& macro = itMacro->second;
+		if ( macro.isBuildin() ) {
+			continue;
+		}
+		macros.insert( macro.getIdentifier() );
+		if ( macro.getVersion() > m_nCheckpointMacroVersion ) {
+			checkpoint.macros.push_back( macro );
+		}
+	}
+	for ( StringSet::const_iterator itIdentifier = m_checkpointMacros.begin(); itIdentifier != m_checkpointMacros.end(); ++itIdentifier ) {
+		if ( macros.find( *itIdentifier ) == macros.end() ) {
+			checkpoint.undefinedMacros.push_back( *itIdentifier );
+		}
+	}
+	m_checkpointMacros.swap( macros );
+	m_nCheckpointMacroVersion = m_nMacroVersion;
+
+	checkpoint.includeOnceFiles = m_includeOnceFiles;
+	checkpoint.includeGuards    = m_includeGuards;
+	checkpoint.guardedIncludes  = m_guardedIncludes;
+	const LocationStack::container_type& conditionals = m_conditionalStack.container();
+	checkpoint.conditionals.assign( conditionals.begin(), conditionals.end() );
+
+	m_nNextCheckpointLine = m_nRootLineCount + CHECKPOINT_INTERVAL;
+}
+
+
+/**
+** @brief Write the checkpoints recorded.
+**
+** The prefix hashes of the new checkpoints are set from the text of the
+** root file read by #restoreCheckpoint. Old checkpoints which don't match
+** the current text are dropped.
+*/
+void Processor::saveCheckpoints()
+{
+	m_pCheckpoints->updateHashes();
+
+	const wstring& sCheckpointFile = m_options.getCheckpointFile();
+	const CodePageInfo& codePage = CodePageInfo::getCodePageInfo( CPID_UTF8 );
+	FileOutputStream stream;
+	if ( !stream.open( sCheckpointFile, codePage ) ) {
+		throw error::C1083( sCheckpointFile );
+	}
+	stream.exceptions( wostream::failbit | wostream::badbit );
+	m_pCheckpoints->write( stream );
+	stream.close();
+
+	delete m_pCheckpoints;
+	m_pCheckpoints = NULL;
+}
+
+
 /**
 ** @brief Evaluate the expression of an \#if or \#elif directive.
+**
+** The results are cached by the line of the directive and the 
+** versions of the macros referenced (see #ConditionalCache). If a 
+** header is included again with unchanged macros the expression is
+** just skipped.
 */
 bool Processor::evaluateConditionalDirective()
 {
+	const File&      file           = getCurrentFile();
+	const wstring    sFilePath      = file.getPath();
+	const size_t     nLine          = file.getLine();
+	bool             bCacheable     = !sFilePath.empty();
+	bool             isTrue         = false;
+
+	if ( bCacheable && m_conditionalCache.lookup( sFilePath, nLine, m_macros, isTrue ) ) {
+		skipConditionalDirective();
+		return isTrue;
+	}
+
 	TokenExpressions expressions;
+	StringSet        identifiers;
 	bool             bContinue      = true;
 	bool             bIgnoreNewLine = false;
 	bool             bExpandMacro   = true;
 	int              nParenthesis   = 0;
 
+	m_pReferencedIdentifiers = &identifiers;
+	try {
+		while ( bContinue ) {
+			Token token = getNextToken();
+
+			switch ( token ) {
+				case TOK_NEW_LINE:
+					if ( m_tokenExpression.context == CTX_BLOCK_COMMENT ) {
+						// continue until comment ends
+					} else if ( !bIgnoreNewLine ) {
+						bContinue = false;
+					}
+					processNewLine();
+					break;
+				case TOK_EOL_BACKSLASH:
+					bIgnoreNewLine = true;
+					break;
+				case TOK_BLOCK_COMMENT:
+					break;
+				case TOK_LINE_COMMENT:
+					break;
+				case TOK_SPACE:
+					// space is just noise.
+					break;
+				case TOK_OP_DEFINED:
+					expressions.push_back( m_tokenExpression );
+					bExpandMacro = false;
+					break;
+				case TOK_LEFT_PARENTHESIS:
+					expressions.push_back( m_tokenExpression );
+					++nParenthesis;
+					break;
+				case TOK_RIGHT_PARENTHESIS:
+					if ( nParenthesis == 0 ) {
+						// Unmatched parenthesis.
+						throw error::C1012();
+					} else {
+						expressions.push_back( m_tokenExpression );
+						--nParenthesis;
+						bExpandMacro = true;
+					}
+					break;
+				case TOK_IDENTIFIER:
+					if ( bExpandMacro ) {
+						const wstring& identifier = m_tokenExpression.getText();
+						MacroSet::iterator itMacro  = m_macros.find( identifier );
+
+						// no macro: return as is.
+						if ( itMacro == m_macros.end() ) {
+							expressions.push_back( m_tokenExpression );
+						} else if ( itMacro->second.hasConstantValue() ) {
+							// The expression evaluator takes the value from the macro.
+							expressions.push_back( m_tokenExpression );
+						} else {
+							Macro&           macro = itMacro->second;
+							TokenExpressions macroExpressions;
+							expandMacro( macro, macroExpressions );
+							expressions.insert( expressions.end(), macroExpressions.begin(), macroExpressions.end() );
+						}
+					} else {
+						expressions.push_back( m_tokenExpression );
+						bExpandMacro = true;
+					}
+					break;
+				case TOK_END_OF_FILE:
+					bContinue = false;
+					break;
+				default:
+					expressions.push_back( m_tokenExpression );
+					bExpandMacro = true;
+					break;
+			} // switch
+
+			// reset ignore end of line flag.
+			if ( token != TOK_EOL_BACKSLASH ) {
+				bIgnoreNewLine = false;
+			}
+		}
+	} catch ( ... ) {
+		m_pReferencedIdentifiers = NULL;
+		throw;
+	}
+	m_pReferencedIdentifiers = NULL;
+
+	if ( nParenthesis > 0 ) {
+		throw error::C1012();
+	}
+
+	Expression evaluator;
+	evaluator.build( expressions );
+	const Expression::Value& value = evaluator.evaluate( &m_macros );
+	isTrue = value.getInteger() != 0;
+
+	if ( bCacheable ) {
+		m_conditionalCache.insert( sFilePath, nLine, identifiers, m_macros, isTrue );
+	}
+	return isTrue;
+}
+
+/**
+** @brief Skip the tokens of an \#if or \#elif expression.
+**
+** Used if the result of the expression has been found in the cache
+** and for the directives without effect preceding the output range.
+** The new lines are processed as in #evaluateConditionalDirective 
+** to keep the line numbers in sync.
+*/
+void Processor::skipConditionalDirective()
+{
+	bool bContinue      = true;
+	bool bIgnoreNewLine = false;
+
 	while ( bContinue ) {
 		Token token = getNextToken();
 
@@ -638,56 +1224,10 @@ bool Processor::evaluateConditionalDirective()
 			case TOK_EOL_BACKSLASH:
 				bIgnoreNewLine = true;
 				break;
-			case TOK_BLOCK_COMMENT:
-				break;
-			case TOK_LINE_COMMENT:
-				break;
-			case TOK_SPACE:
-				// space is just noise.
-				break;
-			case TOK_OP_DEFINED:
-				expressions.push_back( m_tokenExpression );
-				bExpandMacro = false;
-				break;
-			case TOK_LEFT_PARENTHESIS:
-				expressions.push_back( m_tokenExpression );
-				++nParenthesis;
-				break;
-			case TOK_RIGHT_PARENTHESIS:
-				if ( nParenthesis == 0 ) {
-					// Unmatched parenthesis.
-					throw error::C1012();
-				} else {
-					expressions.push_back( m_tokenExpression );
-					--nParenthesis;
-					bExpandMacro = true;
-				}
-				break;
-			case TOK_IDENTIFIER:
-				if ( bExpandMacro ) {
-					const wstring& identifier = m_tokenExpression.getText();
-					MacroSet::iterator itMacro  = m_macros.find( identifier );
-
-					// no macro: return as is.
-					if ( itMacro == m_macros.end() ) {
-						expressions.push_back( m_tokenExpression );
-					} else {
-						Macro&           macro = itMacro->second;
-						TokenExpressions macroExpressions;
-						expandMacro( macro, macroExpressions );
-						expressions.insert( expressions.end(), macroExpressions.begin(), macroExpressions.end() );
-					}
-				} else {
-					expressions.push_back( m_tokenExpression );
-					bExpandMacro = true;
-				}
-				break;
 			case TOK_END_OF_FILE:
 				bContinue = false;
 				break;
 			default:
-				expressions.push_back( m_tokenExpression );
-				bExpandMacro = true;
 				break;
 		} // switch
 
@@ -696,15 +1236,35 @@ bool Processor::evaluateConditionalDirective()
 			bIgnoreNewLine = false;
 		}
 	}
-	if ( nParenthesis > 0 ) {
-		throw error::C1012();
-	}
+}
 
-	Expression evaluator;
-	evaluator.build( expressions );
-	const Expression::Value& value = evaluator.evaluate( &m_macros );
-	bool  isTrue = value.getInteger() != 0;
-	return isTrue;
+/**
+** @brief Set the scanner into the context of a skipped conditional block.
+**
+** If the block has been skipped before (i.e. the file is included again)
+** the number of lines up to the matching \#elif, \#else or \#endif is
+** known and the scanner does not have to look for nested directives.
+** Otherwise the lines of the block are recorded for the next time.
+**
+** @param context CTX_CONDITIONAL_FALSE or CTX_CONDITIONAL_DONE.
+*/
+void Processor::beginConditionalBlock( Context context )
+{
+	assert( m_pTokenStream == m_pScanner );
+	m_pScanner->pushContext( context );
+
+	const File&    file      = getCurrentFile();
+	const wstring& sFilePath = file.getPath();
+	size_t         nLine     = file.getLine();
+	size_t         nLineCount;
+
+	if ( sFilePath.empty() ) {
+		// Streams without a path are processed once only.
+	} else if ( m_conditionalCache.lookupSkip( sFilePath, nLine, context, nLineCount ) ) {
+		m_pScanner->skipConditionalLines( nLineCount );
+	} else {
+		m_conditionalCache.beginSkip( sFilePath, nLine, context );
+	}
 }
 
 /**
@@ -712,9 +1272,18 @@ bool Processor::evaluateConditionalDirective()
 */
 void Processor::processInput()
 {
-	Token  token = TOK_END_OF_FILE;
-	size_t conditionalStackSize = m_conditionalStack.size();
+	processInput( m_conditionalStack.size() );
+}
 
+/**
+** @brief Process the current input stream.
+**
+** @param conditionalStackSize The number of conditional directives opened
+** before the stream (the directives opened within have to be closed).
+*/
+void Processor::processInput( size_t conditionalStackSize )
+{
+	Token  token = TOK_END_OF_FILE;
 
 	if ( !m_bOptionsApplied ) {
 		applyOptions();
@@ -722,9 +1291,41 @@ void Processor::processInput()
 
 	do {
 		token = getNextToken();
+
+		if ( m_bOutputRangeRestricted && m_pTokenStream == m_pScanner ) {
+			// Nothing is emitted for the tokens outside of the output range.
+			// So these are neither expanded nor formatted.
+			const Range&  outputRange = m_options.getOutputRange();
+			const Range&  tokenRange  = getRootFile().getCurrentTokenRange();
+			const Context context     = m_pScanner->getContext();
+
+			if ( tokenRange.getEndIndex() <= outputRange.getStartIndex() ) {
+				processTokenOutsideRange( token );
+				if ( token == TOK_NEW_LINE && m_pCheckpoints != NULL && m_nRootLineCount >= m_nNextCheckpointLine && m_fileStack.size() == 1 ) {
+					addCheckpoint();
+				}
+				continue;
+			}
+			if ( tokenRange.getStartIndex() >= outputRange.getEndIndex() && m_fileStack.size() == 1 ) {
+				if ( token != TOK_NEW_LINE ) {
+					processTokenOutsideRange( token );
+					continue;
+				}
+				// The line ending within the output range is still completed.
+				processToken( token );
+				if ( context == CTX_DEFAULT || context == CTX_CONDITIONAL_FALSE || context == CTX_CONDITIONAL_DONE ) {
+					finishOutputRange( conditionalStackSize );
+					return;
+				}
+				continue;
+			}
+		}
 		processToken( token );
 	} while ( token != TOK_END_OF_FILE );
 
+	// A conditional block not terminated must not be stored.
+	m_conditionalCache.cancelSkip();
+
 
 	// Check for unmatched conditionals
 	if ( conditionalStackSize != m_conditionalStack.size() ) {
@@ -762,13 +1363,16 @@ bool Processor::processToken( int scannerToken )
 			processBlockComment();
 			break;
 		case TOK_SQL_LINE_COMMENT:
-			appendToOutputLineBuffer( tokenText );
+			if ( !m_options.stripSqlComments() || ( m_options.keepHints() && isHint( tokenText ) ) ) {
+				appendToOutputLineBuffer( tokenText );
+			}
 			break;
 		case TOK_NEW_LINE:
+			m_conditionalCache.countSkippedLine();
 			processNewLine( &tokenText );
 			break;
 		case TOK_SPACE:
-			appendToOutputLineBuffer( tokenText );
+			processSpace();
 			break;
 		case TOK_STRING:
 			appendToOutputLineBuffer( tokenText );
@@ -908,6 +1512,74 @@ bool Processor::processToken( int scannerToken )
 }
 
 
+/**
+** @brief Process a token outside of the output range.
+**
+** Only the directives which change the state of the processor (the macros,
+** the conditional blocks, the included files and the line numbers) are
+** processed. Everything else is just dropped without expanding macros
+** (but \c __COUNTER__ which has to count the uses before the range too).
+*/
+void Processor::processTokenOutsideRange( int scannerToken )
+{
+	switch( scannerToken ) {
+		case TOK_NEW_LINE:
+		case TOK_END_OF_FILE:
+		case TOK_DIR_DEFINE:
+		case TOK_DIR_UNDEF:
+		case TOK_DIR_UNDEFALL:
+		case TOK_DIR_IF:
+		case TOK_DIR_IFDEF:
+		case TOK_DIR_IFNDEF:
+		case TOK_DIR_ELIF:
+		case TOK_DIR_ELSE:
+		case TOK_DIR_ENDIF:
+		case TOK_DIR_INCLUDE:
+		case TOK_DIR_LINE:
+		case TOK_DIR_PRAGMA:
+		case TOK_DIR_IMPORT:
+		case TOK_DIR_USING:
+		case TOK_ADSALESNG_DIRECTIVE:
+			processToken( scannerToken );
+			break;
+		case TOK_DIR_ERROR:
+		case TOK_DIR_MESSAGE:
+		case TOK_DIR_EXEC:
+			skipConditionalDirective();
+			break;
+		case TOK_IDENTIFIER:
+			// Keep the values of __COUNTER__ within the range.
+			if ( m_tokenExpression.identifier == L"__COUNTER__" ) {
+				processIdentifier();
+			}
+			break;
+		default:
+			break;
+	}
+}
+
+
+/**
+** @brief Leave the rest of the root file unread.
+**
+** Called if the root file position has passed the end of the output range.
+** The conditional blocks still open are closed as if the file ended here.
+*/
+void Processor::finishOutputRange( size_t nConditionalStackSize )
+{
+	m_conditionalCache.cancelSkip();
+
+	Context context = m_pScanner->getContext();
+	while ( context == CTX_CONDITIONAL_FALSE || context == CTX_CONDITIONAL_DONE ) {
+		m_pScanner->popContext( context );
+		context = m_pScanner->getContext();
+	}
+	while ( m_conditionalStack.size() > nConditionalStackSize ) {
+		m_conditionalStack.pop();
+	}
+}
+
+
 /**
 ** @brief Process the input stream to collect the macro arguments.
 **
@@ -1204,32 +1876,63 @@ void Processor::processNewLine( const wstring* psNewLine )
 		file.setDefaultNewLine( *psNewLine );
 	}
 
-	wostringstream lineOutput;
-	const size_t nCharCount = emitBuffer( lineOutput );
+	// The current line is the rest of the output arena. An empty line is
+	// eliminated by just not appending the line feed.
+	if ( m_options.trimTrailingBlanks() ) {
+		trimOutputLine();
+	}
+	const size_t nCharCount = m_outputArena.length() - m_nOutputLineStart;
+	const bool   bFramed    = m_options.frameBatches();
+	const bool   bSeparator = nCharCount != 0 && ( bFramed || m_pManifest != NULL ) && isBatchSeparator();
 
-	if ( nCharCount != 0 && this->m_pTokenStream == m_pScanner ) {
-		if ( m_options.emitLine() && (m_nOutputLineNumber != file.getLine() || file.getLine() == 1 ) ) {
-			emitLineDirective( m_pOutput->getStream() );
-			m_nOutputLineNumber = file.getLine();
+	if ( m_pManifest != NULL ) {
+		// The batches are hashed while they are written.
+		if ( bSeparator ) {
+			m_pManifest->endBatch();
+		} else {
+			m_pManifest->addLine( m_outputArena.c_str() + m_nOutputLineStart, nCharCount, file.getPath(), file.getLine() );
 		}
 	}
 
+	if ( bFramed && bSeparator ) {
+		// The separator itself is not part of any batch.
+		m_outputArena.erase( m_nOutputLineStart );
+		writeFrame( m_nOutputLineStart );
+	} else {
+		if ( bFramed && m_nFrameLine == 0 && m_outputArena.find_first_not_of( L" \t", m_nOutputLineStart ) != wstring::npos ) {
+			m_sFrameFile = file.getPath();
+			m_nFrameLine = file.getLine();
+		}
+
+		if ( nCharCount != 0 && this->m_pTokenStream == m_pScanner ) {
+			if ( m_pSourceMap != NULL ) {
+				m_pSourceMap->addLine( m_nOutputLineCount + 1, file.getPath(), file.getLine() );
+			} else if ( m_options.emitLine() && (m_nOutputLineNumber != file.getLine() || file.getLine() == 1 ) ) {
+				m_lineDirective.erase();
+				emitLineDirective( m_lineDirective );
+				m_outputArena.insert( m_nOutputLineStart, m_lineDirective );
+				m_nOutputLineNumber = file.getLine();
+				++m_nOutputLineCount;
+			}
+		}
+
 
-	if ( psNewLine != NULL ) {
-		if ( nCharCount != 0 || !m_options.eliminateEmptyLines() ) {
-			emitLineFeed( lineOutput, *psNewLine );
+		if ( psNewLine != NULL ) {
+			if ( nCharCount != 0 || !m_options.eliminateEmptyLines() ) {
+				m_outputArena+= getLineFeed( *psNewLine );
 
-			++m_nOutputLineNumber;
-			m_nSkippedLineCount = 0;
-		} else {
-			++m_nSkippedLineCount;
+				++m_nOutputLineNumber;
+				++m_nOutputLineCount;
+				m_nSkippedLineCount = 0;
+			} else {
+				++m_nSkippedLineCount;
+			}
 		}
 	}
 
-	if ( lineOutput.tellp() > 0 ) {
-		const wstring line = lineOutput.str();
-		m_pOutput->getStream() << line ;
-		m_pOutput->getStream().clear();
+	m_nOutputLineStart = m_outputArena.length();
+	if ( m_nOutputLineStart >= OUTPUT_BLOCK_SIZE ) {
+		flushOutput();
 	}
 
 	if ( this->m_pTokenStream == m_pScanner ) {
@@ -1260,12 +1963,19 @@ void Processor::processBlockComment()
 
 	assert( m_tokenExpression.token == TOK_BLOCK_COMMENT );
 
+	// The first part of the comment decides if it is a hint.
+	const bool bKeep = m_options.keepBlockComments() 
+	                || ( m_options.keepHints() && isHint( m_tokenExpression.text ) );
+
 	for ( ;; ) {
 		switch ( token ) {
 			case TOK_BLOCK_COMMENT:
-				if ( m_options.keepBlockComments() ) {
+				if ( bKeep ) {
 					const wstring& commentText = m_tokenExpression.text;
 					appendToOutputLineBuffer(  commentText );
+				} else if ( m_options.collapseBlanks() ) {
+					// Keep the tokens around the comment separated.
+					processSpace();
 				}
 				break;
 			case TOK_NEW_LINE:
@@ -1288,6 +1998,75 @@ void Processor::processBlockComment()
 	} 
 }
 
+/**
+** @brief Process blanks found in the input.
+**
+** If #Options::collapseBlanks is set the blanks are replaced by a single
+** blank unless the output already ends with one. Blanks at the start of 
+** a line are removed if #Options::trimLeadingBlanks is set.
+*/
+void Processor::processSpace()
+{
+	const bool bLineStart = m_outputArena.length() == m_nOutputLineStart;
+
+	if ( bLineStart && m_options.trimLeadingBlanks() ) {
+		return;
+	}
+	if ( m_options.collapseBlanks() ) {
+		static const wstring blank( L" " );
+		if ( bLineStart || !Util::isBlank( m_outputArena[m_outputArena.length() - 1] ) ) {
+			appendToOutputLineBuffer( blank );
+		}
+	} else {
+		appendToOutputLineBuffer( m_tokenExpression.text );
+	}
+}
+
+
+/**
+** @brief Remove the trailing blanks of the current output line.
+**
+** Lines ending within a multi line string literal are left alone.
+*/
+void Processor::trimOutputLine()
+{
+	const Context context = m_tokenExpression.getContext();
+	if ( context == CTX_SQUOTE_STRING || context == CTX_DQUOTE_STRING ) {
+		return;
+	}
+
+	size_t nEnd = m_outputArena.length();
+	while ( nEnd > m_nOutputLineStart && Util::isBlank( m_outputArena[nEnd - 1] ) ) {
+		--nEnd;
+	}
+	m_outputArena.erase( nEnd );
+}
+
+
+/**
+** @brief Check if a comment is an optimizer hint.
+**
+** Hints are block comments starting with <tt>/\*+</tt> (Oracle) or 
+** <tt>/\*!</tt> (MySQL) and SQL line comments starting with <tt>--+</tt>.
+*/
+bool Processor::isHint( const wstring& commentText ) throw()
+{
+	if ( commentText.length() < 3 ) {
+		return false;
+	}
+	const wchar_t c0 = commentText[0];
+	const wchar_t c1 = commentText[1];
+	const wchar_t c2 = commentText[2];
+
+	if ( c0 == L'/' && c1 == L'*' ) {
+		return c2 == L'+' || c2 == L'!';
+	} else if ( c0 == L'-' && c1 == L'-' ) {
+		return c2 == L'+';
+	}
+	return false;
+}
+
+
 /**
 ** @brief Finish processing a directive which is complete.
 **
@@ -1724,6 +2503,7 @@ void Processor::processDefineDirective()
 		}
 	}
 
+	macro.setVersion( ++m_nMacroVersion );
 	m_macros[macro.getIdentifier()] = macro;
 }
 
@@ -1852,14 +2632,26 @@ void Processor::processIncludeDirective()
 		throw;
 	}
 
+	// The same request in the same file always finds the same file. 
+	// Skip it without searching if the file has an include guard which
+	// is still defined.
+	File&   currentFile = getCurrentFile();
+	wstring sIncludeKey = bIsSysInclude 
+	                    ? L'<' + sFilePath + L'>' 
+	                    : currentFile.getPath() + L"|\"" + sFilePath + L'"';
+	StringDictionary::const_iterator itInclude = m_guardedIncludes.find( sIncludeKey );
+	if ( itInclude != m_guardedIncludes.end() && isIncludeGuardDefined( itInclude->second ) ) {
+		finishDirective( false );
+		return;
+	}
+
 	const StringArray&  includeDirectories = m_options.getIncludeDirectories();
 	wstring sFullPath;
 	if ( bIsSysInclude ) {
-		FileFinder filefinder( includeDirectories );
+		FileFinder filefinder( includeDirectories, &m_fileFinderCache );
 		sFullPath = filefinder.findFile( sFilePath );
 	} else {
-		File&   currentFile = getCurrentFile();
-		FileFinder filefinder( includeDirectories, currentFile.getPath() );
+		FileFinder filefinder( includeDirectories, currentFile.getPath(), &m_fileFinderCache );
 		sFullPath = filefinder.findFile( sFilePath );
 	}
 
@@ -1869,8 +2661,9 @@ void Processor::processIncludeDirective()
 	}
 
 	// Verify if the file was already included. Do not read the file if it
-	// is tagged with #pragma once.
-	bool bDoInclude  = m_includeOnceFiles.count( sFullPath ) == 0;
+	// is tagged with #pragma once or if its include guard is defined.
+	bool bDoInclude  = m_includeOnceFiles.count( sFullPath ) == 0 
+	                && !isIncludeGuardDefined( sFullPath );
 
 	int   includedCt  = 0;
 	const FileStack::container_type& c = m_fileStack.container();
@@ -1881,6 +2674,7 @@ void Processor::processIncludeDirective()
 				bDoInclude = false;
 				break;
 			} else {
+				flushOutput();
 				m_pOutput->getLogStream() << L"Warning: " << sFilePath << L" has already been included." << endl;
 				includedCt++;
 			}
@@ -1898,8 +2692,10 @@ void Processor::processIncludeDirective()
 	finishDirective( false );
 
 	if ( bDoInclude ) {
-		if (m_options.verbose())
+		if ( m_options.verbose() ) {
+			flushOutput();
 			m_pOutput->getLogStream() << L"including " << sFilePath << endl;
+		}
 
 		if ( includedCt > 1 ) {
 			throw error::C1014( sFilePath );
@@ -1910,6 +2706,22 @@ void Processor::processIncludeDirective()
 		}
 	}
 
+	if ( m_includeGuards.count( sFullPath ) != 0 ) {
+		m_guardedIncludes[sIncludeKey] = sFullPath;
+	}
+}
+
+/**
+** @brief Check if the include guard macro of a file is defined.
+**
+** @param sFullPath The full path of the file.
+** @returns false if the file has no include guard or if the guard macro is not defined.
+*/
+bool Processor::isIncludeGuardDefined( const std::wstring& sFullPath ) const
+{
+	StringDictionary::const_iterator itGuard = m_includeGuards.find( sFullPath );
+
+	return itGuard != m_includeGuards.end() && m_macros.count( itGuard->second ) != 0;
 }
 
 /**
@@ -1924,8 +2736,7 @@ void Processor::processIfDirective()
 	bool isTrue = evaluateConditionalDirective();
 
 	if ( !isTrue ) {
-		assert( m_pTokenStream == m_pScanner );
-		m_pScanner->pushContext( CTX_CONDITIONAL_FALSE );
+		beginConditionalBlock( CTX_CONDITIONAL_FALSE );
 	}
 
 	m_conditionalStack.push( location );
@@ -1959,8 +2770,7 @@ void Processor::processIfdefDirective()
 	MacroSet::const_iterator itMacro = m_macros.find( identifier );
 	if ( itMacro == m_macros.end() ) {
 		// Not found: set scanner into conditional false mode.
-		assert( m_pTokenStream == m_pScanner );
-		m_pScanner->pushContext( CTX_CONDITIONAL_FALSE );
+		beginConditionalBlock( CTX_CONDITIONAL_FALSE );
 	}
 }
 
@@ -1991,8 +2801,7 @@ void Processor::processIfndefDirective()
 
 	if ( itMacro != m_macros.end() ) {
 		// Not found: set scanner into conditional false mode.
-		assert( m_pTokenStream == m_pScanner );
-		m_pScanner->pushContext( CTX_CONDITIONAL_FALSE );
+		beginConditionalBlock( CTX_CONDITIONAL_FALSE );
 	}
 
 	
@@ -2016,10 +2825,11 @@ void Processor::processElseDirective()
 
 	Context context = m_tokenExpression.getContext();
 
+	m_conditionalCache.endSkip();
 	if ( context == CTX_CONDITIONAL_FALSE ) {
 		m_pScanner->popContext( CTX_CONDITIONAL_FALSE );
 	} else {
-		m_pScanner->pushContext( CTX_CONDITIONAL_DONE );
+		beginConditionalBlock( CTX_CONDITIONAL_DONE );
 	}
 }
 
@@ -2034,16 +2844,18 @@ void Processor::processElifDirective()
 	}
 
 	Context context = m_tokenExpression.getContext();
+
+	m_conditionalCache.endSkip();
 	if ( context == CTX_CONDITIONAL_FALSE ) {
 		m_pScanner->popContext( CTX_CONDITIONAL_FALSE );
 
 		bool isTrue = evaluateConditionalDirective();
 
 		if ( !isTrue ) {
-			m_pScanner->pushContext( CTX_CONDITIONAL_FALSE );
+			beginConditionalBlock( CTX_CONDITIONAL_FALSE );
 		}
 	} else {
-		m_pScanner->pushContext( CTX_CONDITIONAL_DONE );
+		beginConditionalBlock( CTX_CONDITIONAL_DONE );
 	}
 }
 
@@ -2059,6 +2871,7 @@ void Processor::processEndifDirective()
 		throw error::C1020();
 	}
 
+	m_conditionalCache.endSkip();
 	m_conditionalStack.pop();
 	if ( context == CTX_CONDITIONAL_FALSE ) {
 		m_pScanner->popContext( CTX_CONDITIONAL_FALSE );
@@ -2227,7 +3040,7 @@ void Processor::processAdSalesNGDirective()
 		}
 		wstring sFilePath = m_tokenExpression.getText() + L".syb";
 		File& currentFile = getCurrentFile();
-		FileFinder fileFinder( m_options.getIncludeDirectories(), currentFile.getPath() );
+		FileFinder fileFinder( m_options.getIncludeDirectories(), currentFile.getPath(), &m_fileFinderCache );
 		wstring sFullPath = fileFinder.findFile( sFilePath );
 
 		if ( sFullPath.empty() ) {
@@ -2252,8 +3065,8 @@ void Processor::processAdSalesNGDirective()
 */
 void Processor::appendToOutputLineBuffer( const wstring& output )
 {
-	if ( isRootFilePositionWithinEmitRange() ) {
-		m_outputBuffer << output;
+	if ( !m_bOutputRangeRestricted || isRootFilePositionWithinEmitRange() ) {
+		m_outputArena+= output;
 	}
 }
 
@@ -18,11 +18,15 @@ namespace sqtpp {
 
 class File;
 class FileStack;
+class FilePrefetcher;
 class Logger;
 class Options;
 class Output;
 class LocationStack;
 class Scanner;
+class SourceMap;
+class BatchManifest;
+class CheckpointCache;
 class Macro;
 class MacroSet;
 class MacroArguments;
@@ -31,6 +35,8 @@ class TokenExpression;
 class TokenExpressions;
 class ITokenStream;
 class TokenStreamStack;
+class ConditionalCache;
+class FileFinderCache;
 }
 
 namespace sqtpp {
@@ -81,6 +87,21 @@ private:
 	*/ 
 	StringSet&     m_includeOnceFiles;
 
+	/**
+	** @brief Include guard macros of the files processed (by full path).
+	**
+	** A file is not included again as long as its guard macro is defined.
+	*/ 
+	StringDictionary& m_includeGuards;
+
+	/**
+	** @brief Full paths of guarded files by include request.
+	**
+	** Used to skip an \#include without searching the file if the guard 
+	** macro of the file is still defined.
+	*/ 
+	StringDictionary& m_guardedIncludes;
+
 	/**
 	** @brief All currently defined macros.
 	*/
@@ -91,6 +112,18 @@ private:
 	*/
 	LocationStack&     m_conditionalStack;
 
+	/// Results of \#if and \#elif expressions already evaluated.
+	ConditionalCache&  m_conditionalCache;
+
+	/// Results of the include file searches.
+	FileFinderCache&   m_fileFinderCache;
+
+	/// Version number assigned to the last macro defined.
+	size_t             m_nMacroVersion;
+
+	/// If not NULL the identifiers scanned by getNextToken are collected in this set.
+	StringSet*         m_pReferencedIdentifiers;
+
 	/// The current token.
 	TokenExpression&   m_tokenExpression;
 
@@ -99,15 +132,63 @@ private:
 	*/
 	TokenStreamStack&  m_tokenStreamStack;
 
-	/// The previous line dumped out.
-	std::wstring       m_prevLine;
+	/// Number of characters of completed lines collected before they are written.
+	enum { OUTPUT_BLOCK_SIZE = 0x10000 };
 
-	/// A buffer for the current line.
-	std::wstringstream m_outputBuffer;
+	/// The output not yet written: The completed lines followed by the current line.
+	mutable std::wstring m_outputArena;
+
+	/// The position of the current line in #m_outputArena.
+	mutable size_t     m_nOutputLineStart;
+
+	/// A buffer for the #line directive (reused for each directive).
+	std::wstring       m_lineDirective;
+
+	/// Flag indicating if the output is restricted to a range of the root file.
+	bool               m_bOutputRangeRestricted;
 
 	/// The output stream.
 	Output*            m_pOutput;
 
+	/// Reads the include files of the files processed in advance.
+	FilePrefetcher*    m_pPrefetcher;
+
+	/// The origin of the output lines (NULL if \#line directives are emitted instead).
+	SourceMap*         m_pSourceMap;
+
+	/// The hash values of the batches written (NULL if no manifest is written).
+	BatchManifest*     m_pManifest;
+
+	/// Number of line breaks of the root file between two checkpoints.
+	enum { CHECKPOINT_INTERVAL = 500 };
+
+	/// The checkpoints of the root file (NULL if no checkpoints are recorded).
+	CheckpointCache*   m_pCheckpoints;
+
+	/// The number of line breaks of the root file read so far.
+	size_t             m_nRootLineCount;
+
+	/// The number of line breaks of the root file at which the next checkpoint is due.
+	size_t             m_nNextCheckpointLine;
+
+	/// The identifiers of the macros defined at the last checkpoint (but the buildin macros).
+	StringSet          m_checkpointMacros;
+
+	/// The last macro version number assigned before the last checkpoint.
+	size_t             m_nCheckpointMacroVersion;
+
+	/// The number of line feeds written to the output.
+	size_t             m_nOutputLineCount;
+
+	/// The number of batch frames written so far.
+	size_t             m_nFrameCount;
+
+	/// The file of the first line of the current batch frame.
+	std::wstring       m_sFrameFile;
+
+	/// The line of the first line of the current batch frame (0 if the batch is still empty).
+	size_t             m_nFrameLine;
+
 	/// Flag that is set if the output is defined externaly 
 	/// i.e. not the default output managed by processor itself.
 	bool               m_bExternalOutput;
@@ -142,6 +223,15 @@ private:
 	// the current time.
 	const tm*          m_pTestTimestamp;
 
+	/// The timestamp of this run (set when first requested).
+	mutable tm         m_timestamp;
+
+	/// Flag indicating if #m_timestamp has been set.
+	mutable bool       m_bTimestampValid;
+
+	/// Formatted timestamps (__DATE__, __TIME__, ...) by format string.
+	mutable StringDictionary m_formattedTimestamps;
+
 private:
 	// Copy c'tor (not implemented);
 	Processor( const Processor& that );
@@ -168,7 +258,10 @@ public:
 	void getTimestamp( tm& timestamp ) const;
 
 	// For testing only: override the default timestamp to make test deterministic.
-	void setTimestamp( const tm* pTimestamp ) { this->m_pTestTimestamp = pTimestamp; }
+	void setTimestamp( const tm* pTimestamp );
+
+	// Get the timestamp of this run formatted with the given wcsftime format.
+	const std::wstring& formatTimestamp( const std::wstring& sFormat ) const;
 
 	// Get the file which is currently processed.
 	const File& getCurrentFile() const;
@@ -214,13 +307,22 @@ private:
 	const wstring getNextIdentifier();
 
 	// Emit the current line string to the ouput stream.
-	void emitLineDirective( std::wostream& output );
+	void emitLineDirective( std::wstring& output );
+
+	// Get the new line chacter(s) to emit.
+	const wchar_t* getLineFeed( const wstring& sNewLine ) const;
 
 	// Emit the new line chacter(s).
 	void emitLineFeed( std::wostream& output, const wstring& sNewLine ) const;
 
-	// Emit the current output buffer.
-	size_t emitBuffer( std::wostream& ouput );
+	// Write the completed lines collected to the output stream.
+	void flushOutput() const;
+
+	// Check if the current output line is a batch separator.
+	bool isBatchSeparator() const;
+
+	// Write the output collected as a batch frame.
+	void writeFrame( size_t nLength );
 
 	// Check if the output range is restricted and if yes if the current tokens
 	// are within the input range.
@@ -238,15 +340,44 @@ private:
 	// Process the options defined at the command line (undef / define).
 	void applyOptions();
 
+	// Process a macro definition given as text.
+	void processDefinition( const std::wstring& sDefinition );
+
+	// Resume processing the root file at the last valid checkpoint preceding the output range.
+	void restoreCheckpoint( File& file );
+
+	// Record the state at the current line boundary of the root file.
+	void addCheckpoint();
+
+	// Write the checkpoints recorded.
+	void saveCheckpoints();
+
 	// Helper for \#if and \#endif.
 	bool evaluateConditionalDirective();
 
+	// Skip the tokens of a conditional expression whose result is cached
+	// or of a directive preceding the output range.
+	void skipConditionalDirective();
+
+	// Set the scanner into the context of a skipped conditional block.
+	void beginConditionalBlock( Context context );
+
+	// Check if the guard macro of a file is defined.
+	bool isIncludeGuardDefined( const std::wstring& sFullPath ) const;
+
 	// Process the current input stream.
 	void processInput();
+	void processInput( size_t conditionalStackSize );
 
 	// Process the token.
 	bool processToken( int scannerToken );
 
+	// Process a token outside of the output range.
+	void processTokenOutsideRange( int scannerToken );
+
+	// Leave the rest of the root file unread.
+	void finishOutputRange( size_t nConditionalStackSize );
+
 	// Scanner has found an identifier - expand macro if existent.
 	void processIdentifier();
 
@@ -257,6 +388,15 @@ private:
 	// Process a block comment.
 	void processBlockComment();
 
+	// Process blanks (or a comment removed from the output).
+	void processSpace();
+
+	// Remove the trailing blanks of the current output line.
+	void trimOutputLine();
+
+	// Check if a comment is an optimizer hint.
+	static bool isHint( const wstring& commentText ) throw();
+
 	// Process a expression e.g. for the \#if or \#elif directives.
 	void processExpression();
 
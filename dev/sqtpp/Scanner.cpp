@@ -24,6 +24,26 @@ const wchar_t* const Scanner::m_szBlockCommentEnd   = L"*/";
 
 const wstring Scanner::m_emptyString;
 
+/// The classes of the 7 bit (ASCII) characters (the classification of the classic locale).
+const unsigned char Scanner::m_asciiCharClass[128] = {
+	0,            0,            0,            0,            0,            0,            0,            0,
+	0,            CC_SPACE,     CC_SPACE,     CC_SPACE,     CC_SPACE,     CC_SPACE,     0,            0,
+	0,            0,            0,            0,            0,            0,            0,            0,
+	0,            0,            0,            0,            0,            0,            0,            0,
+	CC_SPACE,     0,            0,            0,            0,            0,            0,            0,
+	0,            0,            0,            0,            0,            0,            0,            0,
+	CC_DECIMAL,   CC_DECIMAL,   CC_DECIMAL,   CC_DECIMAL,   CC_DECIMAL,   CC_DECIMAL,   CC_DECIMAL,   CC_DECIMAL,
+	CC_DECIMAL,   CC_DECIMAL,   0,            0,            0,            0,            0,            0,
+	0,            CC_HEXALPHA,  CC_HEXALPHA,  CC_HEXALPHA,  CC_HEXALPHA,  CC_HEXALPHA,  CC_HEXALPHA,  CC_ALPHA,
+	CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,
+	CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,
+	CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     0,            0,            0,            0,            0,
+	0,            CC_HEXALPHA,  CC_HEXALPHA,  CC_HEXALPHA,  CC_HEXALPHA,  CC_HEXALPHA,  CC_HEXALPHA,  CC_ALPHA,
+	CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,
+	CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     CC_ALPHA,
+	CC_ALPHA,     CC_ALPHA,     CC_ALPHA,     0,            0,            0,            0,            0
+};
+
 
 /**
 ** @brief Scanner constructor.
@@ -34,6 +54,7 @@ Scanner::Scanner( const sqtpp::Options& options )
 , m_wcFirstNonSpaceChar( L'\0' )
 , m_wcLastNonSpaceChar( L'\0' )
 , m_lastToken( *new TokenExpression() )
+, m_nSkipLineCount( 0 )
 {
 }
 
@@ -203,9 +224,9 @@ void Scanner::readNumber( std::wistream& input, wchar_t wcCurrent )
 		wchar_t ch = input.peek();
 		bool    isDigit;
 		if ( isHex ) {
-			isDigit = std::isxdigit( ch, this->getLocale() );
+			isDigit = this->isHexDigit( ch );
 		} else {
-			isDigit = std::isdigit( ch, this->getLocale() );
+			isDigit = this->isDigit( ch );
 		}
 		if ( isDigit ) {
 			input.get();
@@ -734,7 +755,7 @@ Token Scanner::continueDefault( std::wistream& input )
 
 			const wstring identifier = m_tokenBuffer.str();
 			token = translateIdentifier( identifier );
-		} else if ( std::isdigit( wcNext, locale::classic() ) ) {
+		} else if ( isDigit( wcNext ) ) {
 			m_tokenBuffer.put( wcNext );
 			token = TOK_NUMBER;
 			readNumber( input, wcNext );
@@ -1032,6 +1053,30 @@ Token Scanner::continueConditional( std::wistream& input )
 	return token;
 }
 
+/**
+** @brief Skip a line of a conditional block.
+**
+** Used instead of #continueConditional if the processor knows the number
+** of lines of the block because it has been skipped before. The characters
+** are just read up to the end of the line.
+*/
+Token Scanner::skipConditionalLine( std::wistream& input )
+{
+	wchar_t wc;
+
+	while ( input.good() ) {
+		input.get( wc );
+		if ( input.eof() ) {
+			return TOK_END_OF_FILE;
+		}
+		if ( isNewLine( wc ) ) {
+			readNewLine( input, wc );
+			return TOK_NEW_LINE;
+		}
+	}
+	return TOK_END_OF_FILE;
+}
+
 /**
 ** @brief Public interface methode to get the next token.
 **
@@ -1161,7 +1206,12 @@ Token Scanner::getNextTokenCore( std::wistream& input, size_t& nCharCountRead )
 			break;
 		case CTX_CONDITIONAL_FALSE:
 		case CTX_CONDITIONAL_DONE:
-			token = continueConditional( input );
+			if ( m_nSkipLineCount > 0 ) {
+				--m_nSkipLineCount;
+				token = skipConditionalLine( input );
+			} else {
+				token = continueConditional( input );
+			}
 			break;
 		case CTX_SQUOTE_STRING:
 			token = continueString( input, L'\'' );
@@ -1189,6 +1239,9 @@ Token Scanner::getNextTokenCore( std::wistream& input, size_t& nCharCountRead )
 */
 bool Scanner::isSpace( wchar_t ch ) const
 {
+	if ( unsigned( ch ) < 0x80 ) {
+		return (m_asciiCharClass[ch] & CC_SPACE) != 0 && !isNewLine( ch );
+	}
 	return std::isspace( ch, this->getLocale() ) && !isNewLine( ch );
 }
 
@@ -1205,7 +1258,11 @@ bool Scanner::isNewLine( wchar_t ch ) const
 */
 bool Scanner::isIdentifierBegin( wchar_t ch ) const
 {
-	if ( std::isalpha( ch, this->getLocale() ) ) {
+	if ( unsigned( ch ) < 0x80 ) {
+		if ( (m_asciiCharClass[ch] & CC_ALPHA) != 0 ) {
+			return true;
+		}
+	} else if ( std::isalpha( ch, this->getLocale() ) ) {
 		return true;
 	} 
 	switch ( ch ) {
@@ -1227,7 +1284,29 @@ bool Scanner::isIdentifierBegin( wchar_t ch ) const
 */
 bool Scanner::isIdentifierContinued( wchar_t ch ) const
 {
-	return isIdentifierBegin( ch ) || std::isdigit( ch, this->getLocale() );
+	return isIdentifierBegin( ch ) || isDigit( ch );
+}
+
+/**
+** @brief Check if the given character is a decimal digit.
+*/
+bool Scanner::isDigit( wchar_t ch ) const
+{
+	if ( unsigned( ch ) < 0x80 ) {
+		return (m_asciiCharClass[ch] & CC_DIGIT) != 0;
+	}
+	return std::isdigit( ch, this->getLocale() );
+}
+
+/**
+** @brief Check if the given character is a hexadecimal digit.
+*/
+bool Scanner::isHexDigit( wchar_t ch ) const
+{
+	if ( unsigned( ch ) < 0x80 ) {
+		return (m_asciiCharClass[ch] & CC_XDIGIT) != 0;
+	}
+	return std::isxdigit( ch, this->getLocale() );
 }
 
 
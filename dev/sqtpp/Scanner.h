@@ -41,6 +41,21 @@ private:
 	/// An empty string
 	static const wstring m_emptyString;
 
+	/// Classes of the 7 bit (ASCII) characters.
+	enum CharClass {
+		CC_SPACE  = 0x01,
+		CC_ALPHA  = 0x02,
+		CC_DIGIT  = 0x04,
+		CC_XDIGIT = 0x08,
+		// Decimal digits (0-9).
+		CC_DECIMAL = CC_DIGIT | CC_XDIGIT,
+		// Letters which are hexadecimal digits (a-f, A-F).
+		CC_HEXALPHA = CC_ALPHA | CC_XDIGIT
+	};
+
+	/// The classes of the 7 bit (ASCII) characters.
+	static const unsigned char m_asciiCharClass[128];
+
 	/// The current scanner context.
 	Context                    m_context;
 
@@ -68,6 +83,9 @@ private:
 	/// The identifier assoziated with the current token e.g. for #define its "define"
 	std::wstring               m_tokenIdentifier;
 
+	/// Number of lines of a conditional block that can be skipped without looking for directives.
+	size_t                     m_nSkipLineCount;
+
 protected:
 
 	/// The read buffer.
@@ -97,12 +115,18 @@ public:
 	// Get the current scanner context.
 	Context getContext() const throw() { return m_context; }
 
+	// Get the number of contexts to be restored by popContext.
+	size_t getContextDepth() const throw() { return m_contextStack.size(); }
+
 	// Change current context.
 	void pushContext( Context newContext );
 
 	// Restore previous context.
 	void popContext( Context context );
 
+	// Skip the next lines of the current conditional block.
+	void skipConditionalLines( size_t nLineCount ) throw() { m_nSkipLineCount = nLineCount; }
+
 	// Get the last token scanned.
 	Token getLastToken() const throw();
 
@@ -151,6 +175,8 @@ protected:
 	Token continueBlockComment( std::wistream& input, const wchar_t* pszCommentEnd, bool bFollowup );
 	// Continue conditional block.
 	Token continueConditional( std::wistream& input );
+	// Skip a line of a conditional block.
+	Token skipConditionalLine( std::wistream& input );
 	// Continue reading a (multiline) string.
 	Token continueString( std::wistream& input, wchar_t delimiter );
 
@@ -176,6 +202,8 @@ private:
 	const std::locale& getLocale() const;
 	bool isIdentifierBegin( wchar_t ch ) const;
 	bool isIdentifierContinued( wchar_t ch ) const;
+	bool isDigit( wchar_t ch ) const;
+	bool isHexDigit( wchar_t ch ) const;
 
 	bool    readIfEqual( std::wistream& input, wchar_t next );
 	wchar_t readIfOneOf( std::wistream& input, const wchar_t* next );
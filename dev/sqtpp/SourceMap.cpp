@@ -0,0 +1,123 @@
+#include "stdafx.h"
+#include "Util.h"
+#include "SourceMap.h"
+
+namespace sqtpp {
+
+/**
+** @brief Constructor.
+*/
+SourceMap::SourceMap()
+: m_nLastLine( 0 )
+{
+}
+
+/**
+** @brief Get the id of a file.
+**
+** The file is added to the file table if it is mapped for the first time.
+*/
+size_t SourceMap::getFileId( const std::wstring& sFilePath )
+{
+	FileIdMap::const_iterator it = m_fileIds.find( sFilePath );
+	if ( it != m_fileIds.end() ) {
+		return it->second;
+	}
+
+	const size_t nFileId = m_files.size();
+	m_files.push_back( sFilePath );
+	m_fileIds[sFilePath] = nFileId;
+	return nFileId;
+}
+
+/**
+** @brief Add an output line.
+**
+** A new range is started only if the line does not continue the last range
+** i.e. if it originates from another file or if lines have been skipped.
+**
+** @param nOutputLine The output line (one based). The lines have to be added
+** in ascending order. Lines which are not added continue the range before.
+** @param sFilePath The file the line originates from.
+** @param nSourceLine The line in the file.
+*/
+void SourceMap::addLine( size_t nOutputLine, const std::wstring& sFilePath, size_t nSourceLine )
+{
+	m_nLastLine = nOutputLine;
+
+	if ( !m_entries.empty() ) {
+		const Entry& last = m_entries.back();
+		assert( nOutputLine >= last.nOutputLine );
+		if ( last.nSourceLine + ( nOutputLine - last.nOutputLine ) == nSourceLine && m_files[last.nFileId] == sFilePath ) {
+			return;
+		}
+		if ( last.nOutputLine == nOutputLine ) {
+			// The line is already mapped.
+			return;
+		}
+	}
+
+	Entry entry;
+	entry.nOutputLine = nOutputLine;
+	entry.nFileId     = getFileId( sFilePath );
+	entry.nSourceLine = nSourceLine;
+	m_entries.push_back( entry );
+}
+
+/**
+** @brief Find the source of an output line.
+**
+** @returns false if the line precedes the first range.
+*/
+bool SourceMap::find( size_t nOutputLine, std::wstring& sFilePath, size_t& nSourceLine ) const
+{
+	// Find the last range starting at or before the line.
+	size_t nLower = 0;
+	size_t nUpper = m_entries.size();
+	while ( nLower < nUpper ) {
+		const size_t nMiddle = ( nLower + nUpper ) / 2;
+		if ( m_entries[nMiddle].nOutputLine <= nOutputLine ) {
+			nLower = nMiddle + 1;
+		} else {
+			nUpper = nMiddle;
+		}
+	}
+	if ( nLower == 0 ) {
+		return false;
+	}
+
+	const Entry& entry = m_entries[nLower - 1];
+	sFilePath   = m_files[entry.nFileId];
+	nSourceLine = entry.nSourceLine + ( nOutputLine - entry.nOutputLine );
+	return true;
+}
+
+/**
+** @brief Write the map.
+*/
+void SourceMap::write( std::wostream& output ) const
+{
+	output << L"sqtpp source map 1" << L'\n';
+
+	for ( size_t nFileId = 0; nFileId < m_files.size(); ++nFileId ) {
+		output << L"F\t";
+		Util::writeNumber( output, nFileId );
+		output << L'\t' << m_files[nFileId] << L'\n';
+	}
+
+	for ( size_t nEntry = 0; nEntry < m_entries.size(); ++nEntry ) {
+		const Entry& entry = m_entries[nEntry];
+		const size_t nLastLine = nEntry + 1 < m_entries.size() ? m_entries[nEntry + 1].nOutputLine - 1 : m_nLastLine;
+		output << L"R\t";
+		Util::writeNumber( output, entry.nOutputLine );
+		output << L'\t';
+		Util::writeNumber( output, nLastLine );
+		output << L'\t';
+		Util::writeNumber( output, entry.nFileId );
+		output << L'\t';
+		Util::writeNumber( output, entry.nSourceLine );
+		output << L'\n';
+	}
+}
+
+} // namespace sqtpp
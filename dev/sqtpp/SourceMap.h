@@ -0,0 +1,88 @@
+/**
+** @file
+** @author Ralf Seidel
+** @brief Declaration of the #sqtpp::SourceMap.
+**
+**  2010 by SQL Service GmbH Wuppertal
+*/
+#ifndef SQTPP_SOURCE_MAP_H
+#define SQTPP_SOURCE_MAP_H
+#if _MSC_VER > 10
+#pragma once
+#endif
+
+namespace sqtpp {
+
+/**
+** @brief Maps the lines of the output to the lines of the input files.
+**
+** The map is the out of band alternative to the \#line directives in
+** the output. It consists of a table of the files and of ranges of
+** output lines which originate from consecutive lines of one file:
+**
+** @code
+** sqtpp source map 1
+** F <tab> file id <tab> file path
+** R <tab> first output line <tab> last output line <tab> file id <tab> first source line
+** @endcode
+**
+** A new range is started only if an output line does not continue the
+** previous range. So the map is usually much smaller than the \#line
+** directives and it can be read without scanning the output.
+*/
+class SourceMap
+{
+private:
+	/// The start of a range of output lines.
+	struct Entry
+	{
+		/// The first output line of the range (one based).
+		size_t nOutputLine;
+		/// The index of the source file in #m_files.
+		size_t nFileId;
+		/// The source line of the first output line.
+		size_t nSourceLine;
+	};
+
+	/// Array of the ranges ordered by the output line.
+	typedef std::vector<Entry>             EntryArray;
+
+	/// Index of the files by path.
+	typedef std::map<std::wstring, size_t> FileIdMap;
+
+	/// The paths of the files mapped.
+	StringArray  m_files;
+
+	/// The index of the files by path.
+	FileIdMap    m_fileIds;
+
+	/// The ranges.
+	EntryArray   m_entries;
+
+	/// The last output line added (the end of the last range).
+	size_t       m_nLastLine;
+
+private:
+	// Get the id of a file (adding it to the file table if necessary).
+	size_t getFileId( const std::wstring& sFilePath );
+
+public:
+	// Constructor.
+	SourceMap();
+
+	// Add an output line.
+	void addLine( size_t nOutputLine, const std::wstring& sFilePath, size_t nSourceLine );
+
+	// Find the source of an output line.
+	bool find( size_t nOutputLine, std::wstring& sFilePath, size_t& nSourceLine ) const;
+
+	/// Get the number of ranges.
+	size_t getRangeCount() const throw() { return m_entries.size(); }
+
+	// Write the map.
+	void write( std::wostream& output ) const;
+};
+
+} // namespace sqtpp
+
+#endif // SQTPP_SOURCE_MAP_H
@@ -1,9 +1,19 @@
 #include "StdAfx.h"
+#include <sys/types.h>
+#include <sys/stat.h>
 #ifdef _WIN32
+#include <io.h>
+#include <process.h>
 #include <Windows.h>
+#else
+#include <unistd.h>
+#define _getpid getpid
 #endif
 #include "Exceptions.h"
 #include "Util.h"
+#include "CodePage.h"
+#include "CodePageConverter.h"
+#include "CodePageDetection.h"
 #include "Streams.h"
 
 namespace sqtpp 
@@ -299,6 +309,844 @@ UtfFileBuffer::pos_type UtfFileBuffer::seekoff( off_type offset, ios_base::seekd
 	return position;
 }
 
+// --------------------------------------------------------------------
+// FileContentBuffer
+// --------------------------------------------------------------------
+
+/**
+** @brief Default constructor.
+*/
+FileContentBuffer::FileContentBuffer()
+: base()
+, m_hMapping( NULL )
+, m_pView( NULL )
+, m_pNextByte( NULL )
+, m_pEndByte( NULL )
+, m_pConverter( NULL )
+, m_state( mbstate_t() )
+{
+}
+
+/**
+** @brief Destructor.
+*/
+FileContentBuffer::~FileContentBuffer()
+{
+	close();
+}
+
+/**
+** @brief Open the file, detect its code page and prepare the conversion.
+**
+** @param pszFileName The path of the file.
+** @param defaultCodePageId The code page assumed if the file has no byte order mark.
+** @returns The code page of the file or NULL if the file cannot be read.
+*/
+const CodePageInfo* FileContentBuffer::open( const wchar_t* pszFileName, CodePageId defaultCodePageId )
+{
+	close();
+
+	if ( !load( pszFileName ) ) {
+		return NULL;
+	}
+
+	const size_t        nByteCount = m_pEndByte - m_pNextByte;
+	const CodePageInfo* pCodePage  = CodePageDetection::detectCodePage( m_pNextByte, nByteCount, defaultCodePageId );
+	const char*         pFileBom   = pCodePage->getFileBom();
+	size_t              nBomLength = pFileBom == NULL ? 0 : strlen( pFileBom );
+	if ( nBomLength > nByteCount ) {
+		nBomLength = nByteCount;
+	}
+	// UTF-8 files may have no byte order mark.
+	if ( nBomLength > 0 && memcmp( m_pNextByte, pFileBom, nBomLength ) == 0 ) {
+		m_pNextByte += nBomLength;
+	}
+
+	m_pConverter = &use_facet<Converter>( pCodePage->getLocale() );
+	m_state      = mbstate_t();
+	m_content.resize( BLOCK_SIZE );
+
+	return pCodePage;
+}
+
+/**
+** @brief Load the file content into memory.
+**
+** Regular files are mapped into memory. Other files (e.g. named pipes)
+** or files which cannot be mapped (e.g. empty files) are read completely.
+*/
+bool FileContentBuffer::load( const wchar_t* pszFileName )
+{
+#ifdef _WIN32
+	HANDLE hFile = ::CreateFileW( pszFileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL );
+	if ( hFile == INVALID_HANDLE_VALUE ) {
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	if ( ::GetFileType( hFile ) == FILE_TYPE_DISK 
+	  && ::GetFileSizeEx( hFile, &fileSize ) 
+	  && fileSize.QuadPart > 0 
+	  && (ULONGLONG)fileSize.QuadPart <= (SIZE_T)-1 ) {
+		HANDLE hMapping = ::CreateFileMappingW( hFile, NULL, PAGE_READONLY, 0, 0, NULL );
+		if ( hMapping != NULL ) {
+			const void* pView = ::MapViewOfFile( hMapping, FILE_MAP_READ, 0, 0, 0 );
+			if ( pView != NULL ) {
+				m_hMapping  = hMapping;
+				m_pView     = pView;
+				m_pNextByte = static_cast<const char*>( pView );
+				m_pEndByte  = m_pNextByte + (size_t)fileSize.QuadPart;
+			} else {
+				::CloseHandle( hMapping );
+			}
+		}
+	}
+
+	if ( m_pView == NULL ) {
+		// Fall back to reading the file.
+		char  buffer[0x10000];
+		DWORD dwBytesRead = 0;
+		while ( ::ReadFile( hFile, buffer, sizeof( buffer ), &dwBytesRead, NULL ) && dwBytesRead > 0 ) {
+			m_bytes.insert( m_bytes.end(), buffer, buffer + dwBytesRead );
+		}
+	}
+	// The file mapping keeps a reference to the file.
+	::CloseHandle( hFile );
+#else
+	std::ifstream ifs;
+	std::string   sFileName = Convert::wcs2str( pszFileName );
+
+	ifs.open( sFileName.c_str(), ios::in | ios::binary );
+	if ( !ifs.is_open() ) {
+		return false;
+	}
+
+	char buffer[0x10000];
+	while ( ifs.read( buffer, sizeof( buffer ) ), ifs.gcount() > 0 ) {
+		m_bytes.insert( m_bytes.end(), buffer, buffer + ifs.gcount() );
+	}
+	ifs.close();
+#endif
+
+	if ( m_pView == NULL ) {
+		m_bytes.push_back( '\0' );
+		m_pNextByte = &m_bytes[0];
+		m_pEndByte  = m_pNextByte + m_bytes.size() - 1;
+	}
+	return true;
+}
+
+/**
+** @brief Use the content of a file read and decoded in advance.
+**
+** @param content The decoded characters. The content is swapped into
+**        the buffer and the string passed is emptied.
+*/
+void FileContentBuffer::attach( std::wstring& content )
+{
+	close();
+
+	m_content.swap( content );
+	content.clear();
+	if ( m_content.empty() ) {
+		setg( NULL, NULL, NULL );
+	} else {
+		wchar_t* pBegin = &m_content[0];
+		setg( pBegin, pBegin, pBegin + m_content.size() );
+	}
+}
+
+/**
+** @brief Convert the remaining content of the file at once.
+**
+** Used to decode a file in advance (see #FilePrefetcher).
+**
+** @param content Receives the characters converted.
+*/
+void FileContentBuffer::decodeAll( std::wstring& content )
+{
+	content.clear();
+	content.reserve( m_pEndByte - m_pNextByte );
+	for ( size_t nCharCount = decode(); nCharCount > 0; nCharCount = decode() ) {
+		content.append( m_content, 0, nCharCount );
+	}
+}
+
+/**
+** @brief Release the file content.
+*/
+void FileContentBuffer::close() throw()
+{
+#ifdef _WIN32
+	if ( m_pView != NULL ) {
+		::UnmapViewOfFile( m_pView );
+		::CloseHandle( m_hMapping );
+	}
+#endif
+	m_pView     = NULL;
+	m_hMapping  = NULL;
+	m_pNextByte = NULL;
+	m_pEndByte  = NULL;
+	m_bytes.clear();
+	setg( NULL, NULL, NULL );
+}
+
+/**
+** @brief Convert the next block of characters.
+**
+** @returns The next character or eof if the content has been read completly.
+*/
+FileContentBuffer::int_type FileContentBuffer::underflow()
+{
+	if ( gptr() < egptr() ) {
+		return traits_type::to_int_type( *gptr() );
+	}
+
+	const size_t nCharCount = decode();
+	if ( nCharCount == 0 ) {
+		return traits_type::eof();
+	}
+
+	wchar_t* pBegin = &m_content[0];
+	setg( pBegin, pBegin, pBegin + nCharCount );
+	return traits_type::to_int_type( *pBegin );
+}
+
+/**
+** @brief Convert the next block of characters.
+**
+** The conversion stops at an incomplete character at the end of the file.
+** Bytes which are not valid in the code page of the file are replaced
+** by the unicode replacement character (U+FFFD) one by one.
+** Like a file buffer the bytes are just copied if the converter does not
+** convert at all (UTF-16).
+**
+** @returns The number of characters converted into m_content.
+*/
+size_t FileContentBuffer::decode()
+{
+	if ( m_pNextByte >= m_pEndByte ) {
+		return 0;
+	}
+
+	wchar_t* pTo    = &m_content[0];
+	wchar_t* pToMax = pTo + m_content.size();
+
+	if ( m_pConverter->always_noconv() ) {
+		size_t nCharCount = (m_pEndByte - m_pNextByte) / sizeof( wchar_t );
+		if ( nCharCount > m_content.size() ) {
+			nCharCount = m_content.size();
+		}
+		if ( nCharCount == 0 ) {
+			// Substitute the odd byte at the end of the file.
+			*pTo        = wchar_t( REPLACEMENT_CHARACTER );
+			m_pNextByte = m_pEndByte;
+			return 1;
+		}
+		memcpy( pTo, m_pNextByte, nCharCount * sizeof( wchar_t ) );
+		m_pNextByte+= nCharCount * sizeof( wchar_t );
+		return nCharCount;
+	}
+
+	const char* pFromNext = m_pNextByte;
+	wchar_t*    pToNext   = pTo;
+	codecvt_base::result result = m_pConverter->in( m_state, m_pNextByte, m_pEndByte, pFromNext, pTo, pToMax, pToNext );
+
+	if ( result == codecvt_base::error && pToNext == pTo ) {
+		// The characters preceding the invalid sequence are converted first.
+		const size_t nValidLength = findValidLength();
+		if ( nValidLength > 0 ) {
+			m_pConverter->in( m_state, m_pNextByte, m_pNextByte + nValidLength, pFromNext, pTo, pToMax, pToNext );
+		}
+	}
+	if ( result == codecvt_base::error && pToNext == pTo ) {
+		// Substitute the invalid byte and continue with the next one.
+		*pToNext++ = wchar_t( REPLACEMENT_CHARACTER );
+		pFromNext  = m_pNextByte + 1;
+		m_state    = mbstate_t();
+	} else if ( pToNext == pTo && pFromNext == m_pNextByte ) {
+		// Substitute the incomplete sequence at the end of the file.
+		*pToNext++ = wchar_t( REPLACEMENT_CHARACTER );
+		pFromNext  = m_pEndByte;
+	}
+	m_pNextByte = pFromNext;
+
+	return pToNext - pTo;
+}
+
+/**
+** @brief Find the longest prefix of the remaining bytes the converter accepts.
+**
+** A converter may reject its whole input if it contains an invalid 
+** sequence (e.g. if MultiByteToWideChar fails). The length probed is 
+** doubled until the converter fails and then bisected. So the cost 
+** depends on the distance of the invalid sequence only.
+**
+** @returns The number of bytes preceding the first invalid sequence.
+*/
+size_t FileContentBuffer::findValidLength()
+{
+	wchar_t* pTo    = &m_content[0];
+	wchar_t* pToMax = pTo + m_content.size();
+	size_t   nValidLength   = 0;
+	size_t   nInvalidLength = m_pEndByte - m_pNextByte;
+
+	for ( size_t nLength = 1; nValidLength + 1 < nInvalidLength; ) {
+		mbstate_t   state     = m_state;
+		const char* pFromNext = m_pNextByte;
+		wchar_t*    pToNext   = pTo;
+		if ( m_pConverter->in( state, m_pNextByte, m_pNextByte + nLength, pFromNext, pTo, pToMax, pToNext ) == codecvt_base::error ) {
+			nInvalidLength = nLength;
+		} else {
+			nValidLength = nLength;
+		}
+		nLength = nInvalidLength == size_t( m_pEndByte - m_pNextByte ) && nLength * 2 < nInvalidLength
+		        ? nLength * 2
+		        : ( nValidLength + nInvalidLength ) / 2;
+	}
+	return nValidLength;
+}
+
+// --------------------------------------------------------------------
+// FileContentStream
+// --------------------------------------------------------------------
+
+/**
+** @brief Constructor.
+*/
+FileContentStream::FileContentStream()
+: base( &m_buffer )
+{
+}
+
+/**
+** @brief Read the file, detect its code page and decode the content.
+*/
+const CodePageInfo* FileContentStream::open( const std::wstring& fileName, CodePageId defaultCodePageId )
+{
+	const CodePageInfo* pCodePage = m_buffer.open( fileName.c_str(), defaultCodePageId );
+	if ( pCodePage == NULL ) {
+		setstate( ios_base::failbit );
+	}
+	return pCodePage;
+}
+
+/**
+** @brief Use the content of a file read and decoded in advance.
+*/
+void FileContentStream::attach( std::wstring& content )
+{
+	m_buffer.attach( content );
+}
+
+// --------------------------------------------------------------------
+// FileOutputBuffer
+// --------------------------------------------------------------------
+
+#ifdef _WIN32
+
+/**
+** @brief The state of the overlapped writes into a named pipe.
+**
+** The two buffers are used alternately: While the bytes of one
+** buffer are read from the pipe the next bytes are encoded into
+** the other one.
+*/
+struct FileOutputBuffer::PipeData
+{
+	// The pipe handle.
+	HANDLE     hPipe;
+
+	// The overlapped structure of the write in progress.
+	OVERLAPPED overlapped;
+
+	// The page aligned byte buffers.
+	char*      buffers[2];
+
+	// The index of the buffer the bytes are encoded into.
+	size_t     nCurrent;
+
+	// The number of bytes of the write in progress (0 if none).
+	DWORD      dwPending;
+};
+
+#endif
+
+/**
+** @brief Constructor.
+*/
+FileOutputBuffer::FileOutputBuffer()
+: base()
+, m_pFile( NULL )
+, m_pPipe( NULL )
+, m_pConverter( NULL )
+, m_nMaxLength( 0 )
+, m_state()
+, m_pBytes( NULL )
+, m_nByteCount( 0 )
+, m_nFileSize( 0 )
+, m_bUnchanged( false )
+{
+	setp( m_chars, m_chars + CHAR_BUFFER_SIZE );
+}
+
+/**
+** @brief Destructor.
+*/
+FileOutputBuffer::~FileOutputBuffer()
+{
+	close();
+}
+
+/**
+** @brief Create the file and write the byte order mark of the code page.
+**
+** @param pszFileName The path of the output file.
+** @param codePage The code page of the output file.
+** @returns <code>true</code> if the file has been created.
+*/
+bool FileOutputBuffer::open( const wchar_t* pszFileName, const CodePageInfo& codePage )
+{
+	close();
+
+	m_bUnchanged = false;
+	if ( !openPipe( pszFileName ) && !openFile( pszFileName ) ) {
+		return false;
+	}
+
+	m_pConverter = &use_facet<Converter>( codePage.getLocale() );
+	m_nMaxLength = m_pConverter->always_noconv() ? sizeof( wchar_t ) : size_t( m_pConverter->max_length() );
+	m_state      = mbstate_t();
+	m_nByteCount = 0;
+
+	const char* pszBom = codePage.getFileBom();
+	if ( pszBom != NULL ) {
+		m_nByteCount = strlen( pszBom );
+		memcpy( m_pBytes, pszBom, m_nByteCount );
+	}
+	setp( m_chars, m_chars + CHAR_BUFFER_SIZE );
+	return true;
+}
+
+/**
+** @brief Write the remaining characters and close the file.
+**
+** @returns <code>false</code> if the remaining characters could not be written.
+*/
+bool FileOutputBuffer::close()
+{
+	if ( !is_open() ) {
+		return true;
+	}
+	const bool bSuccess = sync() == 0;
+	bool bClosed;
+	if ( m_pPipe != NULL ) {
+		bClosed = waitPipe();
+		closePipe();
+	} else {
+		bClosed = fclose( m_pFile ) == 0;
+		m_pFile = NULL;
+		if ( !m_sTempPath.empty() ) {
+			if ( bSuccess && bClosed ) {
+				bClosed = commitFile();
+			} else {
+				_wremove( m_sTempPath.c_str() );
+			}
+			m_sTempPath.clear();
+		}
+	}
+	m_pBytes     = NULL;
+	m_nByteCount = 0;
+	setp( m_chars, m_chars + CHAR_BUFFER_SIZE );
+	return bSuccess && bClosed;
+}
+
+/**
+** @brief Write the characters buffered to the file.
+**
+** @returns 0 on success or -1 if the characters could not be encoded or written.
+*/
+int FileOutputBuffer::sync()
+{
+	if ( !encodeChars() || !writeBytes() ) {
+		return -1;
+	}
+	return 0;
+}
+
+/**
+** @brief Put a character into the stream if the put area is full.
+*/
+FileOutputBuffer::int_type FileOutputBuffer::overflow( int_type character )
+{
+	if ( !encodeChars() ) {
+		return traits_type::eof();
+	}
+	if ( character != traits_type::eof() ) {
+		*pptr() = traits_type::to_char_type( character );
+		pbump( 1 );
+	}
+	return traits_type::not_eof( character );
+}
+
+/**
+** @brief Put a string into the stream.
+**
+** Short strings are copied into the put area. Larger blocks
+** (e.g. the lines collected by the processor) are encoded directly.
+**
+** @returns The number of characters written.
+*/
+std::streamsize FileOutputBuffer::xsputn( const wchar_t* buffer, std::streamsize count )
+{
+	if ( count <= epptr() - pptr() ) {
+		traits_type::copy( pptr(), buffer, size_t( count ) );
+		pbump( int( count ) );
+		return count;
+	}
+	if ( !encodeChars() || !encode( buffer, buffer + count ) ) {
+		return 0;
+	}
+	return count;
+}
+
+/**
+** @brief Encode the characters of the put area.
+*/
+bool FileOutputBuffer::encodeChars()
+{
+	if ( !is_open() ) {
+		return false;
+	}
+	const bool bSuccess = pptr() == pbase() || encode( pbase(), pptr() );
+	setp( m_chars, m_chars + CHAR_BUFFER_SIZE );
+	return bSuccess;
+}
+
+/**
+** @brief Encode a block of characters into the byte buffer.
+**
+** The byte buffer is written to the file whenever the space left
+** might not be sufficient for the next characters. Like a file
+** buffer the characters are just copied if the converter does not
+** convert at all (UTF-16).
+*/
+bool FileOutputBuffer::encode( const wchar_t* pFrom, const wchar_t* pFromMax )
+{
+	if ( !is_open() ) {
+		return false;
+	}
+	while ( pFrom < pFromMax ) {
+		size_t nCharCount = (BYTE_BUFFER_SIZE - m_nByteCount) / m_nMaxLength;
+		if ( nCharCount == 0 ) {
+			if ( !writeBytes() ) {
+				return false;
+			}
+			continue;
+		}
+		if ( nCharCount >= size_t( pFromMax - pFrom ) ) {
+			nCharCount = pFromMax - pFrom;
+		} else if ( nCharCount > 1 && unsigned( pFrom[nCharCount - 1] - 0xD800 ) < 0x400 ) {
+			// Don't split a surrogate pair.
+			--nCharCount;
+		}
+
+		char* pTo    = m_pBytes + m_nByteCount;
+		char* pToMax = m_pBytes + BYTE_BUFFER_SIZE;
+		if ( m_pConverter->always_noconv() ) {
+			memcpy( pTo, pFrom, nCharCount * sizeof( wchar_t ) );
+			m_nByteCount+= nCharCount * sizeof( wchar_t );
+			pFrom+= nCharCount;
+			continue;
+		}
+
+		const wchar_t* pFromNext = pFrom;
+		char*          pToNext   = pTo;
+		codecvt_base::result result = m_pConverter->out( m_state, pFrom, pFrom + nCharCount, pFromNext, pTo, pToMax, pToNext );
+		if ( result == codecvt_base::error || pFromNext == pFrom ) {
+			return false;
+		}
+		m_nByteCount+= pToNext - pTo;
+		pFrom = pFromNext;
+	}
+	return true;
+}
+
+/**
+** @brief Write the bytes encoded to the file.
+*/
+bool FileOutputBuffer::writeBytes()
+{
+	if ( m_nByteCount == 0 ) {
+		return true;
+	}
+	bool bSuccess;
+	if ( m_pPipe != NULL ) {
+		bSuccess = writePipe();
+	} else {
+		bSuccess = fwrite( m_pBytes, 1, m_nByteCount, m_pFile ) == m_nByteCount;
+		m_nFileSize+= m_nByteCount;
+	}
+	m_nByteCount = 0;
+	return bSuccess;
+}
+
+/**
+** @brief Create the output file.
+**
+** If the output file is a regular file (or doesn't exist yet) a temporary
+** file beside it is created instead. Other files (e.g. nul) are written 
+** directly.
+**
+** @param pszFileName The path of the output file.
+** @returns <code>true</code> if the file has been created or <code>false</code>
+**          if it cannot be created or an existing file cannot be written.
+*/
+bool FileOutputBuffer::openFile( const wchar_t* pszFileName )
+{
+	m_sFilePath = pszFileName;
+	m_sTempPath.clear();
+	m_nFileSize = 0;
+
+	struct _stat64 fileInfo;
+	const bool bExists = _wstat64( pszFileName, &fileInfo ) == 0;
+	if ( bExists && (fileInfo.st_mode & _S_IFREG) != 0 && _waccess( pszFileName, 2 ) != 0 ) {
+		// E.g. a read only file: It must not be replaced by the temporary file.
+		return false;
+	}
+	if ( !bExists || (fileInfo.st_mode & _S_IFREG) != 0 ) {
+		std::wostringstream tempPath;
+		tempPath << m_sFilePath << L'.' << _getpid() << L".tmp";
+		m_sTempPath = tempPath.str();
+		m_pFile = _wfopen( m_sTempPath.c_str(), L"wbS" );
+		if ( m_pFile == NULL ) {
+			// E.g. no permission to create files in the directory.
+			m_sTempPath.clear();
+		}
+	}
+	if ( m_pFile == NULL ) {
+		m_pFile = _wfopen( pszFileName, L"wbS" );
+		if ( m_pFile == NULL ) {
+			return false;
+		}
+	}
+	// The bytes are buffered by this object.
+	setvbuf( m_pFile, NULL, _IONBF, 0 );
+	m_bytes.resize( BYTE_BUFFER_SIZE );
+	m_pBytes = &m_bytes[0];
+	return true;
+}
+
+/**
+** @brief Replace the output file by the temporary file if the content has changed.
+**
+** If the content is the same the temporary file is removed and the output
+** file is kept. The temporary file is removed, too, if the output file 
+** cannot be replaced.
+*/
+bool FileOutputBuffer::commitFile()
+{
+	if ( isSameContent( m_sFilePath, m_sTempPath, m_nFileSize ) ) {
+		m_bUnchanged = true;
+		return _wremove( m_sTempPath.c_str() ) == 0;
+	}
+#ifdef _WIN32
+	const bool bMoved = ::MoveFileExW( m_sTempPath.c_str(), m_sFilePath.c_str(), MOVEFILE_REPLACE_EXISTING ) != FALSE;
+#else
+	_wremove( m_sFilePath.c_str() );
+	const bool bMoved = _wrename( m_sTempPath.c_str(), m_sFilePath.c_str() ) == 0;
+#endif
+	if ( !bMoved ) {
+		_wremove( m_sTempPath.c_str() );
+	}
+	return bMoved;
+}
+
+/**
+** @brief Check if the output file has the same content as the temporary file.
+**
+** The files are compared byte by byte. They are read only if the size
+** of the output file matches the number of bytes written.
+*/
+bool FileOutputBuffer::isSameContent( const std::wstring& sFilePath, const std::wstring& sTempPath, unsigned long long nFileSize )
+{
+	struct _stat64 fileInfo;
+	if ( _wstat64( sFilePath.c_str(), &fileInfo ) != 0 || (unsigned long long)fileInfo.st_size != nFileSize ) {
+		return false;
+	}
+
+	FILE* pFile = _wfopen( sFilePath.c_str(), L"rbS" );
+	if ( pFile == NULL ) {
+		return false;
+	}
+	FILE* pTempFile = _wfopen( sTempPath.c_str(), L"rbS" );
+	if ( pTempFile == NULL ) {
+		fclose( pFile );
+		return false;
+	}
+	std::vector<char> buffer( BYTE_BUFFER_SIZE );
+	std::vector<char> tempBuffer( BYTE_BUFFER_SIZE );
+	bool              bSame = true;
+	for ( size_t nCount = buffer.size(); bSame && nCount == buffer.size(); ) {
+		nCount = fread( &buffer[0], 1, buffer.size(), pFile );
+		const size_t nTempCount = fread( &tempBuffer[0], 1, tempBuffer.size(), pTempFile );
+		bSame = nCount == nTempCount && memcmp( &buffer[0], &tempBuffer[0], nCount ) == 0;
+	}
+	fclose( pTempFile );
+	fclose( pFile );
+
+	return bSame;
+}
+
+/**
+** @brief Open a named pipe for overlapped writes.
+**
+** @param pszFileName The path of the output file.
+** @returns <code>false</code> if the path is not the path of a named
+**          pipe or if the pipe cannot be opened for overlapped writes.
+*/
+bool FileOutputBuffer::openPipe( const wchar_t* pszFileName )
+{
+#ifdef _WIN32
+	static const wchar_t szPipePrefix[] = L"\\\\.\\pipe\\";
+	if ( _wcsnicmp( pszFileName, szPipePrefix, wcslen( szPipePrefix ) ) != 0 ) {
+		return false;
+	}
+
+	HANDLE hPipe = ::CreateFileW( pszFileName, GENERIC_WRITE, 0, NULL, OPEN_EXISTING, FILE_FLAG_OVERLAPPED, NULL );
+	if ( hPipe == INVALID_HANDLE_VALUE ) {
+		return false;
+	}
+	// Both buffers are allocated with a single call (i.e. page aligned).
+	char* pBuffers = static_cast<char*>( ::VirtualAlloc( NULL, 2 * BYTE_BUFFER_SIZE, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE ) );
+	HANDLE hEvent  = ::CreateEventW( NULL, TRUE, FALSE, NULL );
+	if ( pBuffers == NULL || hEvent == NULL ) {
+		if ( pBuffers != NULL ) {
+			::VirtualFree( pBuffers, 0, MEM_RELEASE );
+		}
+		if ( hEvent != NULL ) {
+			::CloseHandle( hEvent );
+		}
+		::CloseHandle( hPipe );
+		return false;
+	}
+
+	m_pPipe = new PipeData();
+	m_pPipe->hPipe      = hPipe;
+	m_pPipe->overlapped.hEvent = hEvent;
+	m_pPipe->buffers[0] = pBuffers;
+	m_pPipe->buffers[1] = pBuffers + BYTE_BUFFER_SIZE;
+	m_pPipe->nCurrent   = 0;
+	m_pPipe->dwPending  = 0;
+	m_pBytes = pBuffers;
+	return true;
+#else
+	// Not supported.
+	(void)pszFileName;
+	return false;
+#endif
+}
+
+/**
+** @brief Start writing the bytes encoded into the pipe.
+**
+** The write of the other buffer is completed first so it can be reused
+** for the next bytes.
+*/
+bool FileOutputBuffer::writePipe()
+{
+#ifdef _WIN32
+	PipeData& pipe = *m_pPipe;
+	if ( !waitPipe() ) {
+		return false;
+	}
+	if ( !::WriteFile( pipe.hPipe, m_pBytes, DWORD( m_nByteCount ), NULL, &pipe.overlapped ) 
+	  && ::GetLastError() != ERROR_IO_PENDING ) {
+		return false;
+	}
+	pipe.dwPending = DWORD( m_nByteCount );
+	pipe.nCurrent  = 1 - pipe.nCurrent;
+	m_pBytes = pipe.buffers[pipe.nCurrent];
+	return true;
+#else
+	return false;
+#endif
+}
+
+/**
+** @brief Wait until the bytes written into the pipe before have been read.
+*/
+bool FileOutputBuffer::waitPipe()
+{
+#ifdef _WIN32
+	PipeData& pipe = *m_pPipe;
+	if ( pipe.dwPending == 0 ) {
+		return true;
+	}
+	DWORD dwWritten = 0;
+	const BOOL bResult = ::GetOverlappedResult( pipe.hPipe, &pipe.overlapped, &dwWritten, TRUE );
+	const bool bSuccess = bResult && dwWritten == pipe.dwPending;
+	pipe.dwPending = 0;
+	return bSuccess;
+#else
+	return false;
+#endif
+}
+
+/**
+** @brief Close the named pipe.
+*/
+void FileOutputBuffer::closePipe() throw()
+{
+#ifdef _WIN32
+	if ( m_pPipe->dwPending != 0 ) {
+		// Cancel the write in progress before the buffer is released.
+		::CancelIo( m_pPipe->hPipe );
+		DWORD dwWritten = 0;
+		::GetOverlappedResult( m_pPipe->hPipe, &m_pPipe->overlapped, &dwWritten, TRUE );
+	}
+	::CloseHandle( m_pPipe->overlapped.hEvent );
+	::CloseHandle( m_pPipe->hPipe );
+	::VirtualFree( m_pPipe->buffers[0], 0, MEM_RELEASE );
+	delete m_pPipe;
+	m_pPipe = NULL;
+#endif
+}
+
+// --------------------------------------------------------------------
+// FileOutputStream
+// --------------------------------------------------------------------
+
+/**
+** @brief Constructor.
+*/
+FileOutputStream::FileOutputStream()
+: base( &m_buffer )
+{
+}
+
+/**
+** @brief Create the file and write the byte order mark of the code page.
+*/
+bool FileOutputStream::open( const std::wstring& fileName, const CodePageInfo& codePage )
+{
+	if ( !m_buffer.open( fileName.c_str(), codePage ) ) {
+		setstate( ios_base::failbit );
+		return false;
+	}
+	return true;
+}
+
+/**
+** @brief Write the remaining characters and close the file.
+*/
+void FileOutputStream::close()
+{
+	if ( !m_buffer.close() ) {
+		setstate( ios_base::badbit );
+	}
+}
+
 #ifdef _WIN32
 
 // --------------------------------------------------------------------
@@ -14,6 +14,9 @@
 namespace sqtpp 
 {
 
+enum CodePageId;
+class CodePageInfo;
+
 /**
 ** @brief A stream buffer for sequential reading and writting unicode files.
 **
@@ -103,6 +106,303 @@ private:
 	Chars w2c( wchar_t wchar ) const throw();
 };
 
+/**
+** @brief A read only stream buffer for the content of an input file.
+**
+** Regular files are mapped into memory (read with a single operation 
+** if this is not possible). The code page is detected by the byte order
+** mark found in memory and the content is converted block by block 
+** while it is read.
+*/
+class FileContentBuffer : public std::basic_streambuf<wchar_t>
+{
+private:
+	// Base class type definition.
+	typedef std::basic_streambuf<wchar_t> base;
+
+	// Type definition of the code page converter.
+	typedef std::codecvt<wchar_t , char, mbstate_t> Converter;
+
+	// Number of characters converted at once.
+	enum { BLOCK_SIZE = 0x4000 };
+
+	// The character substituted for invalid bytes in the input.
+	enum { REPLACEMENT_CHARACTER = 0xFFFD };
+
+	// The file content if the file wasn't mapped into memory.
+	std::vector<char> m_bytes;
+
+	// The file mapping handle (if the file is mapped into memory).
+	void*            m_hMapping;
+
+	// The view of the file mapping.
+	const void*      m_pView;
+
+	// The next byte to convert.
+	const char*      m_pNextByte;
+
+	// The end of the file content.
+	const char*      m_pEndByte;
+
+	// The converter of the file code page.
+	const Converter* m_pConverter;
+
+	// The conversion state.
+	mbstate_t        m_state;
+
+	// The characters converted.
+	std::wstring     m_content;
+
+public:
+	// Initialising constructor.
+	FileContentBuffer();
+
+	// Destructor.
+	virtual ~FileContentBuffer();
+private:
+	// Copy constructor (Not implemented).
+	FileContentBuffer( const FileContentBuffer& that );
+	// Assignment operator (Not implemented).
+	FileContentBuffer& operator= ( const FileContentBuffer& that );
+
+public:
+	// Open the file, detect its code page and prepare the conversion.
+	const CodePageInfo* open( const wchar_t* pszFileName, CodePageId defaultCodePageId );
+
+	// Use the content of a file read and decoded in advance.
+	void attach( std::wstring& content );
+
+	// Convert the remaining content at once.
+	void decodeAll( std::wstring& content );
+
+	// Release the file content.
+	void close() throw();
+
+protected:
+	// Convert the next block of characters.
+	virtual int_type underflow();
+
+private:
+	// Load the file content into memory.
+	bool load( const wchar_t* pszFileName );
+
+	// Convert the next block of characters.
+	size_t decode();
+
+	// Find the longest prefix of the remaining bytes the converter accepts.
+	size_t findValidLength();
+};
+
+/**
+** @brief A stream reading the decoded content of an input file.
+*/
+class FileContentStream : public std::wistream
+{
+private:
+	typedef std::wistream base;
+
+	// The stream buffer.
+	FileContentBuffer m_buffer;
+
+public:
+	// Constructor.
+	FileContentStream();
+
+private:
+	// Copy constructor (Not implemented).
+	FileContentStream( const FileContentStream& that );
+	// Assignment operator (Not implemented).
+	FileContentStream& operator= ( const FileContentStream& that );
+
+public:
+	// Read the file, detect its code page and decode the content.
+	const CodePageInfo* open( const std::wstring& fileName, CodePageId defaultCodePageId );
+
+	// Use the content of a file read and decoded in advance.
+	void attach( std::wstring& content );
+};
+
+/**
+** @brief A write only stream buffer encoding the characters directly into a file.
+**
+** The characters are encoded by the converter of the output code page
+** into a large byte buffer which is written to the (unbuffered) file
+** with a single operation if it is full. Large blocks of characters
+** are encoded without copying them into the put area.
+**
+** A named pipe (e.g. the one created by csql) is written with overlapped
+** I/O: The characters are encoded into one of two page aligned buffers
+** while the other one is read from the pipe.
+**
+** A regular file is written to a temporary file beside it. On close the
+** temporary file replaces the file only if the content has changed. So
+** the modification time of an output file with the same content is kept.
+*/
+class FileOutputBuffer : public std::basic_streambuf<wchar_t>
+{
+private:
+	// Base class type definition.
+	typedef std::basic_streambuf<wchar_t> base;
+
+	// Type definition of the code page converter.
+	typedef std::codecvt<wchar_t , char, mbstate_t> Converter;
+
+	// Size of the put area for single characters and short strings.
+	enum { CHAR_BUFFER_SIZE = 0x400 };
+
+	// Size of the buffer for the encoded bytes.
+	enum { BYTE_BUFFER_SIZE = 0x40000 };
+
+	// Structure of the state of the overlapped writes into a named pipe.
+	struct PipeData;
+
+	// The output file.
+	FILE*            m_pFile;
+
+	// The named pipe written to instead of the file (Windows only).
+	PipeData*        m_pPipe;
+
+	// The converter of the output code page.
+	const Converter* m_pConverter;
+
+	// The maximal number of bytes of a character encoded.
+	size_t           m_nMaxLength;
+
+	// The conversion state.
+	mbstate_t        m_state;
+
+	// The byte buffer of the file.
+	std::vector<char> m_bytes;
+
+	// The buffer for the bytes encoded.
+	char*            m_pBytes;
+
+	// The number of bytes encoded but not yet written.
+	size_t           m_nByteCount;
+
+	// The path of the output file.
+	std::wstring     m_sFilePath;
+
+	// The path of the temporary file written instead (empty if none).
+	std::wstring     m_sTempPath;
+
+	// The number of bytes written.
+	unsigned long long m_nFileSize;
+
+	// Flag set if the output file has been kept because the content was the same.
+	bool             m_bUnchanged;
+
+	// The put area.
+	wchar_t          m_chars[CHAR_BUFFER_SIZE];
+
+public:
+	// Constructor.
+	FileOutputBuffer();
+
+	// Destructor.
+	virtual ~FileOutputBuffer();
+private:
+	// Copy constructor (Not implemented).
+	FileOutputBuffer( const FileOutputBuffer& that );
+	// Assignment operator (Not implemented).
+	FileOutputBuffer& operator= ( const FileOutputBuffer& that );
+
+public:
+	// Create the file and write the byte order mark of the code page.
+	bool open( const wchar_t* pszFileName, const CodePageInfo& codePage );
+
+	// Write the remaining characters and close the file.
+	bool close();
+
+	// Check if the file is open.
+	bool is_open() const throw()
+	{
+		return m_pFile != NULL || m_pPipe != NULL;
+	}
+
+	// Check if the output file has been kept because the content was the same.
+	bool isUnchanged() const throw()
+	{
+		return m_bUnchanged;
+	}
+
+protected:
+	// Write the characters buffered to the file.
+	virtual int sync();
+
+	// Put a character into the stream.
+	virtual int_type overflow( int_type character = traits_type::eof() );
+
+	// Put a string into the stream.
+	virtual std::streamsize xsputn( const wchar_t* buffer, std::streamsize count );
+
+private:
+	// Encode the characters of the put area.
+	bool encodeChars();
+
+	// Encode a block of characters into the byte buffer.
+	bool encode( const wchar_t* pFrom, const wchar_t* pFromMax );
+
+	// Write the bytes encoded to the file.
+	bool writeBytes();
+
+	// Create the output file (or a temporary file beside it).
+	bool openFile( const wchar_t* pszFileName );
+
+	// Replace the output file by the temporary file if the content has changed.
+	bool commitFile();
+
+	// Check if the output file has the same content as the temporary file.
+	static bool isSameContent( const std::wstring& sFilePath, const std::wstring& sTempPath, unsigned long long nFileSize );
+
+	// Open a named pipe for overlapped writes.
+	bool openPipe( const wchar_t* pszFileName );
+
+	// Start writing the bytes encoded into the pipe.
+	bool writePipe();
+
+	// Wait until the bytes written into the pipe before have been read.
+	bool waitPipe();
+
+	// Close the named pipe.
+	void closePipe() throw();
+};
+
+/**
+** @brief A stream writing an output file in a given code page.
+*/
+class FileOutputStream : public std::wostream
+{
+private:
+	typedef std::wostream base;
+
+	// The stream buffer.
+	FileOutputBuffer m_buffer;
+
+public:
+	// Constructor.
+	FileOutputStream();
+
+private:
+	// Copy constructor (Not implemented).
+	FileOutputStream( const FileOutputStream& that );
+	// Assignment operator (Not implemented).
+	FileOutputStream& operator= ( const FileOutputStream& that );
+
+public:
+	// Create the file and write the byte order mark of the code page.
+	bool open( const std::wstring& fileName, const CodePageInfo& codePage );
+
+	// Write the remaining characters and close the file.
+	void close();
+
+	// Check if the output file has been kept because the content was the same.
+	bool isUnchanged() const throw()
+	{
+		return m_buffer.isUnchanged();
+	}
+};
+
 #ifdef _WIN32
 
 /**
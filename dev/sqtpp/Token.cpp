@@ -18,7 +18,6 @@ const TokenInfo TokenInfo::m_tokenInfo[] = {
 	{ TOK_UNDEFINED,          L"TOK_UNDEFINED", L"Undefined / Unknown" },
 	{ TOK_LINE_COMMENT,       L"TOK_LINE_COMMENT", L"Line comment // or -- (SQL)" },
 	{ TOK_BLOCK_COMMENT,      L"TOK_BLOCK_COMMENT", L"Block comment /*...*/" },
-	{ TOK_ORACLE_HINT,        L"TOK_ORACLE_HINT", L"Oracle optimiser hint: /*+...*/" },
 	{ TOK_SHARP,              L"TOK_SHARP", L"#" },
 	{ TOK_SHARP_SHARP,        L"TOK_SHARP_SHARP", L"##" },
 	{ TOK_SHARP_AT,           L"TOK_SHARP_AT", L"#@" },
@@ -242,16 +241,29 @@ void TokenExpressions::trim( const bool bRemoveLineFeeds, const bool bRemoveBloc
 ** @param delimiter The character to be used to delimit the string.
 ** @param escape    The character to be inserted when the delimiter
 **        is encountered somewhere in the middle of the expression.
+** @param bCollapseBlanks If true each run of blanks and new lines
+**        between the tokens is replaced by a single blank.
 */
-const wstring TokenExpressions::stringize( const wchar_t delimiter, const wchar_t escape ) const
+const wstring TokenExpressions::stringize( const wchar_t delimiter, const wchar_t escape, const bool bCollapseBlanks ) const
 {
 	wstringstream buffer;
+	bool          bBlank = false;
 
 	buffer << delimiter;
 
 	for ( const_iterator it = this->begin(); it != this->end(); ++it ) {
 		const TokenExpression& tokenExpression = *it;
 		const wstring&         sTokenText      = tokenExpression.getText();
+		const Token            token           = tokenExpression.getToken();
+
+		if ( bCollapseBlanks && ( token == TOK_SPACE || token == TOK_NEW_LINE || token == TOK_EOL_BACKSLASH ) ) {
+			if ( !bBlank ) {
+				buffer << L' ';
+				bBlank = true;
+			}
+			continue;
+		}
+		bBlank = false;
 
 		for ( size_t i = 0; i < sTokenText.length(); ++i ) {
 			wchar_t ch = sTokenText[i];
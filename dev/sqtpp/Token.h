@@ -28,7 +28,6 @@ enum Token
 	TOK_LINE_COMMENT,          //!< "//.*$" or "--.*$" (SQL)
 	TOK_BLOCK_COMMENT,         //!< "/*"
 	TOK_SQL_LINE_COMMENT,      //!< "--.*"
-	TOK_ORACLE_HINT,           //!< "/*+"
 	TOK_SHARP,                 //!< "#"
 	TOK_SHARP_SHARP,           //!< "##"
 	TOK_SHARP_AT,              //!< "#@"
@@ -190,7 +189,7 @@ public:
 	void trim( const bool bRemoveLineFeeds, const bool bRemoveBlockComments, const bool bRemoveLineComments, const bool bRemoveSqlComments );
 
 	// Stringize tokens (for \# and \#@ macro operators.
-	const wstring stringize( const wchar_t delimiter, const wchar_t escape ) const;
+	const wstring stringize( const wchar_t delimiter, const wchar_t escape, const bool bCollapseBlanks = false ) const;
 };
 
 
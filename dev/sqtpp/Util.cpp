@@ -162,4 +162,83 @@ const wstring Util::trim( const wstring& str, wchar_t c )
 	return trimed;
 }
 
+/**
+** @brief Continue the FNV-1a hash value of a byte sequence.
+**
+** @param nHash The hash of the preceding bytes (#HASH_OFFSET_BASIS to start a new sequence).
+** @param pBytes The bytes to add.
+** @param nCount The number of bytes.
+*/
+unsigned long long Util::hashBytes( unsigned long long nHash, const char* pBytes, size_t nCount ) throw()
+{
+	// Prime of the 64 bit FNV-1a hash function.
+	const unsigned long long FNV_PRIME = 0x100000001B3ULL;
+
+	const unsigned char* pByte    = reinterpret_cast<const unsigned char*>( pBytes );
+	const unsigned char* pByteMax = pByte + nCount;
+	while ( pByte < pByteMax ) {
+		nHash^= *pByte++;
+		nHash*= FNV_PRIME;
+	}
+	return nHash;
+}
+
+/**
+** @brief Continue the FNV-1a hash value of a text.
+**
+** The characters are hashed as UTF-16LE independent of the size of wchar_t.
+**
+** @param nHash The hash of the preceding text (#HASH_OFFSET_BASIS to start a new sequence).
+** @param pwcText The characters to add.
+** @param nLength The number of characters.
+*/
+unsigned long long Util::hashText( unsigned long long nHash, const wchar_t* pwcText, size_t nLength ) throw()
+{
+	char bytes[0x200];
+	while ( nLength > 0 ) {
+		const size_t nCount = nLength < sizeof( bytes ) / 2 ? nLength : sizeof( bytes ) / 2;
+		for ( size_t nChar = 0; nChar < nCount; ++nChar ) {
+			const unsigned int c = (unsigned int)pwcText[nChar];
+			bytes[2 * nChar]     = char( c & 0xFF );
+			bytes[2 * nChar + 1] = char( ( c >> 8 ) & 0xFF );
+		}
+		nHash = hashBytes( nHash, bytes, 2 * nCount );
+		pwcText+= nCount;
+		nLength-= nCount;
+	}
+	return nHash;
+}
+
+/**
+** @brief Write a number without thousand grouping separators.
+**
+** The stream operator may insert them depending on the locale of the stream.
+*/
+void Util::writeNumber( std::wostream& output, unsigned long long nNumber )
+{
+	wchar_t buffer[24];
+	wchar_t* pwc = &buffer[23];
+	*pwc = L'\0';
+	do {
+		*--pwc = wchar_t( L'0' + nNumber % 10 );
+		nNumber/= 10;
+	} while ( nNumber != 0 );
+	output << pwc;
+}
+
+/**
+** @brief Write a hash value as 16 hexadecimal digits.
+*/
+void Util::writeHash( std::wostream& output, unsigned long long nHash )
+{
+	static const wchar_t digits[] = L"0123456789abcdef";
+	wchar_t buffer[17];
+	for ( int nDigit = 15; nDigit >= 0; --nDigit ) {
+		buffer[nDigit] = digits[nHash & 0xF];
+		nHash>>= 4;
+	}
+	buffer[16] = L'\0';
+	output << buffer;
+}
+
 } // namespace sqtpp
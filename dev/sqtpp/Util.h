@@ -84,6 +84,24 @@ public:
 	// Remove leading and trailing blanks from a string
 	static const wstring trim( const wstring& str );
 
+	/// Check if the character is a blank (space or tab).
+	static bool isBlank( wchar_t c ) throw() { return c == L' ' || c == L'\t'; }
+
+	/// Offset basis of the 64 bit FNV-1a hash function (the hash of an empty sequence).
+	static const unsigned long long HASH_OFFSET_BASIS = 0xCBF29CE484222325ULL;
+
+	// Continue the FNV-1a hash value of a byte sequence.
+	static unsigned long long hashBytes( unsigned long long nHash, const char* pBytes, size_t nCount ) throw();
+
+	// Continue the FNV-1a hash value of a text (hashed as UTF-16LE).
+	static unsigned long long hashText( unsigned long long nHash, const wchar_t* pwcText, size_t nLength ) throw();
+
+	// Write a number without thousand grouping separators.
+	static void writeNumber( std::wostream& output, unsigned long long nNumber );
+
+	// Write a hash value as 16 hexadecimal digits.
+	static void writeHash( std::wostream& output, unsigned long long nHash );
+
 };
 
 } // namespace